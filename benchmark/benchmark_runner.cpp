@@ -19,12 +19,15 @@
 #include "multi_doc/find_many.hpp"
 #include "multi_doc/gridfs_download.hpp"
 #include "multi_doc/gridfs_upload.hpp"
+#include "multi_doc/gridfs_upload_from_file.hpp"
 #include "parallel/gridfs_multi_export.hpp"
 #include "parallel/gridfs_multi_import.hpp"
 #include "parallel/json_multi_export.hpp"
 #include "parallel/json_multi_import.hpp"
+#include "parallel/pool_startup.hpp"
 #include "single_doc/find_one_by_id.hpp"
 #include "single_doc/insert_one.hpp"
+#include "single_doc/prepared_aggregate.hpp"
 #include "single_doc/run_command.hpp"
 
 #include <chrono>
@@ -73,6 +76,12 @@ benchmark_runner::benchmark_runner(std::set<benchmark_type> types) : _types{type
     //     std::make_unique<gridfs_upload>("single_and_multi_document/gridfs_large.bin"));
     // _microbenches.push_back(
     //     std::make_unique<gridfs_download>("single_and_multi_document/gridfs_large.bin"));
+    // _microbenches.push_back(
+    //     std::make_unique<gridfs_upload_from_file>(
+    //         "TestGridFsUploadFromStream", "single_and_multi_document/gridfs_large.bin", false));
+    // _microbenches.push_back(
+    //     std::make_unique<gridfs_upload_from_file>(
+    //         "TestGridFsUploadFromFile", "single_and_multi_document/gridfs_large.bin", true));
 
     // Parallel microbenchmarks
     _microbenches.push_back(std::make_unique<json_multi_import>("parallel/ldjson_multi"));
@@ -81,6 +90,14 @@ benchmark_runner::benchmark_runner(std::set<benchmark_type> types) : _types{type
     // _microbenches.push_back(std::make_unique<gridfs_multi_import>("parallel/gridfs_multi"));
     // _microbenches.push_back(std::make_unique<gridfs_multi_export>("parallel/gridfs_multi"));
 
+    // Startup microbenchmarks
+    _microbenches.push_back(std::make_unique<pool_startup>("TestPoolColdStart", false));
+    _microbenches.push_back(std::make_unique<pool_startup>("TestPoolWarmStart", true));
+
+    // Prepared command microbenchmarks
+    _microbenches.push_back(std::make_unique<prepared_aggregate>("TestAggregateEightStages", false));
+    _microbenches.push_back(std::make_unique<prepared_aggregate>("TestPreparedAggregateEightStages", true));
+
     // Need to remove some
     if (!_types.empty()) {
         for (auto&& it = _microbenches.begin(); it != _microbenches.end();) {
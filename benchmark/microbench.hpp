@@ -35,6 +35,8 @@ enum class benchmark_type {
     read_bench,
     write_bench,
     run_command_bench,
+    startup_bench,
+    prepare_bench,
 };
 
 static std::unordered_map<benchmark_type, std::string> const type_names = {
@@ -44,7 +46,9 @@ static std::unordered_map<benchmark_type, std::string> const type_names = {
     {benchmark_type::parallel_bench, "ParallelBench"},
     {benchmark_type::read_bench, "ReadBench"},
     {benchmark_type::write_bench, "WriteBench"},
-    {benchmark_type::run_command_bench, "RunCommandBench"}};
+    {benchmark_type::run_command_bench, "RunCommandBench"},
+    {benchmark_type::startup_bench, "StartupBench"},
+    {benchmark_type::prepare_bench, "PrepareBench"}};
 
 static std::unordered_map<std::string, benchmark_type> const names_types = {
     {"BSONBench", benchmark_type::bson_bench},
@@ -53,7 +57,9 @@ static std::unordered_map<std::string, benchmark_type> const names_types = {
     {"ParallelBench", benchmark_type::parallel_bench},
     {"ReadBench", benchmark_type::read_bench},
     {"WriteBench", benchmark_type::write_bench},
-    {"RunCommandBench", benchmark_type::run_command_bench}};
+    {"RunCommandBench", benchmark_type::run_command_bench},
+    {"StartupBench", benchmark_type::startup_bench},
+    {"PrepareBench", benchmark_type::prepare_bench}};
 
 constexpr std::chrono::milliseconds mintime{60000};
 constexpr std::chrono::milliseconds maxtime{300000};
@@ -0,0 +1,86 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "../microbench.hpp"
+
+#include <fstream>
+#include <string>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/gridfs/bucket.hpp>
+#include <mongocxx/v1/gridfs/upload_result.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+namespace benchmark {
+
+// Measures uploading a file from disk to GridFS, either by reading it through an input stream via
+// `upload_from_stream()` or by memory-mapping it via `upload_from_file()`.
+class gridfs_upload_from_file : public microbench {
+   public:
+    gridfs_upload_from_file() = delete;
+
+    // The task size comes from the Driver Perfomance Benchmarking Reference Doc.
+    gridfs_upload_from_file(std::string name, std::string file_name, bool mapped)
+        : microbench{
+              std::move(name),
+              52.43,
+              std::set<benchmark_type>{benchmark_type::multi_bench, benchmark_type::write_bench}},
+          _conn{mongocxx::v1::uri{}},
+          _file_name{std::move(file_name)},
+          _mapped{mapped} {}
+
+    void setup();
+
+    void before_task();
+
+    void teardown();
+
+   protected:
+    void task();
+
+   private:
+    mongocxx::v1::client _conn;
+    mongocxx::v1::gridfs::bucket _bucket;
+    std::string _file_name;
+    bool _mapped;
+};
+
+void gridfs_upload_from_file::setup() {
+    _conn["perftest"].drop();
+}
+
+void gridfs_upload_from_file::before_task() {
+    auto db = _conn["perftest"];
+    _bucket = db.gridfs_bucket();
+    db[std::string{_bucket.bucket_name()} + ".chunks"].drop();
+    db[std::string{_bucket.bucket_name()} + ".files"].drop();
+}
+
+void gridfs_upload_from_file::teardown() {
+    _conn["perftest"].drop();
+}
+
+void gridfs_upload_from_file::task() {
+    if (_mapped) {
+        _bucket.upload_from_file("actual_file", _file_name);
+    } else {
+        std::ifstream stream{_file_name, std::ios::binary};
+        _bucket.upload_from_stream("actual_file", stream);
+    }
+}
+} // namespace benchmark
@@ -0,0 +1,85 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "../microbench.hpp"
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <bsoncxx/v1/document/literal.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+namespace benchmark {
+
+// Measures the latency of the first burst of concurrent operations executed by a freshly constructed pool, with and
+// without establishing connections ahead of time via `warm_up()`.
+class pool_startup : public microbench {
+   public:
+    pool_startup() = delete;
+
+    pool_startup(std::string name, bool warm_up, std::uint32_t thread_num = std::thread::hardware_concurrency())
+        : microbench{std::move(name), 0.13, std::set<benchmark_type>{benchmark_type::startup_bench}},
+          _warm_up{warm_up},
+          _thread_num{thread_num} {}
+
+    void before_task();
+
+    void after_task();
+
+   protected:
+    void task();
+
+   private:
+    bool _warm_up;
+    std::uint32_t _thread_num;
+    std::unique_ptr<mongocxx::v1::pool> _pool;
+};
+
+void pool_startup::before_task() {
+    _pool = std::make_unique<mongocxx::v1::pool>(mongocxx::v1::uri{});
+
+    if (_warm_up) {
+        _pool->warm_up(_thread_num, std::chrono::steady_clock::now() + std::chrono::seconds{10});
+    }
+}
+
+void pool_startup::after_task() {
+    _pool.reset();
+}
+
+void pool_startup::task() {
+    static constexpr auto command =
+        bsoncxx::v1::document::make_literal(bsoncxx::v1::document::literal_field("ping", 1));
+
+    std::vector<std::thread> threads;
+
+    for (std::uint32_t i = 0; i < _thread_num; i++) {
+        threads.push_back(std::thread{[&] {
+            auto entry = _pool->acquire();
+            entry["admin"].run_command(command.view());
+        }});
+    }
+    for (std::uint32_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+} // namespace benchmark
@@ -0,0 +1,107 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "../microbench.hpp"
+
+#include <bsoncxx/builder/basic/array.hpp>
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/basic/kvp.hpp>
+#include <bsoncxx/v1/document/literal.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+
+#include <mongocxx/v1/aggregate_options.hpp>
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+#include <mongocxx/v1/prepared_aggregate.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+namespace benchmark {
+
+using bsoncxx::builder::basic::kvp;
+using bsoncxx::builder::basic::make_array;
+using bsoncxx::builder::basic::make_document;
+
+// Measures the client-side cost of issuing an eight-stage "aggregate" command, with and without preparing the pipeline
+// and options ahead of time via `prepared_aggregate`. The cursors are not iterated: only the command construction is
+// measured.
+class prepared_aggregate : public microbench {
+   public:
+    prepared_aggregate() = delete;
+
+    prepared_aggregate(std::string name, bool prepared)
+        : microbench{std::move(name), 0.16, std::set<benchmark_type>{benchmark_type::prepare_bench}},
+          _conn{mongocxx::v1::uri{}},
+          _prepared{prepared} {}
+
+   protected:
+    void task();
+
+   private:
+    static mongocxx::v1::pipeline make_pipeline();
+
+    mongocxx::v1::client _conn;
+    bool _prepared;
+};
+
+mongocxx::v1::pipeline prepared_aggregate::make_pipeline() {
+    using bsoncxx::v1::document::literal_field;
+    using bsoncxx::v1::document::make_literal;
+
+    static constexpr auto match = make_literal(literal_field("status", "active"));
+    static constexpr auto project =
+        make_literal(literal_field("_id", 1), literal_field("total", 1), literal_field("key", 1));
+    static constexpr auto group = make_literal(
+        literal_field("_id", "$key"), literal_field("sum", make_literal(literal_field("$sum", "$total"))));
+    static constexpr auto sort = make_literal(literal_field("sum", -1));
+
+    // Document literals do not support arrays.
+    auto const add_fields = make_document(kvp("total", make_document(kvp("$add", make_array("$a", "$b")))));
+
+    mongocxx::v1::pipeline pipeline;
+
+    pipeline.match(match.view())
+        .add_fields(bsoncxx::v1::document::view{add_fields.view()})
+        .project(project.view())
+        .unwind("$key")
+        .group(group.view())
+        .sort(sort.view())
+        .skip(std::int32_t{10})
+        .limit(std::int32_t{100});
+
+    return pipeline;
+}
+
+void prepared_aggregate::task() {
+    auto coll = _conn["perftest"]["corpus"];
+
+    mongocxx::v1::aggregate_options opts;
+    opts.batch_size(100).allow_disk_use(true);
+
+    if (_prepared) {
+        mongocxx::v1::prepared_aggregate const prepared{make_pipeline(), opts};
+
+        for (std::int32_t i = 0; i < iterations; i++) {
+            (void)prepared.execute(coll);
+        }
+    } else {
+        for (std::int32_t i = 0; i < iterations; i++) {
+            (void)coll.aggregate(make_pipeline(), opts);
+        }
+    }
+}
+} // namespace benchmark
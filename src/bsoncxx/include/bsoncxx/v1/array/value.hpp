@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <type_traits>
 #include <utility>
 
@@ -213,6 +214,16 @@ class value {
 } // namespace v1
 } // namespace bsoncxx
 
+///
+/// Equivalent to `std::hash<bsoncxx::v1::array::view>` over `v.view()`.
+///
+template <>
+struct std::hash<bsoncxx::v1::array::value> {
+    std::size_t operator()(bsoncxx::v1::array::value const& v) const noexcept {
+        return std::hash<bsoncxx::v1::array::view>{}(v.view());
+    }
+};
+
 #include <bsoncxx/v1/detail/postlude.hpp>
 
 ///
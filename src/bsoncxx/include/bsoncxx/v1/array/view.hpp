@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 
 namespace bsoncxx {
 namespace v1 {
@@ -160,6 +161,16 @@ class view {
 } // namespace v1
 } // namespace bsoncxx
 
+///
+/// Equivalent to `std::hash<bsoncxx::v1::document::view>` over the same BSON bytes.
+///
+template <>
+struct std::hash<bsoncxx::v1::array::view> {
+    std::size_t operator()(bsoncxx::v1::array::view v) const noexcept {
+        return std::hash<bsoncxx::v1::document::view>{}(bsoncxx::v1::document::view{v.data()});
+    }
+};
+
 #include <bsoncxx/v1/detail/postlude.hpp>
 
 ///
@@ -83,6 +83,44 @@ using bool_constant = std::integral_constant<bool, B>;
 template <typename...>
 struct mp_list;
 
+// Equivalent to `std::index_sequence` in C++14.
+template <std::size_t... Is>
+struct index_sequence {
+    static constexpr std::size_t size() noexcept {
+        return sizeof...(Is);
+    }
+};
+
+template <typename L, typename R>
+struct concat_index_sequence;
+
+template <std::size_t... Ls, std::size_t... Rs>
+struct concat_index_sequence<index_sequence<Ls...>, index_sequence<Rs...>> {
+    using type = index_sequence<Ls..., (sizeof...(Ls) + Rs)...>;
+};
+
+// Logarithmic instantiation depth to support large sequences.
+template <std::size_t N>
+struct make_index_sequence_impl {
+    using type = type_t<concat_index_sequence<
+        type_t<make_index_sequence_impl<N / 2u>>,
+        type_t<make_index_sequence_impl<N - N / 2u>>>>;
+};
+
+template <>
+struct make_index_sequence_impl<0u> {
+    using type = index_sequence<>;
+};
+
+template <>
+struct make_index_sequence_impl<1u> {
+    using type = index_sequence<0u>;
+};
+
+// Equivalent to `std::make_index_sequence` in C++14.
+template <std::size_t N>
+using make_index_sequence = type_t<make_index_sequence_impl<N>>;
+
 // Details for implementing the C++11 detection idiom.
 namespace impl_detection {
 
@@ -0,0 +1,103 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/v1/document/canonical-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/detail/prelude.hpp>
+
+#include <bsoncxx/v1/config/export.hpp>
+#include <bsoncxx/v1/document/view.hpp> // IWYU pragma: export
+
+#include <cstddef>
+
+namespace bsoncxx {
+namespace v1 {
+namespace document {
+
+///
+/// A hash function over the content of a BSON document which is consistent with @ref canonical_equal_to.
+///
+/// Unlike `std::hash<bsoncxx::v1::document::view>`, which hashes the BSON bytes as-is, the result does not depend on:
+///
+/// - the order of fields within a document (including embedded documents), or
+/// - the BSON type of an integral numeric value (e.g. `1` as a 32-bit integer, a 64-bit integer, a double, and a
+///   decimal128 hash equal), or
+/// - the representation of a decimal128 value (e.g. `1.0` and `1.00` hash equal).
+///
+/// Non-integral doubles (including NaN) are not normalized: they are hashed and compared as-is, so e.g. `0.5` as a
+/// double and `0.5` as a decimal128 do not compare equal.
+///
+/// The order of elements within an array is significant.
+///
+/// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::view::errc::invalid_data if the BSON bytes are
+/// invalid.
+///
+/// @note Prefer `std::hash<bsoncxx::v1::document::view>` and `std::equal_to<bsoncxx::v1::document::view>` when the
+/// documents being compared are known to be produced by the same serializer.
+///
+struct canonical_hash {
+    ///
+    /// Return the canonical hash of `v`.
+    ///
+    /// All invalid documents hash equal.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) operator()(v1::document::view v) const;
+};
+
+///
+/// An equality comparison over the content of a BSON document which is consistent with @ref canonical_hash.
+///
+/// Two documents compare equal when they contain the same number of fields and, after ordering the fields of each
+/// document by key, each pair of fields have equal keys and values which compare equal, where:
+///
+/// - embedded documents are compared as described above,
+/// - arrays compare equal when they have the same number of elements and each pair of elements compare equal in order,
+/// - integral numeric values (32-bit integer, 64-bit integer, double, and decimal128) compare equal when they are
+///   mathematically equal,
+/// - non-integral decimal128 values compare equal when they are numerically equal regardless of representation (all
+///   NaNs compare equal), and
+/// - all other values compare equal according to `bsoncxx::v1::types::view::operator==`.
+///
+/// Fields with equal keys (duplicate keys) retain their relative order, so `{a: 1, a: 2}` compares equal to
+/// `{a: 1, a: 2}` but not to `{a: 2, a: 1}`. The comparison is symmetric.
+///
+/// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::view::errc::invalid_data if the BSON bytes are
+/// invalid.
+///
+struct canonical_equal_to {
+    ///
+    /// Return true when `lhs` and `rhs` compare equal.
+    ///
+    /// An invalid document only compares equal to another invalid document.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(bool) operator()(v1::document::view lhs, v1::document::view rhs) const;
+};
+
+} // namespace document
+} // namespace v1
+} // namespace bsoncxx
+
+#include <bsoncxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref bsoncxx::v1::document::canonical_hash and @ref bsoncxx::v1::document::canonical_equal_to.
+///
+/// @par Includes
+/// - @ref bsoncxx/v1/document/view.hpp
+///
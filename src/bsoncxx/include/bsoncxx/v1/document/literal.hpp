@@ -0,0 +1,338 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/v1/document/literal-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/detail/prelude.hpp>
+
+#include <bsoncxx/v1/detail/type_traits.hpp>
+#include <bsoncxx/v1/document/view.hpp> // IWYU pragma: export
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace bsoncxx {
+namespace detail {
+namespace literal_impl {
+
+constexpr std::uint8_t le_byte(std::uint64_t v, std::size_t i) {
+    return static_cast<std::uint8_t>((v >> (8u * i)) & 0xFFu);
+}
+
+// A BSON type value with a fixed size whose bytes are the little-endian representation of `value`.
+template <std::uint8_t Type, std::size_t Size>
+struct fixed {
+    std::uint64_t value;
+
+    static constexpr std::uint8_t type_id() {
+        return Type;
+    }
+
+    static constexpr std::size_t size() {
+        return Size;
+    }
+
+    constexpr std::uint8_t at(std::size_t i) const {
+        return le_byte(value, i);
+    }
+};
+
+using b_bool = fixed<0x08, 1u>;
+using b_null = fixed<0x0A, 0u>;
+using b_int32 = fixed<0x10, 4u>;
+using b_int64 = fixed<0x12, 8u>;
+
+// A BSON UTF-8 string value from a null-terminated string literal of length `N - 1`.
+template <std::size_t N>
+struct b_string {
+    char const* str;
+
+    static constexpr std::uint8_t type_id() {
+        return 0x02;
+    }
+
+    static constexpr std::size_t size() {
+        return 4u + N;
+    }
+
+    constexpr std::uint8_t at(std::size_t i) const {
+        return i < 4u ? le_byte(N, i) : i + 1u == size() ? std::uint8_t{0u} : static_cast<std::uint8_t>(str[i - 4u]);
+    }
+};
+
+// A BSON embedded document value.
+template <std::size_t N>
+struct b_document {
+    v1::document::literal<N> doc;
+
+    static constexpr std::uint8_t type_id() {
+        return 0x03;
+    }
+
+    static constexpr std::size_t size() {
+        return N;
+    }
+
+    constexpr std::uint8_t at(std::size_t i) const {
+        return doc.data()[i];
+    }
+};
+
+// Signed integers which fit in 32 bits are encoded as BSON 32-bit integers.
+template <typename T>
+struct is_int32 : bool_constant<
+                      std::is_integral<T>::value && std::is_signed<T>::value && !std::is_same<T, bool>::value &&
+                      sizeof(T) <= 4u> {};
+
+// Signed integers which require 64 bits are encoded as BSON 64-bit integers.
+template <typename T>
+struct is_int64 : bool_constant<
+                      std::is_integral<T>::value && std::is_signed<T>::value && !std::is_same<T, bool>::value &&
+                      sizeof(T) == 8u> {};
+
+constexpr b_bool to_value(bool v) {
+    return {v ? 1u : 0u};
+}
+
+constexpr b_null to_value(std::nullptr_t) {
+    return {0u};
+}
+
+template <typename T, enable_if_t<is_int32<T>::value>* = nullptr>
+constexpr b_int32 to_value(T v) {
+    return {static_cast<std::uint32_t>(v)};
+}
+
+template <typename T, enable_if_t<is_int64<T>::value>* = nullptr>
+constexpr b_int64 to_value(T v) {
+    return {static_cast<std::uint64_t>(v)};
+}
+
+template <std::size_t N>
+constexpr b_string<N> to_value(char const (&str)[N]) {
+    return {str};
+}
+
+template <std::size_t N>
+constexpr b_document<N> to_value(v1::document::literal<N> const& doc) {
+    return {doc};
+}
+
+// A BSON element: the type byte, the null-terminated key of length `K - 1`, and the BSON type value.
+template <std::size_t K, typename V>
+struct field {
+    char const* key;
+    V value;
+
+    static constexpr std::size_t size() {
+        return 1u + K + V::size();
+    }
+
+    constexpr std::uint8_t at(std::size_t i) const {
+        return i == 0u ? V::type_id()
+               : i < K ? static_cast<std::uint8_t>(key[i - 1u])
+               : i == K ? std::uint8_t{0u}
+                        : value.at(i - 1u - K);
+    }
+};
+
+// A sequence of BSON elements.
+template <typename... Fields>
+struct fields;
+
+template <>
+struct fields<> {
+    static constexpr std::size_t size() {
+        return 0u;
+    }
+
+    constexpr std::uint8_t at(std::size_t) const {
+        return 0u;
+    }
+};
+
+template <typename Field, typename... Fields>
+struct fields<Field, Fields...> {
+    Field head;
+    fields<Fields...> tail;
+
+    static constexpr std::size_t size() {
+        return Field::size() + fields<Fields...>::size();
+    }
+
+    constexpr std::uint8_t at(std::size_t i) const {
+        return i < Field::size() ? head.at(i) : tail.at(i - Field::size());
+    }
+};
+
+constexpr fields<> make_fields() {
+    return {};
+}
+
+template <typename Field, typename... Fields>
+constexpr fields<Field, Fields...> make_fields(Field const& head, Fields const&... tail) {
+    return {head, make_fields(tail...)};
+}
+
+// A BSON document: the length prefix, the sequence of BSON elements, and the null terminator.
+template <typename Fields>
+struct document {
+    Fields elements;
+
+    static constexpr std::size_t size() {
+        return 4u + Fields::size() + 1u;
+    }
+
+    constexpr std::uint8_t at(std::size_t i) const {
+        return i < 4u ? le_byte(size(), i) : i + 1u == size() ? std::uint8_t{0u} : elements.at(i - 4u);
+    }
+};
+
+} // namespace literal_impl
+} // namespace detail
+} // namespace bsoncxx
+
+namespace bsoncxx {
+namespace v1 {
+namespace document {
+
+///
+/// A BSON document whose BSON bytes are computed at compile time.
+///
+/// A literal is obtained via @ref make_literal. When declared `constexpr` with static storage duration, the BSON
+/// bytes are stored in read-only data and no work is performed to obtain a @ref bsoncxx::v1::document::view:
+///
+/// ```cpp
+/// static constexpr auto ping = bsoncxx::v1::document::make_literal(bsoncxx::v1::document::literal_field("ping", 1));
+///
+/// db.run_command(ping.view());
+/// ```
+///
+/// @tparam N The length of the BSON bytes.
+///
+template <std::size_t N>
+class literal {
+    static_assert(N >= 5u, "a BSON document is at least 5 bytes");
+    static_assert(N <= INT32_MAX, "a BSON document is at most INT32_MAX bytes");
+
+    std::uint8_t _data[N];
+
+    template <typename Fields, std::size_t... Is>
+    constexpr literal(detail::literal_impl::document<Fields> const& doc, detail::index_sequence<Is...>)
+        : _data{doc.at(Is)...} {}
+
+   public:
+    ///
+    /// Initialize with the BSON bytes of `doc`.
+    ///
+    /// @note Prefer @ref make_literal.
+    ///
+    template <typename Fields>
+    constexpr explicit literal(detail::literal_impl::document<Fields> const& doc)
+        : literal(doc, detail::make_index_sequence<N>{}) {
+        static_assert(detail::literal_impl::document<Fields>::size() == N, "length mismatch");
+    }
+
+    ///
+    /// Return a pointer to the BSON bytes.
+    ///
+    constexpr std::uint8_t const* data() const {
+        return _data;
+    }
+
+    ///
+    /// Return the length of the BSON bytes.
+    ///
+    static constexpr std::size_t size() {
+        return N;
+    }
+
+    /// @copydoc size()
+    static constexpr std::size_t length() {
+        return N;
+    }
+
+    ///
+    /// Return a view of the BSON bytes.
+    ///
+    constexpr v1::document::view view() const {
+        return v1::document::view{_data};
+    }
+
+    ///
+    /// Implicitly convert to `this->view()`.
+    ///
+    constexpr /* explicit(false) */ operator v1::document::view() const {
+        return this->view();
+    }
+};
+
+///
+/// Return a BSON element with the key `key` and the BSON type value `value` for use with @ref make_literal.
+///
+/// The BSON type of the value is determined by the type of `value`:
+///
+/// | Type of `value` | BSON Type |
+/// | --------------- | --------- |
+/// | `bool` | Boolean |
+/// | `std::nullptr_t` | Null |
+/// | A signed integer type no larger than 32 bits | 32-bit Integer |
+/// | A signed 64-bit integer type | 64-bit Integer |
+/// | A string literal | UTF-8 String |
+/// | @ref bsoncxx::v1::document::literal | Embedded Document |
+///
+/// @par Preconditions:
+/// - `key` and `value` (when a string literal) must not contain embedded null bytes.
+/// - `key` and `value` (when a string literal) must have static storage duration when used in a constant expression.
+///
+/// @note Floating-point values are not supported, as their binary representation cannot be portably obtained in a
+/// constant expression prior to C++20.
+///
+template <std::size_t K, typename T>
+constexpr auto literal_field(char const (&key)[K], T const& value)
+    -> detail::literal_impl::field<K, decltype(detail::literal_impl::to_value(value))> {
+    return {key, detail::literal_impl::to_value(value)};
+}
+
+///
+/// Return a BSON document containing the given BSON elements, in order.
+///
+/// @param fields Zero or more BSON elements obtained via @ref literal_field.
+///
+template <typename... Fields>
+constexpr literal<detail::literal_impl::document<detail::literal_impl::fields<Fields...>>::size()> make_literal(
+    Fields const&... fields) {
+    return literal<detail::literal_impl::document<detail::literal_impl::fields<Fields...>>::size()>{
+        detail::literal_impl::document<detail::literal_impl::fields<Fields...>>{
+            detail::literal_impl::make_fields(fields...)}};
+}
+
+} // namespace document
+} // namespace v1
+} // namespace bsoncxx
+
+#include <bsoncxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref bsoncxx::v1::document::literal.
+///
+/// @par Includes
+/// - @ref bsoncxx/v1/document/view.hpp
+///
@@ -0,0 +1,233 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <bsoncxx/v1/document/shared_value-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/detail/prelude.hpp>
+
+#include <bsoncxx/v1/config/export.hpp>
+#include <bsoncxx/v1/document/value.hpp> // IWYU pragma: export
+#include <bsoncxx/v1/document/view.hpp>  // IWYU pragma: export
+#include <bsoncxx/v1/element/view.hpp>   // IWYU pragma: export
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bsoncxx {
+namespace v1 {
+namespace document {
+
+///
+/// An immutable, reference-counted BSON document.
+///
+/// Copies share ownership of the same underlying BSON bytes: copy construction and copy assignment only update an
+/// atomic reference count. Views of the underlying BSON bytes remain valid as long as any owner exists.
+///
+/// A default-initialized shared value is equivalent to a default-initialized @ref bsoncxx::v1::document::view (an
+/// empty document) and does not allocate.
+///
+/// @par Thread Safety
+/// Distinct objects may be used concurrently by multiple threads even when they share ownership of the same BSON bytes.
+/// The underlying BSON bytes are never modified.
+///
+class shared_value {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    /// @copydoc v1::document::view::const_iterator
+    using const_iterator = v1::document::view::const_iterator;
+
+    /// @copydoc v1::document::view::iterator
+    using iterator = const_iterator;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// The underlying BSON bytes are freed when this is the last owner.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() ~shared_value();
+
+    ///
+    /// Move construction.
+    ///
+    /// @par Postconditions:
+    /// - `other` is equivalent to a default-initialized value.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() shared_value(shared_value&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is equivalent to a default-initialized value.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(shared_value&) operator=(shared_value&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    /// Shares ownership of the underlying BSON bytes without copying them.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL() shared_value(shared_value const& other) noexcept;
+
+    ///
+    /// Copy assignment.
+    ///
+    /// Shares ownership of the underlying BSON bytes without copying them.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(shared_value&) operator=(shared_value const& other) noexcept;
+
+    ///
+    /// Initialize as an empty document.
+    ///
+    /// @par Postconditions:
+    /// - `this->use_count() == 0`
+    ///
+    shared_value() noexcept : _impl{nullptr} {}
+
+    ///
+    /// Initialize with a copy of the BSON bytes referenced by `view`.
+    ///
+    /// The BSON bytes and the reference count are allocated together with a single allocation.
+    ///
+    /// If `view` is invalid or equivalent to a default-initialized @ref bsoncxx::v1::document::view, this value is
+    /// equivalent to a default-initialized value.
+    ///
+    explicit BSONCXX_ABI_EXPORT_CDECL() shared_value(v1::document::view view);
+
+    ///
+    /// Initialize by taking ownership of the BSON bytes owned by `value` without copying them.
+    ///
+    /// If `value` is invalid or equivalent to a default-initialized @ref bsoncxx::v1::document::value, this value is
+    /// equivalent to a default-initialized value.
+    ///
+    explicit BSONCXX_ABI_EXPORT_CDECL() shared_value(v1::document::value value);
+
+    ///
+    /// Return a @ref bsoncxx::v1::document::value which owns a copy of the underlying BSON bytes.
+    ///
+    /// The BSON bytes are copied so that the returned value may be modified without affecting any other owner of the
+    /// shared BSON bytes. Prefer @ref view when a copy is not required.
+    ///
+    /* explicit(false) */ BSONCXX_ABI_EXPORT_CDECL() operator v1::document::value() const;
+
+    ///
+    /// Return the number of owners of the underlying BSON bytes.
+    ///
+    /// Returns `0` when this value is equivalent to a default-initialized value.
+    ///
+    /// @note The result is only a snapshot when ownership is shared with other threads.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) use_count() const noexcept;
+
+    ///
+    /// Return a view of the BSON bytes as a document.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(v1::document::view) view() const noexcept;
+
+    ///
+    /// Implicitly convert to `this->view()`.
+    ///
+    /* explicit(false) */ operator v1::document::view() const {
+        return this->view();
+    }
+
+    /// @copydoc v1::document::view::cbegin() const
+    const_iterator cbegin() const {
+        return this->view().cbegin();
+    }
+
+    /// @copydoc v1::document::view::cend() const
+    const_iterator cend() const {
+        return this->view().cend();
+    }
+
+    /// @copydoc v1::document::view::begin() const
+    const_iterator begin() const {
+        return this->view().begin();
+    }
+
+    /// @copydoc v1::document::view::end() const
+    const_iterator end() const {
+        return this->view().end();
+    }
+
+    /// @copydoc v1::document::view::find(v1::stdx::string_view key) const
+    const_iterator find(v1::stdx::string_view key) const {
+        return this->view().find(key);
+    }
+
+    /// @copydoc v1::document::view::operator[](v1::stdx::string_view key) const
+    v1::element::view operator[](v1::stdx::string_view key) const {
+        return this->view()[key];
+    }
+
+    /// @copydoc v1::document::view::data() const
+    std::uint8_t const* data() const {
+        return this->view().data();
+    }
+
+    /// @copydoc v1::document::view::size() const
+    std::size_t size() const {
+        return this->view().size();
+    }
+
+    /// @copydoc v1::document::view::length() const
+    std::size_t length() const {
+        return this->view().length();
+    }
+
+    /// @copydoc v1::document::view::empty() const
+    bool empty() const {
+        return this->view().empty();
+    }
+
+    /// @copydoc v1::document::view::operator bool() const
+    explicit operator bool() const {
+        return this->view().operator bool();
+    }
+
+    /// @copydoc v1::document::view::operator==(v1::document::view lhs, v1::document::view rhs)
+    friend bool operator==(shared_value const& lhs, shared_value const& rhs) {
+        return lhs.view() == rhs.view();
+    }
+
+    /// @copydoc v1::document::view::operator!=(v1::document::view lhs, v1::document::view rhs)
+    friend bool operator!=(shared_value const& lhs, shared_value const& rhs) {
+        return !(lhs == rhs);
+    }
+};
+
+} // namespace document
+} // namespace v1
+} // namespace bsoncxx
+
+#include <bsoncxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref bsoncxx::v1::document::shared_value.
+///
+/// @par Includes
+/// - @ref bsoncxx/v1/document/value.hpp
+/// - @ref bsoncxx/v1/document/view.hpp
+/// - @ref bsoncxx/v1/element/view.hpp
+///
@@ -20,6 +20,8 @@
 
 #include <bsoncxx/v1/detail/prelude.hpp>
 
+#include <bsoncxx/v1/types/view-fwd.hpp>
+
 #include <bsoncxx/v1/config/export.hpp>
 #include <bsoncxx/v1/detail/type_traits.hpp>
 #include <bsoncxx/v1/document/view.hpp> // IWYU pragma: export
@@ -31,6 +33,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 
@@ -447,12 +450,96 @@ class value {
     friend bool operator!=(value const& lhs, value const& rhs) {
         return !(lhs == rhs);
     }
+
+    ///
+    /// Overwrite the BSON type value of the existing field at `path` in place.
+    ///
+    /// `path` is a sequence of keys separated by `.` (e.g. `"a.b.0"`) which may descend into embedded documents and
+    /// arrays.
+    ///
+    /// The existing and new BSON type values must both have a fixed size (double, OID, bool, date, int32, timestamp,
+    /// int64, or decimal128) of equal size. The BSON type of the field is updated to `v.type_id()`. The BSON bytes are
+    /// not reallocated and no other field is modified, unless the BSON bytes are not owned by this value (see below).
+    ///
+    /// @returns `false` when there is no field at `path`.
+    ///
+    /// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::value::errc::not_fixed_size if the existing
+    /// or new BSON type value does not have a fixed size.
+    /// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::value::errc::size_mismatch if the size of the
+    /// existing and new BSON type values are not equal.
+    /// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::view::errc::invalid_data if the BSON bytes
+    /// being traversed are invalid.
+    ///
+    /// When the deleter is @ref noop_deleter, the BSON bytes are not owned by this value (they may be read-only or
+    /// shared with another owner), so they are first copied into a new allocation using `operator new[]` (the deleter
+    /// is set to @ref default_deleter_type). Otherwise, the BSON bytes are assumed to be modifiable and exclusively
+    /// owned by this value.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(bool) patch(v1::stdx::string_view path, v1::types::view v);
+
+    ///
+    /// Replace the BSON type value of the existing field at `path` with `v`.
+    ///
+    /// `path` is interpreted as described by @ref patch.
+    ///
+    /// When the size of the new BSON type value is equal to the size of the existing BSON type value, the BSON bytes
+    /// are overwritten in place. Otherwise, the BSON bytes are reallocated using `operator new[]` (the deleter is set
+    /// to @ref default_deleter_type) with the length prefix of every enclosing document and array updated accordingly.
+    ///
+    /// @returns `false` when there is no field at `path`.
+    ///
+    /// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::value::errc::invalid_length if the length of
+    /// the resulting document would exceed `INT32_MAX`.
+    /// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::types::value::errc::invalid_type if `v.type_id()` is
+    /// not a supported value.
+    /// @exception bsoncxx::v1::exception with @ref bsoncxx::v1::document::view::errc::invalid_data if the BSON bytes
+    /// being traversed are invalid.
+    ///
+    /// BSON bytes which are not owned by this value are copied before being overwritten in place as described by @ref
+    /// patch.
+    ///
+    BSONCXX_ABI_EXPORT_CDECL(bool) splice(v1::stdx::string_view path, v1::types::view v);
+
+    ///
+    /// Errors codes which may be returned by @ref bsoncxx::v1::document::value.
+    ///
+    enum class errc {
+        zero,           ///< Zero.
+        not_fixed_size, ///< BSON type value does not have a fixed size.
+        size_mismatch,  ///< BSON type values do not have equal size.
+        invalid_length, ///< Length is too long (exceeds `INT32_MAX`).
+    };
+
+    ///
+    /// The error category for @ref bsoncxx::v1::document::value::errc.
+    ///
+    static BSONCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
 };
 
 } // namespace document
 } // namespace v1
 } // namespace bsoncxx
 
+template <>
+struct std::is_error_code_enum<bsoncxx::v1::document::value::errc> : true_type {};
+
+///
+/// Equivalent to `std::hash<bsoncxx::v1::document::view>` over `v.view()`.
+///
+template <>
+struct std::hash<bsoncxx::v1::document::value> {
+    std::size_t operator()(bsoncxx::v1::document::value const& v) const noexcept {
+        return std::hash<bsoncxx::v1::document::view>{}(v.view());
+    }
+};
+
 #include <bsoncxx/v1/detail/postlude.hpp>
 
 ///
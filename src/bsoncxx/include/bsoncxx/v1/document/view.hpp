@@ -28,6 +28,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <system_error>
 #include <type_traits>
@@ -84,7 +85,7 @@ class view {
     /// - If `data` is not null, the size of the storage region pointed to by `data` must be greater than or equal to 5.
     /// - The embedded length must be less than or equal to the size of the storage region pointed to by `data`.
     ///
-    explicit view(std::uint8_t const* data) : _data{data} {}
+    explicit constexpr view(std::uint8_t const* data) : _data{data} {}
 
     ///
     /// Equivalent to @ref view(std::uint8_t const* data), but validates the embedded length against `length`.
@@ -101,7 +102,7 @@ class view {
     ///
     /// Return a pointer to the BSON bytes being represented.
     ///
-    std::uint8_t const* data() const {
+    constexpr std::uint8_t const* data() const {
         return _data;
     }
 
@@ -383,6 +384,17 @@ inline v1::element::view view::operator[](v1::stdx::string_view key) const {
 template <>
 struct std::is_error_code_enum<bsoncxx::v1::document::view::errc> : true_type {};
 
+///
+/// Hash the BSON bytes represented by a @ref bsoncxx::v1::document::view.
+///
+/// Consistent with @ref bsoncxx::v1::document::view::operator==(v1::document::view lhs, v1::document::view rhs): all
+/// invalid views hash equal. The result is not stable across library versions.
+///
+template <>
+struct std::hash<bsoncxx::v1::document::view> {
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) operator()(bsoncxx::v1::document::view v) const noexcept;
+};
+
 #include <bsoncxx/v1/detail/postlude.hpp>
 
 ///
@@ -35,6 +35,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <system_error>
 #include <type_traits>
@@ -47,6 +48,9 @@ namespace types {
 ///
 /// A union of BSON type values.
 ///
+/// Small BSON type values (e.g. short strings, small binary data, or an empty document) are stored inline within this
+/// object without a dynamic allocation.
+///
 /// @note A "BSON type value" refers to the value of a BSON element without its key.
 ///
 class value {
@@ -80,16 +84,16 @@ class value {
     ///
     /// Copy construction.
     ///
-    /// The copied BSON type value is allocated (when necessary) using
-    /// [`bson_value_copy`](https://mongoc.org/libbson/current/bson_value_copy.html).
+    /// The copied BSON type value is stored inline when small enough, otherwise it is allocated (when necessary) using
+    /// [`bson_malloc`](https://mongoc.org/libbson/current/bson_malloc.html).
     ///
     BSONCXX_ABI_EXPORT_CDECL() value(value const& other);
 
     ///
     /// Copy assignment.
     ///
-    /// The copied value is allocated (when necessary) using
-    /// [`bson_value_copy`](https://mongoc.org/libbson/current/bson_value_copy.html).
+    /// The copied value is stored inline when small enough, otherwise it is allocated (when necessary) using
+    /// [`bson_malloc`](https://mongoc.org/libbson/current/bson_malloc.html).
     ///
     BSONCXX_ABI_EXPORT_CDECL(value&) operator=(value const& other);
 
@@ -321,6 +325,16 @@ class value {
 template <>
 struct std::is_error_code_enum<bsoncxx::v1::types::value::errc> : true_type {};
 
+///
+/// Equivalent to `std::hash<bsoncxx::v1::types::view>` over `v.view()`.
+///
+template <>
+struct std::hash<bsoncxx::v1::types::value> {
+    std::size_t operator()(bsoncxx::v1::types::value const& v) const noexcept {
+        return std::hash<bsoncxx::v1::types::view>{}(v.view());
+    }
+};
+
 #include <bsoncxx/v1/detail/postlude.hpp>
 
 ///
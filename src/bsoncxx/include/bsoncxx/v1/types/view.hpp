@@ -33,6 +33,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <system_error>
 #include <type_traits>
 
@@ -1171,6 +1172,19 @@ class view {
 template <>
 struct std::is_error_code_enum<bsoncxx::v1::types::view::errc> : true_type {};
 
+///
+/// Hash the BSON type value represented by a @ref bsoncxx::v1::types::view.
+///
+/// Consistent with @ref bsoncxx::v1::types::view::operator==(view const& lhs, view const& rhs) (e.g. `0.0` and `-0.0`
+/// hash equal). The result is not stable across library versions.
+///
+/// When `v.type_id()` returns an unsupported value, the result is unspecified.
+///
+template <>
+struct std::hash<bsoncxx::v1::types::view> {
+    BSONCXX_ABI_EXPORT_CDECL(std::size_t) operator()(bsoncxx::v1::types::view const& v) const noexcept;
+};
+
 #include <bsoncxx/v1/detail/postlude.hpp>
 
 ///
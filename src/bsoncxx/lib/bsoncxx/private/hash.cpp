@@ -0,0 +1,121 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/private/hash.hh>
+
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace bsoncxx {
+
+namespace {
+
+constexpr std::uint64_t k_p1 = 0x9E3779B185EBCA87u;
+constexpr std::uint64_t k_p2 = 0xC2B2AE3D27D4EB4Fu;
+constexpr std::uint64_t k_p3 = 0x165667B19E3779F9u;
+constexpr std::uint64_t k_p4 = 0x85EBCA77C2B2AE63u;
+constexpr std::uint64_t k_p5 = 0x27D4EB2F165667C5u;
+
+std::uint64_t rotl(std::uint64_t v, unsigned n) {
+    return (v << n) | (v >> (64u - n));
+}
+
+std::uint64_t read64(std::uint8_t const* p) {
+    std::uint64_t res;
+    std::memcpy(&res, p, sizeof(res));
+    return res;
+}
+
+std::uint32_t read32(std::uint8_t const* p) {
+    std::uint32_t res;
+    std::memcpy(&res, p, sizeof(res));
+    return res;
+}
+
+std::uint64_t xxh_round(std::uint64_t acc, std::uint64_t input) {
+    acc += input * k_p2;
+    acc = rotl(acc, 31u);
+    acc *= k_p1;
+    return acc;
+}
+
+std::uint64_t merge(std::uint64_t acc, std::uint64_t v) {
+    acc ^= xxh_round(0u, v);
+    return acc * k_p1 + k_p4;
+}
+
+} // namespace
+
+std::uint64_t hash_bytes(void const* data, std::size_t length, std::uint64_t seed) noexcept {
+    auto p = static_cast<std::uint8_t const*>(data);
+    auto const end = p + length;
+
+    std::uint64_t h;
+
+    if (length >= 32u) {
+        std::uint64_t v1 = seed + k_p1 + k_p2;
+        std::uint64_t v2 = seed + k_p2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - k_p1;
+
+        auto const limit = end - 32;
+
+        do {
+            v1 = xxh_round(v1, read64(p));
+            v2 = xxh_round(v2, read64(p + 8));
+            v3 = xxh_round(v3, read64(p + 16));
+            v4 = xxh_round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1u) + rotl(v2, 7u) + rotl(v3, 12u) + rotl(v4, 18u);
+        h = merge(h, v1);
+        h = merge(h, v2);
+        h = merge(h, v3);
+        h = merge(h, v4);
+    } else {
+        h = seed + k_p5;
+    }
+
+    h += static_cast<std::uint64_t>(length);
+
+    for (; end - p >= 8; p += 8) {
+        h ^= xxh_round(0u, read64(p));
+        h = rotl(h, 27u) * k_p1 + k_p4;
+    }
+
+    if (end - p >= 4) {
+        h ^= std::uint64_t{read32(p)} * k_p1;
+        h = rotl(h, 23u) * k_p2 + k_p3;
+        p += 4;
+    }
+
+    for (; p != end; ++p) {
+        h ^= std::uint64_t{*p} * k_p5;
+        h = rotl(h, 11u) * k_p1;
+    }
+
+    h ^= h >> 33u;
+    h *= k_p2;
+    h ^= h >> 29u;
+    h *= k_p3;
+    h ^= h >> 32u;
+
+    return h;
+}
+
+} // namespace bsoncxx
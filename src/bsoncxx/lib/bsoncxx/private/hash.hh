@@ -0,0 +1,48 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <bsoncxx/private/export.hh>
+
+namespace bsoncxx {
+
+// A fast non-cryptographic 64-bit hash of `length` bytes (XXH64).
+//
+// Input is consumed as four independent 64-bit lanes per 32-byte stripe so the main loop is free of loop-carried
+// dependencies between lanes and is amenable to instruction-level parallelism and auto-vectorization.
+//
+// The result is not stable across library versions or platforms of different endianness.
+BSONCXX_ABI_EXPORT_CDECL_TESTING(std::uint64_t)
+hash_bytes(void const* data, std::size_t length, std::uint64_t seed = 0u) noexcept;
+
+// Scramble the bits of `v` (the SplitMix64 finalizer).
+inline std::uint64_t hash_mix(std::uint64_t v) noexcept {
+    v ^= v >> 30u;
+    v *= 0xBF58476D1CE4E5B9u;
+    v ^= v >> 27u;
+    v *= 0x94D049BB133111EBu;
+    v ^= v >> 31u;
+    return v;
+}
+
+// Order-dependent combination of `seed` with the hash `v`.
+inline std::uint64_t hash_combine(std::uint64_t seed, std::uint64_t v) noexcept {
+    return hash_mix(seed + 0x9E3779B97F4A7C15u + v);
+}
+
+} // namespace bsoncxx
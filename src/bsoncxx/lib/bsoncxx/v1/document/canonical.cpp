@@ -0,0 +1,397 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/v1/document/canonical.hpp>
+
+//
+
+#include <bsoncxx/v1/decimal128.hpp>
+#include <bsoncxx/v1/detail/macros.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/hash.hh>
+
+namespace bsoncxx {
+namespace v1 {
+namespace document {
+
+namespace {
+
+// Distinguish the canonical hash of each category of BSON type value.
+constexpr std::uint64_t k_numeric_seed = 0x6E756D6572696300u;
+constexpr std::uint64_t k_decimal_seed = 0x646563696D616C00u;
+constexpr std::uint64_t k_document_seed = 0x646F63756D656E74u;
+constexpr std::uint64_t k_array_seed = 0x6172726179000000u;
+
+// Documents with at most this many fields are sorted with an insertion sort rather than `std::stable_sort`.
+constexpr std::size_t k_insertion_sort_limit = 16u;
+
+// Obtain `d` as an integer when it is an integral value representable as a 64-bit integer.
+bool double_to_int64(double d, std::int64_t& out) {
+    // [-2^63, 2^63). Also excludes NaN.
+    if (!(d >= -9223372036854775808.0 && d < 9223372036854775808.0)) {
+        return false;
+    }
+
+    auto const i = static_cast<std::int64_t>(d);
+
+    BSONCXX_PRIVATE_WARNINGS_PUSH();
+    BSONCXX_PRIVATE_WARNINGS_DISABLE(GNU("-Wfloat-equal"));
+    if (static_cast<double>(i) != d) {
+        return false;
+    }
+    BSONCXX_PRIVATE_WARNINGS_POP();
+
+    out = i;
+    return true;
+}
+
+// A decimal128 value with a unique representation for each numerically distinct value.
+//
+// - Finite values have no trailing zeros in their coefficient (1.0 and 1.00 are both 1E+0).
+// - Zero is always positive with an exponent of zero (0E-5 and -0 are both 0E+0).
+// - Non-canonical coefficients (greater than 10^34 - 1) are zero as specified by IEEE 754-2008.
+// - All NaNs are equivalent regardless of sign and payload.
+struct canonical_decimal128 {
+    enum class kind : std::uint8_t { finite, infinity, nan };
+
+    kind k = kind::finite;
+    bool negative = false;
+    std::int32_t exponent = 0;
+    std::uint64_t high = 0u; // The upper bits of the coefficient.
+    std::uint64_t low = 0u;  // The lower 64 bits of the coefficient.
+
+    friend bool operator==(canonical_decimal128 const& lhs, canonical_decimal128 const& rhs) {
+        return lhs.k == rhs.k && lhs.negative == rhs.negative && lhs.exponent == rhs.exponent &&
+               lhs.high == rhs.high && lhs.low == rhs.low;
+    }
+};
+
+// Divide the 128-bit unsigned integer `high:low` by 10 in place and return the remainder.
+std::uint32_t divide_by_10(std::uint64_t& high, std::uint64_t& low) {
+    std::uint32_t const limbs[] = {
+        static_cast<std::uint32_t>(high >> 32u),
+        static_cast<std::uint32_t>(high & 0xFFFFFFFFu),
+        static_cast<std::uint32_t>(low >> 32u),
+        static_cast<std::uint32_t>(low & 0xFFFFFFFFu),
+    };
+
+    std::uint32_t quotients[4] = {};
+    std::uint64_t rem = 0u;
+
+    for (std::size_t i = 0u; i < 4u; ++i) {
+        auto const cur = (rem << 32u) | limbs[i];
+        quotients[i] = static_cast<std::uint32_t>(cur / 10u);
+        rem = cur % 10u;
+    }
+
+    high = (std::uint64_t{quotients[0]} << 32u) | quotients[1];
+    low = (std::uint64_t{quotients[2]} << 32u) | quotients[3];
+
+    return static_cast<std::uint32_t>(rem);
+}
+
+canonical_decimal128 canonicalize(v1::decimal128 d) {
+    // 10^34 - 1, the largest canonical coefficient.
+    constexpr std::uint64_t k_max_high = 0x0001ED09BEAD87C0u;
+    constexpr std::uint64_t k_max_low = 0x378D8E63FFFFFFFFu;
+
+    constexpr std::int32_t k_exponent_bias = 6176;
+
+    canonical_decimal128 ret;
+
+    auto const high = d.high();
+
+    ret.negative = (high >> 63u) != 0u;
+
+    switch ((high >> 58u) & 0x1Fu) {
+        case 0x1Eu:
+            ret.k = canonical_decimal128::kind::infinity;
+            return ret;
+
+        case 0x1Fu:
+            ret.k = canonical_decimal128::kind::nan;
+            ret.negative = false;
+            return ret;
+
+        default:
+            break;
+    }
+
+    if (((high >> 61u) & 0x3u) == 0x3u) {
+        // The implied coefficient always exceeds 10^34 - 1: non-canonical.
+        ret.negative = false;
+        return ret;
+    }
+
+    ret.exponent = static_cast<std::int32_t>((high >> 49u) & 0x3FFFu) - k_exponent_bias;
+    ret.high = high & 0x0001FFFFFFFFFFFFu;
+    ret.low = d.low();
+
+    if (ret.high > k_max_high || (ret.high == k_max_high && ret.low > k_max_low) || (ret.high == 0u && ret.low == 0u)) {
+        // Non-canonical coefficient or zero.
+        ret.negative = false;
+        ret.exponent = 0;
+        ret.high = 0u;
+        ret.low = 0u;
+        return ret;
+    }
+
+    for (;;) {
+        auto high_q = ret.high;
+        auto low_q = ret.low;
+
+        if (divide_by_10(high_q, low_q) != 0u) {
+            break;
+        }
+
+        ret.high = high_q;
+        ret.low = low_q;
+        ++ret.exponent;
+    }
+
+    return ret;
+}
+
+// Obtain `d` as an integer when it is an integral value representable as a 64-bit integer.
+bool decimal128_to_int64(canonical_decimal128 const& d, std::int64_t& out) {
+    if (d.k != canonical_decimal128::kind::finite || d.exponent < 0 || d.high != 0u) {
+        return false;
+    }
+
+    // The magnitude must be within [0, 2^63] (2^63 only when negative).
+    constexpr std::uint64_t k_limit = std::uint64_t{1u} << 63u;
+
+    auto magnitude = d.low;
+
+    for (std::int32_t i = 0; i < d.exponent; ++i) {
+        if (magnitude > k_limit / 10u) {
+            return false;
+        }
+
+        magnitude *= 10u;
+    }
+
+    if (magnitude > k_limit || (magnitude == k_limit && !d.negative)) {
+        return false;
+    }
+
+    out = d.negative ? static_cast<std::int64_t>(0u - magnitude) : static_cast<std::int64_t>(magnitude);
+
+    return true;
+}
+
+bool is_integer(v1::types::view v, std::int64_t& out) {
+    switch (v.type_id()) {
+        case v1::types::id::k_int32:
+            out = v.get_int32().value;
+            return true;
+
+        case v1::types::id::k_int64:
+            out = v.get_int64().value;
+            return true;
+
+        case v1::types::id::k_double:
+            return double_to_int64(v.get_double().value, out);
+
+        case v1::types::id::k_decimal128:
+            return decimal128_to_int64(canonicalize(v.get_decimal128().value), out);
+
+        default:
+            return false;
+    }
+}
+
+std::uint64_t hash_value(v1::types::view v);
+
+std::uint64_t hash_document(v1::document::view doc) {
+    if (!doc) {
+        return 0u;
+    }
+
+    std::uint64_t count = 0u;
+    std::uint64_t sum = 0u;
+
+    // Commutative combination of field hashes to ignore field order.
+    for (auto const& e : doc) {
+        auto const key = e.key();
+        sum += hash_mix(hash_combine(hash_bytes(key.data(), key.size()), hash_value(e.type_view())));
+        ++count;
+    }
+
+    return hash_combine(hash_combine(k_document_seed, count), sum);
+}
+
+std::uint64_t hash_array(v1::document::view arr) {
+    if (!arr) {
+        return 0u;
+    }
+
+    std::uint64_t res = k_array_seed;
+
+    for (auto const& e : arr) {
+        res = hash_combine(res, hash_value(e.type_view()));
+    }
+
+    return res;
+}
+
+std::uint64_t hash_value(v1::types::view v) {
+    std::int64_t i = 0;
+
+    if (is_integer(v, i)) {
+        return hash_combine(k_numeric_seed, static_cast<std::uint64_t>(i));
+    }
+
+    switch (v.type_id()) {
+        case v1::types::id::k_decimal128: {
+            auto const d = canonicalize(v.get_decimal128().value);
+
+            auto res = hash_combine(k_decimal_seed, static_cast<std::uint64_t>(d.k));
+            res = hash_combine(res, d.negative ? 1u : 0u);
+            res = hash_combine(res, static_cast<std::uint64_t>(static_cast<std::int64_t>(d.exponent)));
+            res = hash_combine(res, d.high);
+            return hash_combine(res, d.low);
+        }
+
+        case v1::types::id::k_document:
+            return hash_document(v.get_document().value);
+
+        case v1::types::id::k_array:
+            return hash_array(v1::document::view{v.get_array().value.data()});
+
+        default:
+            break;
+    }
+
+    return std::hash<v1::types::view>{}(v);
+}
+
+bool equal_value(v1::types::view lhs, v1::types::view rhs);
+
+bool equal_fields(v1::element::view const& lhs, v1::element::view const& rhs) {
+    return lhs.key() == rhs.key() && equal_value(lhs.type_view(), rhs.type_view());
+}
+
+bool key_less(v1::element::view const& lhs, v1::element::view const& rhs) {
+    return lhs.key() < rhs.key();
+}
+
+// Sort fields by key. Fields with equal keys retain their relative order.
+void stable_sort_by_key(std::vector<v1::element::view>& fields) {
+    if (fields.size() > k_insertion_sort_limit) {
+        std::stable_sort(fields.begin(), fields.end(), key_less);
+        return;
+    }
+
+    for (std::size_t i = 1u; i < fields.size(); ++i) {
+        for (std::size_t j = i; j > 0u && key_less(fields[j], fields[j - 1u]); --j) {
+            std::swap(fields[j], fields[j - 1u]);
+        }
+    }
+}
+
+bool equal_document(v1::document::view lhs, v1::document::view rhs) {
+    if (!lhs || !rhs) {
+        return !lhs == !rhs;
+    }
+
+    if (lhs == rhs) {
+        return true; // Fast path: identical BSON bytes.
+    }
+
+    std::vector<v1::element::view> lfields(lhs.begin(), lhs.end());
+    std::vector<v1::element::view> rfields(rhs.begin(), rhs.end());
+
+    if (lfields.size() != rfields.size()) {
+        return false;
+    }
+
+    stable_sort_by_key(lfields);
+    stable_sort_by_key(rfields);
+
+    return std::equal(lfields.begin(), lfields.end(), rfields.begin(), equal_fields);
+}
+
+bool equal_array(v1::document::view lhs, v1::document::view rhs) {
+    if (!lhs || !rhs) {
+        return !lhs == !rhs;
+    }
+
+    auto liter = lhs.begin();
+    auto riter = rhs.begin();
+
+    for (; liter != lhs.end() && riter != rhs.end(); ++liter, ++riter) {
+        if (!equal_value(liter->type_view(), riter->type_view())) {
+            return false;
+        }
+    }
+
+    return liter == lhs.end() && riter == rhs.end();
+}
+
+bool equal_value(v1::types::view lhs, v1::types::view rhs) {
+    std::int64_t li = 0;
+    std::int64_t ri = 0;
+
+    bool const lint = is_integer(lhs, li);
+    bool const rint = is_integer(rhs, ri);
+
+    if (lint || rint) {
+        return lint && rint && li == ri;
+    }
+
+    if (lhs.type_id() != rhs.type_id()) {
+        return false;
+    }
+
+    switch (lhs.type_id()) {
+        case v1::types::id::k_decimal128:
+            return canonicalize(lhs.get_decimal128().value) == canonicalize(rhs.get_decimal128().value);
+
+        case v1::types::id::k_document:
+            return equal_document(lhs.get_document().value, rhs.get_document().value);
+
+        case v1::types::id::k_array:
+            return equal_array(
+                v1::document::view{lhs.get_array().value.data()}, v1::document::view{rhs.get_array().value.data()});
+
+        default:
+            return lhs == rhs;
+    }
+}
+
+} // namespace
+
+std::size_t canonical_hash::operator()(v1::document::view v) const {
+    return static_cast<std::size_t>(hash_document(v));
+}
+
+bool canonical_equal_to::operator()(v1::document::view lhs, v1::document::view rhs) const {
+    return equal_document(lhs, rhs);
+}
+
+} // namespace document
+} // namespace v1
+} // namespace bsoncxx
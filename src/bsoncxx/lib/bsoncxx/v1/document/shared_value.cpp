@@ -0,0 +1,164 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include <bsoncxx/private/type_traits.hh>
+
+namespace bsoncxx {
+namespace v1 {
+namespace document {
+
+static_assert(is_regular<shared_value>::value, "bsoncxx::v1::document::shared_value must be regular");
+static_assert(
+    is_nothrow_moveable<shared_value>::value,
+    "bsoncxx::v1::document::shared_value must be nothrow moveable");
+
+// The reference count, the owner of the BSON bytes (if any), and (when copied from a view) the BSON bytes themselves
+// are allocated together as a single allocation.
+class shared_value::impl {
+   public:
+    std::atomic<std::size_t> _count{1u};
+    v1::document::value _owner; // Only when constructed from a `v1::document::value`.
+    std::uint8_t const* _data = nullptr;
+
+    // Copy the BSON bytes into trailing storage.
+    static impl* make(v1::document::view v) {
+        auto const size = v.size();
+        auto const mem = static_cast<unsigned char*>(::operator new(sizeof(impl) + size));
+        auto const ret = new (mem) impl{};
+        auto const data = mem + sizeof(impl);
+        std::memcpy(data, v.data(), size);
+        ret->_data = data;
+        return ret;
+    }
+
+    // Take ownership of the BSON bytes.
+    static impl* make(v1::document::value v) {
+        auto const ret = new (::operator new(sizeof(impl))) impl{};
+        ret->_data = v.data();
+        ret->_owner = std::move(v);
+        return ret;
+    }
+
+    static void retain(void* ptr) noexcept {
+        if (auto const p = static_cast<impl*>(ptr)) {
+            p->_count.fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+
+    static void release(void* ptr) noexcept {
+        if (auto const p = static_cast<impl*>(ptr)) {
+            if (p->_count.fetch_sub(1u, std::memory_order_acq_rel) == 1u) {
+                p->~impl();
+                ::operator delete(p);
+            }
+        }
+    }
+
+    static impl const* with(shared_value const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+};
+
+namespace {
+
+bool is_default(v1::document::view v) {
+    return !v || v.data() == v1::document::view{}.data();
+}
+
+} // namespace
+
+shared_value::~shared_value() {
+    impl::release(_impl);
+}
+
+shared_value::shared_value(shared_value&& other) noexcept : _impl{other._impl} {
+    other._impl = nullptr;
+}
+
+shared_value& shared_value::operator=(shared_value&& other) noexcept {
+    if (this != &other) {
+        impl::release(_impl);
+        _impl = other._impl;
+        other._impl = nullptr;
+    }
+
+    return *this;
+}
+
+shared_value::shared_value(shared_value const& other) noexcept : _impl{other._impl} {
+    impl::retain(_impl);
+}
+
+shared_value& shared_value::operator=(shared_value const& other) noexcept {
+    impl::retain(other._impl); // Handles self-assignment.
+    impl::release(_impl);
+    _impl = other._impl;
+
+    return *this;
+}
+
+shared_value::shared_value(v1::document::view view) : shared_value{} {
+    if (!is_default(view)) {
+        _impl = impl::make(view);
+    }
+}
+
+shared_value::shared_value(v1::document::value value) : shared_value{} {
+    if (!is_default(value.view())) {
+        _impl = impl::make(std::move(value));
+    }
+}
+
+shared_value::operator v1::document::value() const {
+    if (!_impl) {
+        return {};
+    }
+
+    // The returned value may modify its BSON bytes (e.g. via `patch()`), so it must not alias the shared BSON bytes.
+    return v1::document::value{this->view()};
+}
+
+std::size_t shared_value::use_count() const noexcept {
+    if (auto const p = impl::with(this)) {
+        return p->_count.load(std::memory_order_relaxed);
+    }
+
+    return 0u;
+}
+
+v1::document::view shared_value::view() const noexcept {
+    if (auto const p = impl::with(this)) {
+        return v1::document::view{p->_data};
+    }
+
+    return {};
+}
+
+} // namespace document
+} // namespace v1
+} // namespace bsoncxx
@@ -16,19 +16,399 @@
 
 //
 
+#include <bsoncxx/v1/decimal128.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/exception.hpp>
+#include <bsoncxx/v1/oid.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/value.hh>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <chrono>
+#include <climits>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
 
+#include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/immortal.hh>
 #include <bsoncxx/private/type_traits.hh>
 
 namespace bsoncxx {
 namespace v1 {
 namespace document {
 
+using code = v1::document::value::errc;
+
 static_assert(is_regular<value>::value, "bsoncxx::v1::document::value must be regular");
 static_assert(is_nothrow_moveable<value>::value, "bsoncxx::v1::document::value must be nothrow moveable");
 
 void value::noop_deleter(std::uint8_t*) { /* noop */ }
 
+namespace {
+
+// The location of a field relative to the start of the root document.
+struct field_location {
+    std::vector<std::size_t> parents; // The length prefix of every enclosing document (root first).
+    std::size_t type_offset;
+    std::size_t value_offset;
+    std::size_t value_size;
+};
+
+v1::stdx::optional<field_location> locate(v1::document::view doc, v1::stdx::string_view path) {
+    if (!doc) {
+        return {};
+    }
+
+    // Support null as equivalent to empty.
+    if (!path.data()) {
+        path = "";
+    }
+
+    field_location ret = {};
+    std::size_t doc_offset = 0u;
+
+    for (;;) {
+        auto const dot = path.find('.');
+        auto const key = path.substr(0u, dot);
+
+        if (key.size() >= std::size_t{INT_MAX}) {
+            return {};
+        }
+
+        ret.parents.push_back(doc_offset);
+
+        auto const doc_data = doc.data() + doc_offset;
+        bson_iter_t iter;
+
+        if (!bson_iter_init_from_data(&iter, doc_data, v1::document::view{doc_data}.size())) {
+            throw v1::exception{v1::document::view::errc::invalid_data};
+        }
+
+        if (!bson_iter_find_w_len(&iter, key.data(), static_cast<int>(key.size()))) {
+            if (iter.err_off != 0) {
+                throw v1::exception{v1::document::view::errc::invalid_data};
+            }
+
+            return {};
+        }
+
+        auto const element_offset = doc_offset + bson_iter_offset(&iter);
+        auto const value_offset = element_offset + 1u + bson_iter_key_len(&iter) + 1u; // Type, key, and null.
+
+        if (dot == v1::stdx::string_view::npos) {
+            ret.type_offset = element_offset;
+            ret.value_offset = value_offset;
+            ret.value_size = doc_offset + iter.next_off - value_offset;
+            return ret;
+        }
+
+        switch (bson_iter_type(&iter)) {
+            case BSON_TYPE_DOCUMENT:
+            case BSON_TYPE_ARRAY:
+                break;
+
+            default:
+                return {}; // Cannot descend into a non-document.
+        }
+
+        doc_offset = value_offset;
+        path = path.substr(dot + 1u);
+    }
+}
+
+// Return 0 when `t` does not have a fixed size.
+std::size_t fixed_size(std::uint8_t t) {
+    switch (static_cast<bson_type_t>(t)) {
+        case BSON_TYPE_BOOL:
+            return 1u;
+
+        case BSON_TYPE_INT32:
+            return 4u;
+
+        case BSON_TYPE_DOUBLE:
+        case BSON_TYPE_DATE_TIME:
+        case BSON_TYPE_TIMESTAMP:
+        case BSON_TYPE_INT64:
+            return 8u;
+
+        case BSON_TYPE_OID:
+            return 12u;
+
+        case BSON_TYPE_DECIMAL128:
+            return 16u;
+
+        // BSONCXX_V1_TYPES_XMACRO: update above.
+
+        default:
+            return 0u;
+    }
+}
+
+// The type byte and value bytes of an encoded BSON element.
+struct encoded_value {
+    std::uint8_t type;
+    std::vector<std::uint8_t> bytes;
+};
+
+encoded_value encode(v1::types::view v) {
+    v1::types::value const owner{v}; // May throw.
+
+    bson_t bson = BSON_INITIALIZER;
+
+    if (!bson_append_value(&bson, "", 0, &v1::types::value::internal::get_bson_value(owner))) {
+        bson_destroy(&bson);
+        throw v1::exception{code::invalid_length};
+    }
+
+    auto const data = bson_get_data(&bson);
+
+    // {length: 4, type: 1, key: 1 (empty), value: N, terminator: 1}
+    encoded_value ret{data[4], {data + 6, data + bson.len - 1u}};
+
+    bson_destroy(&bson);
+
+    return ret;
+}
+
+void write_u32_le(std::uint8_t* dst, std::uint32_t u) {
+    dst[0] = static_cast<std::uint8_t>(u & 0xFFu);
+    dst[1] = static_cast<std::uint8_t>((u >> 8u) & 0xFFu);
+    dst[2] = static_cast<std::uint8_t>((u >> 16u) & 0xFFu);
+    dst[3] = static_cast<std::uint8_t>((u >> 24u) & 0xFFu);
+}
+
+void write_u64_le(std::uint8_t* dst, std::uint64_t u) {
+    write_u32_le(dst, static_cast<std::uint32_t>(u & 0xFFFFFFFFu));
+    write_u32_le(dst + 4, static_cast<std::uint32_t>(u >> 32u));
+}
+
+void write_i32_le(std::uint8_t* dst, std::int32_t v) {
+    write_u32_le(dst, static_cast<std::uint32_t>(v));
+}
+
+// Write the value bytes of the fixed-size BSON type value `v` directly into `dst`.
+void encode_fixed(std::uint8_t* dst, v1::types::view v) {
+    switch (v.type_id()) {
+        case v1::types::id::k_double: {
+            std::uint64_t u;
+            auto const d = v.get_double().value;
+            std::memcpy(&u, &d, sizeof(u));
+            write_u64_le(dst, u);
+        } break;
+
+        case v1::types::id::k_oid:
+            std::memcpy(dst, v.get_oid().value.bytes(), v1::oid::k_oid_length);
+            break;
+
+        case v1::types::id::k_bool:
+            dst[0] = v.get_bool().value ? 1u : 0u;
+            break;
+
+        case v1::types::id::k_date:
+            write_u64_le(dst, static_cast<std::uint64_t>(v.get_date().value.count()));
+            break;
+
+        case v1::types::id::k_int32:
+            write_i32_le(dst, v.get_int32().value);
+            break;
+
+        case v1::types::id::k_timestamp: {
+            auto const t = v.get_timestamp();
+            write_u32_le(dst, t.increment);
+            write_u32_le(dst + 4, t.timestamp);
+        } break;
+
+        case v1::types::id::k_int64:
+            write_u64_le(dst, static_cast<std::uint64_t>(v.get_int64().value));
+            break;
+
+        case v1::types::id::k_decimal128: {
+            auto const d = v.get_decimal128().value;
+            write_u64_le(dst, d.low());
+            write_u64_le(dst + 8, d.high());
+        } break;
+
+        // BSONCXX_V1_TYPES_XMACRO: update above.
+
+        default:
+            throw v1::exception{code::not_fixed_size};
+    }
+}
+
+// The deleter of a value whose BSON bytes are not owned (e.g. read-only or shared with another owner).
+bool is_unowned(v1::document::value const& v) {
+    return v.get_deleter().target<v1::document::value::noop_deleter_type>() != nullptr;
+}
+
+std::int32_t read_i32_le(std::uint8_t const* src) {
+    auto const u = static_cast<std::uint32_t>(src[0]) | (static_cast<std::uint32_t>(src[1]) << 8u) |
+                   (static_cast<std::uint32_t>(src[2]) << 16u) | (static_cast<std::uint32_t>(src[3]) << 24u);
+
+    return static_cast<std::int32_t>(u);
+}
+
+void overwrite(std::uint8_t* data, field_location const& loc, encoded_value const& ev) {
+    data[loc.type_offset] = ev.type;
+    std::memcpy(data + loc.value_offset, ev.bytes.data(), ev.bytes.size());
+}
+
+} // namespace
+
+bool value::patch(v1::stdx::string_view path, v1::types::view v) {
+    auto const loc_opt = locate(this->view(), path);
+
+    if (!loc_opt) {
+        return false;
+    }
+
+    auto const& loc = *loc_opt;
+
+    auto const old_size = fixed_size(this->data()[loc.type_offset]);
+    auto const new_size = fixed_size(static_cast<std::uint8_t>(v.type_id()));
+
+    if (old_size == 0u || new_size == 0u) {
+        throw v1::exception{code::not_fixed_size};
+    }
+
+    if (old_size != new_size) {
+        throw v1::exception{code::size_mismatch};
+    }
+
+    if (is_unowned(*this)) {
+        *this = value{this->view()};
+    }
+
+    auto const data = _data.get();
+
+    data[loc.type_offset] = static_cast<std::uint8_t>(v.type_id());
+    encode_fixed(data + loc.value_offset, v);
+
+    return true;
+}
+
+bool value::splice(v1::stdx::string_view path, v1::types::view v) {
+    auto const loc_opt = locate(this->view(), path);
+
+    if (!loc_opt) {
+        return false;
+    }
+
+    auto const& loc = *loc_opt;
+    auto const ev = encode(v);
+
+    if (ev.bytes.size() == loc.value_size) {
+        if (is_unowned(*this)) {
+            *this = value{this->view()};
+        }
+
+        overwrite(_data.get(), loc, ev);
+        return true;
+    }
+
+    auto const old_length = this->size();
+
+    // Both lengths are within [0, INT32_MAX], so their difference is representable as a `long long`.
+    auto const delta = static_cast<long long>(ev.bytes.size()) - static_cast<long long>(loc.value_size);
+    auto const new_length = static_cast<long long>(old_length) + delta;
+
+    if (new_length > INT32_MAX) {
+        throw v1::exception{code::invalid_length};
+    }
+
+    auto const old_data = _data.get();
+    auto const tail_offset = loc.value_offset + loc.value_size;
+
+    unique_ptr_type res{new std::uint8_t[static_cast<std::size_t>(new_length)], default_deleter_type{}};
+    auto const new_data = res.get();
+
+    std::memcpy(new_data, old_data, loc.value_offset);
+    std::memcpy(new_data + loc.value_offset, ev.bytes.data(), ev.bytes.size());
+    std::memcpy(new_data + loc.value_offset + ev.bytes.size(), old_data + tail_offset, old_length - tail_offset);
+
+    new_data[loc.type_offset] = ev.type;
+
+    // All enclosing documents precede the modified value, so their offsets are unchanged.
+    for (auto const offset : loc.parents) {
+        auto const length = static_cast<long long>(read_i32_le(new_data + offset)) + delta;
+        write_i32_le(new_data + offset, static_cast<std::int32_t>(length));
+    }
+
+    _data = std::move(res);
+
+    return true;
+}
+
+std::error_category const& value::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "bsoncxx::v1::document::value";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::not_fixed_size:
+                    return "BSON type value does not have a fixed size";
+                case code::size_mismatch:
+                    return "BSON type values do not have equal size";
+                case code::invalid_length:
+                    return "length is too long (exceeds INT32_MAX)";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::not_fixed_size:
+                    case code::size_mismatch:
+                    case code::invalid_length:
+                        return source == condition::bsoncxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::not_fixed_size:
+                    case code::size_mismatch:
+                    case code::invalid_length:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
 } // namespace document
 } // namespace v1
 } // namespace bsoncxx
@@ -29,6 +29,7 @@
 #include <system_error>
 
 #include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/hash.hh>
 #include <bsoncxx/private/immortal.hh>
 #include <bsoncxx/private/type_traits.hh>
 
@@ -223,3 +224,11 @@ view::const_iterator view::const_iterator::internal::make_const_iterator(
 } // namespace document
 } // namespace v1
 } // namespace bsoncxx
+
+std::size_t std::hash<bsoncxx::v1::document::view>::operator()(bsoncxx::v1::document::view v) const noexcept {
+    if (!v) {
+        return 0u;
+    }
+
+    return static_cast<std::size_t>(bsoncxx::hash_bytes(v.data(), v.size()));
+}
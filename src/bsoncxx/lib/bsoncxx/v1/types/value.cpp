@@ -66,29 +66,26 @@ class alignas(BSONCXX_PRIVATE_MAX_ALIGN_T) value::impl {
 
     ~impl();
 
-    impl(impl&& other) noexcept
-        : _value{other._value} // Ownership transfer.
-    {
-        other._value = {BSON_TYPE_NULL, {}, {}};
+    impl(impl&& other) noexcept {
+        this->take(other);
     }
 
     impl& operator=(impl&& other) noexcept {
         if (&other != this) {
-            bson_value_destroy(&_value);
-            _value = other._value; // Ownership transfer.
-            other._value = {BSON_TYPE_NULL, {}, {}};
+            this->destroy();
+            this->take(other);
         }
         return *this;
     }
 
     impl(impl const& other) {
-        bson_value_copy(&other._value, &_value);
+        this->copy_from(other._value);
     }
 
     impl& operator=(impl const& other) {
         if (&other != this) {
-            bson_value_destroy(&_value);
-            bson_value_copy(&other._value, &_value);
+            this->destroy();
+            this->copy_from(other._value);
         }
         return *this;
     }
@@ -111,6 +108,187 @@ class alignas(BSONCXX_PRIVATE_MAX_ALIGN_T) value::impl {
         return _value.value;
     }
 
+    // Small BSON type values are stored inline within the trailing bytes of `_value` which are not used by the active
+    // union member (e.g. `_value.value.v_utf8` leaves 12 bytes unused given `sizeof(void*) == 8`). This avoids a heap
+    // allocation for short strings, small binary data, and small documents (e.g. `{}`).
+    //
+    // Only BSON types with a single owned buffer support inline storage.
+    std::size_t inline_offset() const {
+        switch (_value.value_type) {
+            case BSON_TYPE_UTF8:
+                return this->offset_after(_value.value.v_utf8.len);
+            case BSON_TYPE_DOCUMENT:
+            case BSON_TYPE_ARRAY:
+                return this->offset_after(_value.value.v_doc.data_len);
+            case BSON_TYPE_BINARY:
+                return this->offset_after(_value.value.v_binary.subtype);
+            case BSON_TYPE_CODE:
+                return this->offset_after(_value.value.v_code.code_len);
+            case BSON_TYPE_SYMBOL:
+                return this->offset_after(_value.value.v_symbol.len);
+
+            // BSONCXX_V1_TYPES_XMACRO: update above.
+
+            default:
+                return sizeof(_value);
+        }
+    }
+
+    std::size_t inline_capacity() const {
+        return sizeof(_value) - this->inline_offset();
+    }
+
+    unsigned char const* inline_data() const {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<unsigned char const*>(&_value) + this->inline_offset();
+    }
+
+    unsigned char* inline_data() {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<unsigned char*>(&_value) + this->inline_offset();
+    }
+
+    void const* owned_data() const {
+        switch (_value.value_type) {
+            case BSON_TYPE_UTF8:
+                return _value.value.v_utf8.str;
+            case BSON_TYPE_DOCUMENT:
+            case BSON_TYPE_ARRAY:
+                return _value.value.v_doc.data;
+            case BSON_TYPE_BINARY:
+                return _value.value.v_binary.data;
+            case BSON_TYPE_CODE:
+                return _value.value.v_code.code;
+            case BSON_TYPE_SYMBOL:
+                return _value.value.v_symbol.symbol;
+
+            // BSONCXX_V1_TYPES_XMACRO: update above.
+
+            default:
+                return nullptr;
+        }
+    }
+
+    bool is_inline() const {
+        return this->inline_capacity() > 0u && this->owned_data() == this->inline_data();
+    }
+
+    // Return storage for `size` bytes for the current BSON type: inline when it fits, otherwise `bson_malloc`.
+    // Requires `_value.value_type` to already be set.
+    void* allocate(std::size_t size) {
+        if (size == 0u) {
+            return nullptr; // Consistent with `bson_malloc(0)`.
+        }
+
+        if (size <= this->inline_capacity()) {
+            return this->inline_data();
+        }
+
+        return bson_malloc(size);
+    }
+
+    // Always null-terminated, consistent with `bson_value_copy()`.
+    char* copy_string(char const* str, std::size_t len) {
+        auto const ret = static_cast<char*>(this->allocate(len + 1u));
+        if (len > 0u) {
+            std::memcpy(ret, str, len);
+        }
+        ret[len] = '\0';
+        return ret;
+    }
+
+    std::uint8_t* copy_bytes(void const* data, std::size_t size) {
+        if (!data) {
+            return nullptr;
+        }
+
+        auto const ret = static_cast<std::uint8_t*>(this->allocate(size));
+        if (ret) {
+            std::memcpy(ret, data, size);
+        }
+        return ret;
+    }
+
+    // Equivalent to `bson_value_copy(&src, &_value)`, but small BSON type values are stored inline.
+    void copy_from(bson_value_t const& src) {
+        switch (src.value_type) {
+            case BSON_TYPE_UTF8: {
+                _value.value_type = src.value_type;
+                _value.value.v_utf8.len = src.value.v_utf8.len;
+                _value.value.v_utf8.str = this->copy_string(src.value.v_utf8.str, src.value.v_utf8.len);
+            } break;
+
+            case BSON_TYPE_DOCUMENT:
+            case BSON_TYPE_ARRAY: {
+                _value.value_type = src.value_type;
+                _value.value.v_doc.data_len = src.value.v_doc.data_len;
+                _value.value.v_doc.data = this->copy_bytes(src.value.v_doc.data, src.value.v_doc.data_len);
+            } break;
+
+            case BSON_TYPE_BINARY: {
+                _value.value_type = src.value_type;
+                _value.value.v_binary.subtype = src.value.v_binary.subtype;
+                _value.value.v_binary.data_len = src.value.v_binary.data_len;
+                _value.value.v_binary.data = this->copy_bytes(src.value.v_binary.data, src.value.v_binary.data_len);
+            } break;
+
+            case BSON_TYPE_CODE: {
+                _value.value_type = src.value_type;
+                _value.value.v_code.code_len = src.value.v_code.code_len;
+                _value.value.v_code.code = this->copy_string(src.value.v_code.code, src.value.v_code.code_len);
+            } break;
+
+            case BSON_TYPE_SYMBOL: {
+                _value.value_type = src.value_type;
+                _value.value.v_symbol.len = src.value.v_symbol.len;
+                _value.value.v_symbol.symbol = this->copy_string(src.value.v_symbol.symbol, src.value.v_symbol.len);
+            } break;
+
+            // BSONCXX_V1_TYPES_XMACRO: update above.
+
+            default:
+                bson_value_copy(&src, &_value);
+        }
+    }
+
+    // Inline data must be copied (without allocation) to remain owned by this object.
+    void take(impl& other) noexcept {
+        if (other.is_inline()) {
+            this->copy_from(other._value);
+        } else {
+            _value = other._value; // Ownership transfer.
+        }
+
+        other._value = {BSON_TYPE_NULL, {}, {}};
+    }
+
+    // For backward compatibility, do not prematurely truncate strings in bsoncxx API. Instead, defer handling of
+    // potential embedded null bytes to the bson library.
+    char* to_bson_copy(v1::stdx::string_view sv) {
+        if (sv.empty()) {
+            return nullptr;
+        }
+
+        return this->copy_string(sv.data(), sv.size());
+    }
+
+    std::uint8_t* to_bson_copy(void const* data, std::size_t size) {
+        return this->copy_bytes(data, size);
+    }
+
+    void destroy() noexcept {
+        if (!this->is_inline()) {
+            bson_value_destroy(&_value);
+        }
+    }
+
+    template <typename T>
+    std::size_t offset_after(T const& member) const {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return static_cast<std::size_t>(
+            reinterpret_cast<unsigned char const*>(&member + 1) - reinterpret_cast<unsigned char const*>(&_value));
+    }
+
     // Helpers to access the inline PIMPL object.
     // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
     static impl const& with(value const& self) {
@@ -138,7 +316,7 @@ value::impl::~impl() {
     static_assert(sizeof(value::_storage) >= sizeof(value::impl), "insufficient size");
     static_assert(alignof(value) >= alignof(value::impl), "insufficient alignment");
 
-    bson_value_destroy(&_value);
+    this->destroy();
 }
 
 value::~value() {
@@ -168,33 +346,6 @@ value& value::operator=(value const& other) {
     return *this;
 }
 
-namespace {
-
-// For backward compatibility, do not prematurely truncate strings in bsoncxx API. Instead, defer handling of potential
-// embedded null bytes to the bson library.
-char* to_bson_copy(v1::stdx::string_view sv) {
-    if (sv.empty()) {
-        return nullptr;
-    }
-
-    auto ret = static_cast<char*>(bson_malloc(sv.size() + 1u));
-    std::memcpy(ret, sv.data(), sv.size());
-    ret[sv.size()] = '\0';
-    return ret;
-}
-
-std::uint8_t* to_bson_copy(void const* data, std::size_t size) {
-    if (!data) {
-        return nullptr;
-    }
-
-    auto ret = static_cast<std::uint8_t*>(bson_malloc(size));
-    std::memcpy(ret, data, size);
-    return ret;
-}
-
-} // namespace
-
 value::value(v1::types::view const& v) : value{} {
 #pragma push_macro("X")
 #undef X
@@ -229,7 +380,7 @@ value::value(v1::types::b_string const v) : value{} {
 
     auto& v_utf8 = impl::with(this)->v().v_utf8;
 
-    v_utf8.str = to_bson_copy(v.value);
+    v_utf8.str = impl::with(this)->to_bson_copy(v.value);
     v_utf8.len = len;
 }
 
@@ -241,7 +392,7 @@ value::value(v1::types::b_document const v) : value{} {
 
     auto& v_doc = impl::with(this)->v().v_doc;
 
-    v_doc.data = to_bson_copy(v.value.data(), v.value.size());
+    v_doc.data = impl::with(this)->to_bson_copy(v.value.data(), v.value.size());
     v_doc.data_len = data_len;
 }
 
@@ -253,7 +404,7 @@ value::value(v1::types::b_array const v) : value{} {
 
     auto& v_doc = impl::with(this)->v().v_doc;
 
-    v_doc.data = to_bson_copy(v.value.data(), v.value.size());
+    v_doc.data = impl::with(this)->to_bson_copy(v.value.data(), v.value.size());
     v_doc.data_len = data_len;
 }
 
@@ -263,7 +414,7 @@ value::value(v1::types::b_binary const v) : value{} {
     auto& v_binary = impl::with(this)->v().v_binary;
 
     v_binary.subtype = static_cast<bson_subtype_t>(v.subtype);
-    v_binary.data = to_bson_copy(v.bytes, v.size);
+    v_binary.data = impl::with(this)->to_bson_copy(v.bytes, v.size);
     v_binary.data_len = v.size;
 }
 
@@ -297,8 +448,8 @@ value::value(v1::types::b_regex const v) : value{} {
 
     auto& v_regex = impl::with(this)->v().v_regex;
 
-    v_regex.regex = to_bson_copy(v.regex);
-    v_regex.options = v.options.empty() ? nullptr : to_bson_copy(v.options);
+    v_regex.regex = impl::with(this)->to_bson_copy(v.regex);
+    v_regex.options = v.options.empty() ? nullptr : impl::with(this)->to_bson_copy(v.options);
 }
 
 value::value(v1::types::b_dbpointer const v) : value{} {
@@ -311,7 +462,7 @@ value::value(v1::types::b_dbpointer const v) : value{} {
 
     auto& v_dbpointer = impl::with(this)->v().v_dbpointer;
 
-    v_dbpointer.collection = to_bson_copy(v.collection);
+    v_dbpointer.collection = impl::with(this)->to_bson_copy(v.collection);
     v_dbpointer.collection_len = collection_len;
     std::memcpy(v_dbpointer.oid.bytes, v.value.bytes(), v.value.size());
 }
@@ -326,7 +477,7 @@ value::value(v1::types::b_code const v) : value{} {
 
     auto& v_code = impl::with(this)->v().v_code;
 
-    v_code.code = to_bson_copy(v.code);
+    v_code.code = impl::with(this)->to_bson_copy(v.code);
     v_code.code_len = code_len;
 }
 
@@ -340,7 +491,7 @@ value::value(v1::types::b_symbol const v) : value{} {
 
     auto& v_symbol = impl::with(this)->v().v_symbol;
 
-    v_symbol.symbol = to_bson_copy(v.symbol);
+    v_symbol.symbol = impl::with(this)->to_bson_copy(v.symbol);
     v_symbol.len = len;
 }
 
@@ -357,9 +508,9 @@ value::value(v1::types::b_codewscope const v) : value{} {
 
     auto& v_codewscope = impl::with(this)->v().v_codewscope;
 
-    v_codewscope.code = to_bson_copy(v.code);
+    v_codewscope.code = impl::with(this)->to_bson_copy(v.code);
     v_codewscope.code_len = code_len;
-    v_codewscope.scope_data = to_bson_copy(v.scope.data(), v.scope.size());
+    v_codewscope.scope_data = impl::with(this)->to_bson_copy(v.scope.data(), v.scope.size());
     v_codewscope.scope_len = scope_len;
 }
 
@@ -487,7 +638,7 @@ value::internal::make(std::uint8_t const* raw, std::uint32_t length, std::uint32
     }
 
     value ret;
-    bson_value_copy(bson_iter_value(&iter), &impl::with(ret)._value);
+    impl::with(ret).copy_from(*bson_iter_value(&iter));
     return ret;
 }
 
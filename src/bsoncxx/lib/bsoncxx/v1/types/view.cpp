@@ -27,6 +27,7 @@
 #include <bsoncxx/v1/types/id.hpp>
 
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -34,6 +35,7 @@
 #include <system_error>
 
 #include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/hash.hh>
 #include <bsoncxx/private/immortal.hh>
 #include <bsoncxx/private/type_traits.hh>
 
@@ -245,3 +247,123 @@ void view::internal::type_id(view& v, v1::types::id id) {
 } // namespace types
 } // namespace v1
 } // namespace bsoncxx
+
+namespace {
+
+std::uint64_t hash_string(bsoncxx::v1::stdx::string_view str, std::uint64_t seed) {
+    return bsoncxx::hash_bytes(str.data(), str.size(), seed);
+}
+
+std::uint64_t hash_document(bsoncxx::v1::document::view doc, std::uint64_t seed) {
+    return bsoncxx::hash_combine(seed, std::hash<bsoncxx::v1::document::view>{}(doc));
+}
+
+} // namespace
+
+std::size_t std::hash<bsoncxx::v1::types::view>::operator()(bsoncxx::v1::types::view const& v) const noexcept {
+    using bsoncxx::hash_bytes;
+    using bsoncxx::hash_combine;
+    using bsoncxx::hash_mix;
+    using bsoncxx::v1::types::id;
+
+    auto const seed = hash_mix(static_cast<std::uint8_t>(v.type_id()));
+
+    std::uint64_t res = seed;
+
+    // Only hash the components which participate in `operator==`.
+    switch (v.type_id()) {
+        case id::k_double: {
+            auto value = v.get_double().value;
+
+            // Ensure `0.0` and `-0.0` hash equal.
+            if (std::fpclassify(value) == FP_ZERO) {
+                value = 0.0;
+            }
+
+            res = hash_bytes(&value, sizeof(value), seed);
+        } break;
+
+        case id::k_string:
+            res = hash_string(v.get_string().value, seed);
+            break;
+
+        case id::k_document:
+            res = hash_document(v.get_document().value, seed);
+            break;
+
+        case id::k_array:
+            res = hash_combine(seed, std::hash<bsoncxx::v1::array::view>{}(v.get_array().value));
+            break;
+
+        case id::k_binary: {
+            auto const value = v.get_binary();
+
+            if (value.bytes && value.size != 0u) {
+                res = hash_bytes(value.bytes, value.size, hash_combine(seed, static_cast<std::uint8_t>(value.subtype)));
+            }
+        } break;
+
+        case id::k_oid: {
+            auto const& value = v.get_oid().value;
+            res = hash_bytes(value.bytes(), value.size(), seed);
+        } break;
+
+        case id::k_bool:
+            res = hash_combine(seed, v.get_bool().value ? 1u : 0u);
+            break;
+
+        case id::k_date:
+            res = hash_combine(seed, static_cast<std::uint64_t>(v.get_date().value.count()));
+            break;
+
+        case id::k_regex: {
+            auto const value = v.get_regex();
+            res = hash_string(value.options, hash_string(value.regex, seed));
+        } break;
+
+        case id::k_dbpointer: {
+            auto const value = v.get_dbpointer();
+            res = hash_bytes(value.value.bytes(), value.value.size(), hash_string(value.collection, seed));
+        } break;
+
+        case id::k_code:
+            res = hash_string(v.get_code().code, seed);
+            break;
+
+        case id::k_symbol:
+            res = hash_string(v.get_symbol().symbol, seed);
+            break;
+
+        case id::k_codewscope: {
+            auto const value = v.get_codewscope();
+            res = hash_document(value.scope, hash_string(value.code, seed));
+        } break;
+
+        case id::k_int32:
+            res = hash_combine(seed, static_cast<std::uint32_t>(v.get_int32().value));
+            break;
+
+        case id::k_timestamp:
+            res = hash_combine(seed, v.get_timestamp().timestamp);
+            break;
+
+        case id::k_int64:
+            res = hash_combine(seed, static_cast<std::uint64_t>(v.get_int64().value));
+            break;
+
+        case id::k_decimal128: {
+            auto const& value = v.get_decimal128().value;
+            res = hash_combine(hash_combine(seed, value.high()), value.low());
+        } break;
+
+        case id::k_minkey:
+        case id::k_undefined:
+        case id::k_null:
+        case id::k_maxkey:
+        default:
+            break;
+    }
+    // BSONCXX_V1_TYPES_XMACRO: update above.
+
+    return static_cast<std::size_t>(res);
+}
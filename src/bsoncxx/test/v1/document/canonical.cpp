@@ -0,0 +1,243 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/v1/document/canonical.hpp>
+
+//
+
+#include <bsoncxx/v1/document/literal.hpp>
+
+#include <bsoncxx/test/v1/document/view.hh>
+#include <bsoncxx/test/v1/exception.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+using bsoncxx::v1::document::canonical_equal_to;
+using bsoncxx::v1::document::canonical_hash;
+using bsoncxx::v1::document::literal_field;
+using bsoncxx::v1::document::make_literal;
+using bsoncxx::v1::document::view;
+
+bool equivalent(view lhs, view rhs) {
+    auto const res = canonical_equal_to{}(lhs, rhs);
+
+    if (res) {
+        CHECK(canonical_hash{}(lhs) == canonical_hash{}(rhs));
+    }
+
+    CHECK(canonical_equal_to{}(rhs, lhs) == res);
+
+    return res;
+}
+
+TEST_CASE("invalid", "[bsoncxx][v1][document][canonical]") {
+    CHECK(equivalent(view{nullptr}, view{nullptr}));
+    CHECK_FALSE(equivalent(view{nullptr}, view{}));
+}
+
+TEST_CASE("field order", "[bsoncxx][v1][document][canonical]") {
+    static constexpr auto ab = make_literal(literal_field("a", 1), literal_field("b", "x"));
+    static constexpr auto ba = make_literal(literal_field("b", "x"), literal_field("a", 1));
+    static constexpr auto a = make_literal(literal_field("a", 1));
+    static constexpr auto ac = make_literal(literal_field("a", 1), literal_field("c", "x"));
+
+    CHECK(equivalent(ab, ab));
+    CHECK(equivalent(ab, ba));
+    CHECK_FALSE(equivalent(ab, a));
+    CHECK_FALSE(equivalent(ab, ac));
+
+    SECTION("nested") {
+        static constexpr auto lhs = make_literal(literal_field("d", ab), literal_field("e", true));
+        static constexpr auto rhs = make_literal(literal_field("e", true), literal_field("d", ba));
+
+        CHECK(equivalent(lhs, rhs));
+        CHECK_FALSE(view{lhs} == view{rhs});
+    }
+}
+
+TEST_CASE("numeric types", "[bsoncxx][v1][document][canonical]") {
+    static constexpr auto i32 = make_literal(literal_field("x", 1));
+    static constexpr auto i64 = make_literal(literal_field("x", std::int64_t{1}));
+    static constexpr auto other = make_literal(literal_field("x", std::int64_t{2}));
+
+    // { 'x': 1.0 }
+    std::uint8_t const d1[] = {16, 0, 0, 0, 0x01, 'x', '\0', 0, 0, 0, 0, 0, 0, 0xF0, 0x3F, 0};
+
+    // { 'x': 1.5 }
+    std::uint8_t const d15[] = {16, 0, 0, 0, 0x01, 'x', '\0', 0, 0, 0, 0, 0, 0, 0xF8, 0x3F, 0};
+
+    CHECK(equivalent(i32, i64));
+    CHECK(equivalent(i32, view{d1}));
+    CHECK(equivalent(i64, view{d1}));
+
+    CHECK_FALSE(equivalent(i32, other));
+    CHECK_FALSE(equivalent(i32, view{d15}));
+    CHECK_FALSE(equivalent(view{d1}, view{d15}));
+
+    // { 'x': '1' }
+    static constexpr auto str = make_literal(literal_field("x", "1"));
+
+    CHECK_FALSE(equivalent(i32, str));
+}
+
+TEST_CASE("decimal128", "[bsoncxx][v1][document][canonical]") {
+    struct dec {
+        std::uint8_t bytes[24];
+
+        // { 'x': <decimal128> }
+        dec(std::uint64_t high, std::uint64_t low) : bytes{24, 0, 0, 0, 0x13, 'x', '\0'} {
+            for (std::size_t i = 0u; i < 8u; ++i) {
+                bytes[7u + i] = static_cast<std::uint8_t>(low >> (8u * i));
+                bytes[15u + i] = static_cast<std::uint8_t>(high >> (8u * i));
+            }
+
+            bytes[23] = 0u;
+        }
+
+        view get() const {
+            return view{bytes};
+        }
+    };
+
+    dec const one{0x3040000000000000u, 1u};         // 1
+    dec const one_0{0x303E000000000000u, 10u};      // 1.0
+    dec const one_00{0x303C000000000000u, 100u};    // 1.00
+    dec const one_5{0x303E000000000000u, 15u};      // 1.5
+    dec const one_50{0x303C000000000000u, 150u};    // 1.50
+    dec const zero{0x3040000000000000u, 0u};        // 0
+    dec const neg_zero{0xB03A000000000000u, 0u};    // -0.000
+    dec const nan{0x7C00000000000000u, 0u};         // NaN
+    dec const nan_payload{0xFC00000000000000u, 1u}; // -NaN with a payload
+
+    static constexpr auto i32 = make_literal(literal_field("x", 1));
+    static constexpr auto i0 = make_literal(literal_field("x", 0));
+
+    CHECK(equivalent(one.get(), one_0.get()));
+    CHECK(equivalent(one.get(), one_00.get()));
+    CHECK(equivalent(one_0.get(), i32));
+    CHECK(equivalent(one_5.get(), one_50.get()));
+    CHECK(equivalent(zero.get(), neg_zero.get()));
+    CHECK(equivalent(neg_zero.get(), i0));
+    CHECK(equivalent(nan.get(), nan_payload.get()));
+
+    CHECK_FALSE(equivalent(one.get(), one_5.get()));
+    CHECK_FALSE(equivalent(one_5.get(), i32));
+    CHECK_FALSE(equivalent(nan.get(), zero.get()));
+}
+
+TEST_CASE("duplicate keys", "[bsoncxx][v1][document][canonical]") {
+    static constexpr auto a12 = make_literal(literal_field("a", 1), literal_field("a", 2));
+    static constexpr auto a21 = make_literal(literal_field("a", 2), literal_field("a", 1));
+    static constexpr auto a11 = make_literal(literal_field("a", 1), literal_field("a", 1));
+    static constexpr auto a1b = make_literal(literal_field("a", 1), literal_field("b", 0), literal_field("a", 2));
+
+    CHECK(equivalent(a12, a12));
+    CHECK(equivalent(a12, make_literal(literal_field("a", std::int64_t{1}), literal_field("a", 2))));
+    CHECK(equivalent(a1b, make_literal(literal_field("b", 0), literal_field("a", 1), literal_field("a", 2))));
+
+    CHECK_FALSE(equivalent(a12, a21));
+    CHECK_FALSE(equivalent(a12, a11));
+    CHECK_FALSE(equivalent(a11, a12));
+
+    SECTION("many fields") {
+        static constexpr auto lhs = make_literal(
+            literal_field("a", 1), literal_field("b", 2), literal_field("c", 3), literal_field("d", 4),
+            literal_field("e", 5), literal_field("f", 6), literal_field("g", 7), literal_field("h", 8),
+            literal_field("i", 9), literal_field("j", 10), literal_field("k", 11), literal_field("l", 12),
+            literal_field("m", 13), literal_field("n", 14), literal_field("o", 15), literal_field("a", 16),
+            literal_field("a", 17), literal_field("a", 18));
+
+        static constexpr auto rhs = make_literal(
+            literal_field("a", 1), literal_field("o", 15), literal_field("n", 14), literal_field("m", 13),
+            literal_field("l", 12), literal_field("k", 11), literal_field("j", 10), literal_field("i", 9),
+            literal_field("h", 8), literal_field("g", 7), literal_field("f", 6), literal_field("e", 5),
+            literal_field("d", 4), literal_field("c", 3), literal_field("b", 2), literal_field("a", 16),
+            literal_field("a", 17), literal_field("a", 18));
+
+        static constexpr auto other = make_literal(
+            literal_field("a", 18), literal_field("o", 15), literal_field("n", 14), literal_field("m", 13),
+            literal_field("l", 12), literal_field("k", 11), literal_field("j", 10), literal_field("i", 9),
+            literal_field("h", 8), literal_field("g", 7), literal_field("f", 6), literal_field("e", 5),
+            literal_field("d", 4), literal_field("c", 3), literal_field("b", 2), literal_field("a", 16),
+            literal_field("a", 17), literal_field("a", 1));
+
+        CHECK(equivalent(lhs, rhs));
+        CHECK_FALSE(equivalent(lhs, other));
+    }
+}
+
+TEST_CASE("arrays", "[bsoncxx][v1][document][canonical]") {
+    // { 'a': [1, 2] }
+    std::uint8_t const a12[] = {27, 0, 0, 0, 0x04, 'a', '\0', 19, 0, 0, 0, 0x10, '0', '\0', 1, 0, 0, 0,
+                                0x10, '1', '\0', 2, 0, 0, 0, 0, 0};
+
+    // { 'a': [2, 1] }
+    std::uint8_t const a21[] = {27, 0, 0, 0, 0x04, 'a', '\0', 19, 0, 0, 0, 0x10, '0', '\0', 2, 0, 0, 0,
+                                0x10, '1', '\0', 1, 0, 0, 0, 0, 0};
+
+    // { 'a': [1, 2L] }
+    std::uint8_t const a12l[] = {31, 0, 0, 0, 0x04, 'a', '\0', 23, 0, 0, 0, 0x10, '0', '\0', 1, 0, 0, 0,
+                                 0x12, '1', '\0', 2, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    CHECK(equivalent(view{a12}, view{a12l}));
+    CHECK_FALSE(equivalent(view{a12}, view{a21}));
+}
+
+TEST_CASE("many fields", "[bsoncxx][v1][document][canonical]") {
+    static constexpr auto lhs = make_literal(
+        literal_field("a", 1), literal_field("b", 2), literal_field("c", 3), literal_field("d", 4),
+        literal_field("e", 5), literal_field("f", 6), literal_field("g", 7), literal_field("h", 8),
+        literal_field("i", 9), literal_field("j", 10), literal_field("k", 11), literal_field("l", 12),
+        literal_field("m", 13), literal_field("n", 14), literal_field("o", 15), literal_field("p", 16),
+        literal_field("q", 17), literal_field("r", 18));
+
+    static constexpr auto rhs = make_literal(
+        literal_field("r", 18), literal_field("q", 17), literal_field("p", 16), literal_field("o", 15),
+        literal_field("n", 14), literal_field("m", 13), literal_field("l", 12), literal_field("k", 11),
+        literal_field("j", 10), literal_field("i", 9), literal_field("h", 8), literal_field("g", 7),
+        literal_field("f", 6), literal_field("e", 5), literal_field("d", 4), literal_field("c", 3),
+        literal_field("b", 2), literal_field("a", 1));
+
+    static constexpr auto other = make_literal(
+        literal_field("r", 18), literal_field("q", 17), literal_field("p", 16), literal_field("o", 15),
+        literal_field("n", 14), literal_field("m", 13), literal_field("l", 12), literal_field("k", 11),
+        literal_field("j", 10), literal_field("i", 9), literal_field("h", 8), literal_field("g", 7),
+        literal_field("f", 6), literal_field("e", 5), literal_field("d", 4), literal_field("c", 3),
+        literal_field("b", 2), literal_field("a", 0));
+
+    CHECK(equivalent(lhs, rhs));
+    CHECK_FALSE(equivalent(lhs, other));
+}
+
+TEST_CASE("unordered_set", "[bsoncxx][v1][document][canonical]") {
+    static constexpr auto ab = make_literal(literal_field("a", 1), literal_field("b", 2));
+    static constexpr auto ba = make_literal(literal_field("b", std::int64_t{2}), literal_field("a", 1));
+    static constexpr auto c = make_literal(literal_field("c", 3));
+
+    std::unordered_set<view, canonical_hash, canonical_equal_to> set;
+
+    CHECK(set.insert(ab.view()).second);
+    CHECK_FALSE(set.insert(ba.view()).second);
+    CHECK(set.insert(c.view()).second);
+    CHECK(set.size() == 2u);
+}
+
+} // namespace
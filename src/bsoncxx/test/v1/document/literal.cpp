@@ -0,0 +1,95 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/v1/document/literal.hpp>
+
+//
+
+#include <bsoncxx/test/v1/document/view.hh>
+#include <bsoncxx/test/v1/stdx/string_view.hh>
+#include <bsoncxx/test/v1/types/view.hh>
+
+#include <cstdint>
+#include <cstring>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+using bsoncxx::v1::document::literal_field;
+using bsoncxx::v1::document::make_literal;
+using bsoncxx::v1::document::view;
+
+constexpr auto empty = make_literal();
+constexpr auto ping = make_literal(literal_field("ping", 1));
+constexpr auto ping_view = ping.view();
+
+static_assert(empty.size() == 5u, "");
+static_assert(ping.size() == 15u, "");
+static_assert(ping.data()[0] == 15u, "");
+static_assert(ping.data()[4] == 0x10, "");
+static_assert(ping_view.data() == ping.data(), "");
+
+TEST_CASE("empty", "[bsoncxx][v1][document][literal]") {
+    CHECK(empty.view().empty());
+    CHECK(empty.view() == view{});
+}
+
+TEST_CASE("basic", "[bsoncxx][v1][document][literal]") {
+    std::uint8_t const expected[] = {15, 0, 0, 0, 0x10, 'p', 'i', 'n', 'g', '\0', 1, 0, 0, 0, 0}; // { 'ping': 1 }
+
+    REQUIRE(ping.size() == sizeof(expected));
+    CHECK(std::memcmp(ping.data(), expected, sizeof(expected)) == 0);
+
+    view const v = ping;
+
+    CHECK(v.data() == ping.data());
+    CHECK(v.size() == ping.size());
+    CHECK(v["ping"].get_int32().value == 1);
+}
+
+TEST_CASE("types", "[bsoncxx][v1][document][literal]") {
+    static constexpr auto doc = make_literal(
+        literal_field("b", true),
+        literal_field("n", nullptr),
+        literal_field("i32", -1),
+        literal_field("i64", std::int64_t{-2}),
+        literal_field("s", "active"),
+        literal_field("e", ""),
+        literal_field("d", make_literal(literal_field("x", 1), literal_field("y", -1))));
+
+    view const v = doc.view();
+
+    CHECK(v["b"].get_bool().value == true);
+    CHECK(v["n"].type_id() == bsoncxx::v1::types::id::k_null);
+    CHECK(v["i32"].get_int32().value == -1);
+    CHECK(v["i64"].get_int64().value == -2);
+    CHECK(v["s"].get_string().value == "active");
+    CHECK(v["e"].get_string().value.empty());
+
+    auto const d = v["d"].get_document().value;
+
+    CHECK(d.size() == 19u);
+    CHECK(d["x"].get_int32().value == 1);
+    CHECK(d["y"].get_int32().value == -1);
+
+    std::size_t count = 0u;
+    for (auto const& e : v) {
+        (void)e;
+        ++count;
+    }
+    CHECK(count == 7u);
+}
+
+} // namespace
@@ -0,0 +1,178 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+
+//
+
+#include <bsoncxx/test/v1/document/value.hh>
+#include <bsoncxx/test/v1/document/view.hh>
+#include <bsoncxx/test/v1/types/view.hh>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+using bsoncxx::v1::document::shared_value;
+using bsoncxx::v1::document::value;
+using bsoncxx::v1::document::view;
+
+std::uint8_t const xdoc[] = {12, 0, 0, 0, 16, 'x', '\0', 1, 0, 0, 0, 0}; // { 'x': 1 }
+
+value make_xdoc() {
+    auto owner = std::unique_ptr<std::uint8_t[]>(new std::uint8_t[sizeof(xdoc)]);
+    std::memcpy(owner.get(), xdoc, sizeof(xdoc));
+    return value{owner.release()};
+}
+
+TEST_CASE("default", "[bsoncxx][v1][document][shared_value]") {
+    shared_value const v;
+
+    CHECK(v.use_count() == 0u);
+    CHECK(v.data() == view{}.data());
+    CHECK(v.empty());
+    CHECK(v == shared_value{});
+    CHECK(v.view() == view{});
+
+    SECTION("invalid view") {
+        shared_value const invalid{view{nullptr}};
+
+        CHECK(invalid.use_count() == 0u);
+        CHECK(invalid.data() == view{}.data());
+    }
+
+    SECTION("to value") {
+        value const doc = v;
+
+        CHECK(doc.data() == view{}.data());
+    }
+}
+
+TEST_CASE("ownership", "[bsoncxx][v1][document][shared_value]") {
+    SECTION("view") {
+        shared_value v{view{xdoc}};
+
+        REQUIRE(v.use_count() == 1u);
+        CHECK(v.data() != xdoc);
+        CHECK(v.view() == view{xdoc});
+        CHECK(v["x"].get_int32().value == 1);
+    }
+
+    SECTION("value") {
+        auto doc = make_xdoc();
+        auto const data = doc.data();
+
+        shared_value v{std::move(doc)};
+
+        REQUIRE(v.use_count() == 1u);
+        CHECK(v.data() == data);
+        CHECK(v.view() == view{xdoc});
+    }
+
+    shared_value source{make_xdoc()};
+    auto const data = source.data();
+
+    SECTION("copy") {
+        shared_value copy = source;
+
+        CHECK(source.use_count() == 2u);
+        CHECK(copy.use_count() == 2u);
+        CHECK(copy.data() == data);
+
+        {
+            shared_value target;
+            target = copy;
+
+            CHECK(target.data() == data);
+            CHECK(source.use_count() == 3u);
+        }
+
+        CHECK(source.use_count() == 2u);
+
+        auto const& self = copy;
+        copy = self;
+
+        CHECK(copy.use_count() == 2u);
+        CHECK(copy.data() == data);
+    }
+
+    SECTION("move") {
+        shared_value move = std::move(source);
+
+        CHECK(source.use_count() == 0u);
+        CHECK(source.data() == view{}.data());
+
+        CHECK(move.use_count() == 1u);
+        CHECK(move.data() == data);
+
+        shared_value target{view{xdoc}};
+        target = std::move(move);
+
+        CHECK(move.use_count() == 0u);
+        CHECK(target.use_count() == 1u);
+        CHECK(target.data() == data);
+    }
+
+    SECTION("to value") {
+        value doc = source;
+
+        CHECK(doc.data() != data);
+        CHECK(doc == source.view());
+        CHECK(source.use_count() == 1u);
+
+        CHECK(doc.patch("x", bsoncxx::v1::types::b_int32{2}));
+
+        CHECK(doc["x"].get_int32().value == 2);
+        CHECK(source["x"].get_int32().value == 1);
+    }
+
+    SECTION("outlives owner") {
+        value doc = source;
+
+        source = shared_value{};
+
+        CHECK(doc == view{xdoc});
+    }
+}
+
+TEST_CASE("concurrency", "[bsoncxx][v1][document][shared_value]") {
+    shared_value const source{view{xdoc}};
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&source] {
+            for (int j = 0; j < 1000; ++j) {
+                shared_value copy = source;
+                value doc = copy;
+                (void)doc;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    CHECK(source.use_count() == 1u);
+}
+
+} // namespace
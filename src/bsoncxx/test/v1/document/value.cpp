@@ -19,10 +19,12 @@
 #include <bsoncxx/v1/detail/macros.hpp>
 
 #include <bsoncxx/test/v1/document/view.hh>
+#include <bsoncxx/test/v1/exception.hh>
 #include <bsoncxx/test/v1/stdx/optional.hh>
 #include <bsoncxx/test/v1/stdx/string_view.hh>
 #include <bsoncxx/test/v1/types/view.hh>
 
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -30,6 +32,8 @@
 #include <ostream>
 #include <sstream>
 #include <stdexcept>
+#include <string>
+#include <system_error>
 #include <type_traits>
 #include <utility>
 
@@ -54,6 +58,65 @@ bsoncxx::v1::stdx::optional<Deleter> get_deleter(T const& v) {
     return {};
 }
 
+TEST_CASE("error code", "[bsoncxx][v1][document][value][error]") {
+    using bsoncxx::v1::source_errc;
+    using bsoncxx::v1::type_errc;
+
+    using code = value::errc;
+
+    auto const& category = value::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("bsoncxx::v1::document::value"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::not_fixed_size;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::not_fixed_size) == source_errc::bsoncxx);
+        CHECK(make_error_code(code::size_mismatch) == source_errc::bsoncxx);
+        CHECK(make_error_code(code::invalid_length) == source_errc::bsoncxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::not_fixed_size) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::size_mismatch) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_length) == type_errc::invalid_argument);
+    }
+}
+
 TEST_CASE("exceptions", "[bsoncxx][v1][document][value]") {
     using code = bsoncxx::v1::document::view::errc;
 
@@ -526,6 +589,123 @@ TEST_CASE("basic", "[bsoncxx][v1][document][value]") {
     }
 }
 
+TEST_CASE("patch", "[bsoncxx][v1][document][value]") {
+    using code = value::errc;
+
+    namespace types = bsoncxx::v1::types;
+
+    // { 'a': 1, 'b': { 'c': 2L, 's': 'x' }, 'd': 1.5 }
+    std::uint8_t const xdoc[] = {
+        // clang-format off
+        51, 0, 0, 0,
+        0x10, 'a', '\0', 1, 0, 0, 0,
+        0x03, 'b', '\0', 25, 0, 0, 0,
+            0x12, 'c', '\0', 2, 0, 0, 0, 0, 0, 0, 0,
+            0x02, 's', '\0', 2, 0, 0, 0, 'x', '\0',
+            0,
+        0x01, 'd', '\0', 0, 0, 0, 0, 0, 0, 0xF8, 0x3F,
+        0,
+        // clang-format on
+    };
+
+    REQUIRE(xdoc[0] == sizeof(xdoc));
+
+    auto owner = std::unique_ptr<std::uint8_t[]>(new std::uint8_t[sizeof(xdoc)]);
+    std::memcpy(owner.get(), xdoc, sizeof(xdoc));
+    auto const data_ptr = owner.get();
+
+    value v{std::move(owner)};
+
+    SECTION("patch") {
+        CHECK(v.patch("a", types::b_int32{42}));
+        CHECK(v["a"].get_int32().value == 42);
+
+        CHECK(v.patch("b.c", types::b_double{2.5}));
+        CHECK(v["b"]["c"].get_double().value == 2.5);
+
+        CHECK(v.patch("b.c", types::b_date{std::chrono::milliseconds{3}}));
+        CHECK(v["b"]["c"].get_date().value == std::chrono::milliseconds{3});
+
+        CHECK(v.data() == data_ptr);
+        CHECK(v.size() == sizeof(xdoc));
+        CHECK(v["d"].get_double().value == 1.5);
+
+        CHECK_FALSE(v.patch("x", types::b_int32{}));
+        CHECK_FALSE(v.patch("b.x", types::b_int32{}));
+        CHECK_FALSE(v.patch("a.x", types::b_int32{}));
+
+        CHECK_THROWS_WITH_CODE(v.patch("a", types::b_int64{}), code::size_mismatch);
+        CHECK_THROWS_WITH_CODE(v.patch("b.s", types::b_int32{}), code::not_fixed_size);
+        CHECK_THROWS_WITH_CODE(v.patch("a", types::b_string{"x"}), code::not_fixed_size);
+
+        CHECK(std::memcmp(v.data() + 4, xdoc + 4, 3) == 0); // Unmodified on error.
+    }
+
+    SECTION("fixed size") {
+        CHECK(v.patch("b.c", types::b_timestamp{7u, 9u}));
+        CHECK(v["b"]["c"].get_timestamp().increment == 7u);
+        CHECK(v["b"]["c"].get_timestamp().timestamp == 9u);
+
+        CHECK(v.patch("b.c", types::b_int64{-2}));
+        CHECK(v["b"]["c"].get_int64().value == -2);
+
+        CHECK(v.patch("d", types::b_double{-0.25}));
+        CHECK(v["d"].get_double().value == -0.25);
+
+        CHECK(v.data() == data_ptr);
+    }
+
+    SECTION("unowned") {
+        value u{const_cast<std::uint8_t*>(xdoc), &value::noop_deleter};
+
+        SECTION("patch") {
+            CHECK(u.patch("a", types::b_int32{42}));
+        }
+
+        SECTION("splice") {
+            CHECK(u.splice("b.s", types::b_string{"y"}));
+        }
+
+        CHECK(u.data() != xdoc);
+        CHECK(get_deleter<value::default_deleter_type>(u).has_value());
+        CHECK(xdoc[7] == 1); // Original BSON bytes are unmodified.
+    }
+
+    SECTION("splice") {
+        SECTION("same size") {
+            CHECK(v.splice("b.s", types::b_string{"y"}));
+            CHECK(v["b"]["s"].get_string().value == "y");
+
+            CHECK(v.data() == data_ptr);
+            CHECK(v.size() == sizeof(xdoc));
+        }
+
+        SECTION("grow") {
+            CHECK(v.splice("b.s", types::b_string{"hello world"}));
+            CHECK(v["b"]["s"].get_string().value == "hello world");
+
+            CHECK(v.data() != data_ptr);
+            CHECK(v.size() == sizeof(xdoc) + 10u);
+            CHECK(v["b"].get_document().value.size() == 25u + 10u);
+            CHECK(v["b"]["c"].get_int64().value == 2);
+            CHECK(v["d"].get_double().value == 1.5);
+            CHECK(get_deleter<value::default_deleter_type>(v).has_value());
+        }
+
+        SECTION("shrink") {
+            CHECK(v.splice("b", types::b_int32{7}));
+            CHECK(v["b"].get_int32().value == 7);
+
+            CHECK(v.size() == sizeof(xdoc) - 21u);
+            CHECK(v["a"].get_int32().value == 1);
+            CHECK(v["d"].get_double().value == 1.5);
+        }
+
+        CHECK_FALSE(v.splice("x", types::b_int32{}));
+        CHECK_FALSE(v.splice("a.x", types::b_int32{}));
+    }
+}
+
 BSONCXX_PRIVATE_WARNINGS_PUSH();
 BSONCXX_PRIVATE_WARNINGS_DISABLE(Clang("-Wunused-member-function"));
 
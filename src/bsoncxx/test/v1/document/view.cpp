@@ -27,6 +27,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <new>
 #include <string>
@@ -354,6 +355,23 @@ TEST_CASE("basic", "[bsoncxx][v1][document][view]") {
     }
 }
 
+TEST_CASE("hash", "[bsoncxx][v1][document][view]") {
+    using hash = std::hash<view>;
+
+    std::uint8_t const x1[] = {12, 0, 0, 0, 16, 'x', '\0', 1, 0, 0, 0, 0}; // { 'x': 1 }
+    std::uint8_t const x2[] = {12, 0, 0, 0, 16, 'x', '\0', 2, 0, 0, 0, 0}; // { 'x': 2 }
+
+    auto const copy = std::unique_ptr<std::uint8_t[]>(new std::uint8_t[sizeof(x1)]);
+    std::memcpy(copy.get(), x1, sizeof(x1));
+
+    CHECK(hash{}(view{nullptr}) == hash{}(view{nullptr}));
+    CHECK(hash{}(view{}) == hash{}(view{}));
+
+    CHECK(hash{}(view{x1}) == hash{}(view{copy.get()}));
+    CHECK(hash{}(view{x1}) != hash{}(view{x2}));
+    CHECK(hash{}(view{x1}) != hash{}(view{}));
+}
+
 TEST_CASE("StringMaker", "[bsoncxx][test][v1][document][view]") {
     SECTION("invalid") {
         view doc{nullptr};
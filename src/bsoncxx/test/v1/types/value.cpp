@@ -32,6 +32,7 @@
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <new>
 #include <string>
 #include <system_error>
@@ -163,13 +164,17 @@ TEST_CASE("exceptions", "[bsoncxx][v1][types][value]") {
 }
 
 TEST_CASE("ownership", "[bsoncxx][v1][types][value]") {
-    value target{"old"};
-    value source{"new"};
+    // Long enough to require a heap allocation.
+    auto const old_str = std::string(64u, 'o');
+    auto const new_str = std::string(64u, 'n');
+
+    value target{old_str};
+    value source{new_str};
 
     REQUIRE(source.type_id() == id::k_string);
     REQUIRE(target.type_id() == id::k_string);
 
-    auto const data = source.get_string().value.data(); // "new"
+    auto const data = source.get_string().value.data(); // new_str
 
     SECTION("move") {
         auto move = std::move(source);
@@ -178,7 +183,7 @@ TEST_CASE("ownership", "[bsoncxx][v1][types][value]") {
 
         REQUIRE(move.type_id() == id::k_string);
         CHECK(move.get_string().value.data() == data);
-        CHECK(move.get_string().value == "new");
+        CHECK(move.get_string().value == new_str);
 
         target = std::move(move);
 
@@ -186,7 +191,7 @@ TEST_CASE("ownership", "[bsoncxx][v1][types][value]") {
 
         REQUIRE(target.type_id() == id::k_string);
         CHECK(target.get_string().value.data() == data);
-        CHECK(target.get_string().value == "new");
+        CHECK(target.get_string().value == new_str);
     }
 
     SECTION("copy") {
@@ -194,11 +199,11 @@ TEST_CASE("ownership", "[bsoncxx][v1][types][value]") {
 
         REQUIRE(source.type_id() == id::k_string);
         CHECK(source.get_string().value.data() == data);
-        CHECK(source.get_string().value == "new");
+        CHECK(source.get_string().value == new_str);
 
         REQUIRE(copy.type_id() == id::k_string);
         auto const copy_data = copy.get_string().value.data();
-        CHECK(copy.get_string().value == "new");
+        CHECK(copy.get_string().value == new_str);
         CHECK(copy_data != data);
 
         target = copy;
@@ -208,12 +213,115 @@ TEST_CASE("ownership", "[bsoncxx][v1][types][value]") {
 
         REQUIRE(target.type_id() == id::k_string);
         auto const target_data = target.get_string().value.data();
-        CHECK(target.get_string().value == "new");
+        CHECK(target.get_string().value == new_str);
         CHECK(target_data != data);
         CHECK(target_data != copy_data);
     }
 }
 
+TEST_CASE("inline storage", "[bsoncxx][v1][types][value]") {
+    auto const is_inline = [](value const& v, void const* ptr) -> bool {
+        auto const begin = reinterpret_cast<unsigned char const*>(&v);
+        auto const end = begin + sizeof(value);
+        return std::less_equal<void const*>{}(begin, ptr) && std::less<void const*>{}(ptr, end);
+    };
+
+    SECTION("b_string") {
+        auto const small = std::string(8u, 's');
+        auto const large = std::string(64u, 'l');
+
+        value v{small};
+        value big{large};
+
+        REQUIRE(v.type_id() == id::k_string);
+        CHECK(v.get_string().value == small);
+        CHECK(is_inline(v, v.get_string().value.data()));
+        CHECK(value::internal::get_bson_value(v).value.v_utf8.str[small.size()] == '\0');
+
+        CHECK_FALSE(is_inline(big, big.get_string().value.data()));
+
+        SECTION("copy") {
+            auto const copy = v;
+
+            REQUIRE(copy.type_id() == id::k_string);
+            CHECK(copy.get_string().value == small);
+            CHECK(is_inline(copy, copy.get_string().value.data()));
+
+            big = copy;
+
+            REQUIRE(big.type_id() == id::k_string);
+            CHECK(big.get_string().value == small);
+            CHECK(is_inline(big, big.get_string().value.data()));
+        }
+
+        SECTION("move") {
+            auto move = std::move(v);
+
+            CHECK(v.type_id() == id::k_null);
+
+            REQUIRE(move.type_id() == id::k_string);
+            CHECK(move.get_string().value == small);
+            CHECK(is_inline(move, move.get_string().value.data()));
+
+            big = std::move(move);
+
+            CHECK(move.type_id() == id::k_null);
+
+            REQUIRE(big.type_id() == id::k_string);
+            CHECK(big.get_string().value == small);
+            CHECK(is_inline(big, big.get_string().value.data()));
+        }
+
+        SECTION("replace") {
+            v = value{large};
+
+            REQUIRE(v.type_id() == id::k_string);
+            CHECK(v.get_string().value == large);
+            CHECK_FALSE(is_inline(v, v.get_string().value.data()));
+        }
+    }
+
+    SECTION("b_binary") {
+        std::uint8_t const data[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+        value v{data, sizeof(data)};
+
+        REQUIRE(v.type_id() == id::k_binary);
+        CHECK(v.get_binary().size == sizeof(data));
+        CHECK(is_inline(v, v.get_binary().bytes));
+        CHECK(v == view{b_binary{binary_subtype::k_binary, sizeof(data), data}});
+
+        auto const copy = v;
+
+        CHECK(is_inline(copy, copy.get_binary().bytes));
+        CHECK(copy == v);
+    }
+
+    SECTION("b_document") {
+        bsoncxx::v1::document::view const empty;
+
+        value v{empty};
+
+        REQUIRE(v.type_id() == id::k_document);
+        CHECK(is_inline(v, v.get_document().value.data()));
+        CHECK(v.get_document().value == empty);
+    }
+
+    SECTION("internal::make") {
+        std::uint8_t const data[] = {14, 0, 0, 0, 2, 'x', '\0', 2, 0, 0, 0, 'a', '\0', 0}; // {"x": "a"}
+        bsoncxx::v1::document::view const doc{data};
+
+        auto const e = doc["x"];
+        REQUIRE(e);
+
+        auto const v = e.type_value();
+
+        REQUIRE(v.type_id() == id::k_string);
+        CHECK(v.get_string().value == "a");
+        CHECK(is_inline(v, v.get_string().value.data()));
+    }
+}
+
 TEST_CASE("basic", "[bsoncxx][v1][types][value]") {
     SECTION("default") {
         value v;
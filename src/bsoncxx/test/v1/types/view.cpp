@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <system_error>
 
@@ -415,6 +416,33 @@ TEST_CASE("b_types", "[bsoncxx][v1][types][view]") {
     // BSONCXX_V1_TYPES_XMACRO: update above.
 }
 
+TEST_CASE("hash", "[bsoncxx][v1][types][view]") {
+    auto const h = [](view v) { return std::hash<view>{}(v); };
+
+    SECTION("equal") {
+        CHECK(h(b_int32{1}) == h(b_int32{1}));
+        CHECK(h(b_string{"abc"}) == h(b_string{"abc"}));
+        CHECK(h(b_null{}) == h(b_null{}));
+
+        // Consistent with operator==.
+        CHECK(h(b_double{0.0}) == h(b_double{-0.0}));
+        CHECK(h(b_timestamp{1u, 2u}) == h(b_timestamp{3u, 2u}));
+    }
+
+    SECTION("not equal") {
+        CHECK(h(b_int32{1}) != h(b_int32{2}));
+        CHECK(h(b_int32{1}) != h(b_int64{1}));
+        CHECK(h(b_string{"abc"}) != h(b_string{"abd"}));
+        CHECK(h(b_string{"abc"}) != h(b_symbol{"abc"}));
+        CHECK(h(b_null{}) != h(b_undefined{}));
+        CHECK(h(b_minkey{}) != h(b_maxkey{}));
+    }
+
+    SECTION("value") {
+        CHECK(std::hash<value>{}(value{std::int32_t{1}}) == h(b_int32{1}));
+    }
+}
+
 TEST_CASE("StringMaker", "[bsoncxx][test][v1][types][view]") {
     // BSONCXX_V1_TYPES_XMACRO: update below.
     {
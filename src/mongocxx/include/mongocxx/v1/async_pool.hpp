@@ -0,0 +1,457 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/async_pool-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/client-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+#endif
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Run operations asynchronously using client objects acquired from a pool.
+///
+/// Operations are queued and executed by a fixed number of worker threads owned by this object. Each worker acquires a
+/// client object from the associated pool for the duration of a single operation, then releases it back to the pool.
+/// A bounded queue provides backpressure: submitting an operation blocks the calling thread while the queue is full.
+///
+/// Results are delivered via `std::future`, a completion callback, or (when C++20 coroutines are supported) an
+/// awaitable object.
+///
+/// @note libmongoc operations are blocking. The number of operations that are concurrently executing is bounded by
+/// the number of worker threads (and by "maxPoolSize"); the number of operations that may be in flight is additionally
+/// bounded by the queue capacity.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @par Thread Safety:
+/// All member functions except for the destructor, move assignment, and @ref shutdown may be called concurrently.
+///
+class async_pool {
+   private:
+    class impl;
+    void* _impl;
+
+    template <typename F>
+    using result_type = decltype(std::declval<F&>()(std::declval<v1::client&>()));
+
+   public:
+    class options;
+
+#if defined(__cpp_impl_coroutine)
+    template <typename T>
+    class awaitable;
+#endif
+
+    ///
+    /// The type of a queued task.
+    ///
+    /// Exactly one of `client` or `error` is non-null:
+    /// - `client` is a client object acquired from the associated pool which remains valid until the task returns.
+    /// - `error` is the exception thrown when a client object could not be acquired from the associated pool.
+    ///
+    /// @important A task must not throw an exception. `std::terminate()` is called if it does.
+    ///
+    using task_type = std::function<void(v1::client* client, std::exception_ptr error)>;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// Equivalent to @ref shutdown.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~async_pool();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() async_pool(async_pool&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(async_pool&) operator=(async_pool&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    async_pool(async_pool const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    async_pool& operator=(async_pool const& other) = delete;
+
+    ///
+    /// Start worker threads which execute operations using client objects acquired from `pool`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::invalid_worker_count if the worker
+    /// count is zero.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::invalid_queue_capacity if the queue
+    /// capacity is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() async_pool(v1::pool& pool, options opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() async_pool(v1::pool& pool);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Enqueue `task` for execution by a worker thread.
+    ///
+    /// Blocks the current thread while the queue is full, unless the current thread is a worker thread of this object
+    /// (e.g. when called from within a task or continuation), in which case the queue capacity is not enforced to
+    /// avoid waiting on itself.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::shutdown if @ref shutdown has been
+    /// called.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) post(task_type task);
+
+    ///
+    /// Enqueue `task` for execution by a worker thread, then invoke `then` on the same worker thread once the client
+    /// object acquired for `task` has been released back to the associated pool.
+    ///
+    /// Blocks the current thread as described by @ref post(task_type task).
+    ///
+    /// @important `then` must not throw an exception. `std::terminate()` is called if it does.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::shutdown if @ref shutdown has been
+    /// called.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) post(task_type task, std::function<void()> then);
+
+    ///
+    /// Enqueue `task` for execution by a worker thread.
+    ///
+    /// @returns `false` (and `task` is not executed) when the queue is full.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::shutdown if @ref shutdown has been
+    /// called.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) try_post(task_type task);
+
+    ///
+    /// Execute `fn` on a worker thread with a client object acquired from the associated pool.
+    ///
+    /// `fn` must be invocable as `fn(client)` where `client` is a @ref mongocxx::v1::client lvalue.
+    ///
+    /// @returns A future which is ready once `fn` has returned. The future holds the value returned by `fn`, the
+    /// exception thrown by `fn`, or the exception thrown when a client object could not be acquired.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::shutdown if @ref shutdown has been
+    /// called.
+    ///
+    template <typename F, typename R = result_type<F>>
+    std::future<R> submit(F fn) {
+        auto const promise = std::make_shared<std::promise<R>>();
+        auto res = promise->get_future();
+
+        this->post([promise, fn](v1::client* client, std::exception_ptr error) mutable {
+            complete(*promise, fn, client, std::move(error));
+        });
+
+        return res;
+    }
+
+    ///
+    /// Execute `fn` on a worker thread with a client object acquired from the associated pool, then invoke
+    /// `on_complete` with the result.
+    ///
+    /// `on_complete` must be invocable as `on_complete(std::move(future))` where `future` is a ready
+    /// `std::future<R>` equivalent to the one returned by `this->submit(fn)`.
+    ///
+    /// @note `on_complete` is invoked on a worker thread after the client object has been released back to the
+    /// associated pool.
+    ///
+    /// @important `on_complete` must not throw an exception. `std::terminate()` is called if it does.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::async_pool::errc::shutdown if @ref shutdown has been
+    /// called.
+    ///
+    template <typename F, typename Callback, typename R = result_type<F>>
+    void submit(F fn, Callback on_complete) {
+        auto const promise = std::make_shared<std::promise<R>>();
+
+        this->post(
+            [promise, fn](v1::client* client, std::exception_ptr error) mutable {
+                complete(*promise, fn, client, std::move(error));
+            },
+            [promise, on_complete]() mutable { on_complete(promise->get_future()); });
+    }
+
+#if defined(__cpp_impl_coroutine)
+    ///
+    /// Return an awaitable which executes `fn` on a worker thread with a client object acquired from the associated
+    /// pool.
+    ///
+    /// The operation is enqueued when the awaitable is awaited. The awaiting coroutine is resumed on the worker thread
+    /// once `fn` has returned and the client object has been released back to the associated pool. The result of the
+    /// `co_await` expression is the value returned by `fn`. Exceptions are rethrown in the awaiting coroutine.
+    ///
+    /// @note The awaiting coroutine occupies the worker thread until it next suspends or completes.
+    ///
+    template <typename F, typename R = result_type<F>>
+    awaitable<R> co_submit(F fn) {
+        return awaitable<R>{*this, std::function<R(v1::client&)>{std::move(fn)}};
+    }
+#endif
+
+    ///
+    /// Stop accepting new operations, wait for all queued operations to complete, then join all worker threads.
+    ///
+    /// @warning Must not be called by a worker thread.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) shutdown();
+
+    ///
+    /// Return the number of worker threads.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) worker_count() const;
+
+    ///
+    /// Return the number of operations which are queued or currently executing.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) pending() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::async_pool.
+    ///
+    enum class errc {
+        zero,                   ///< Zero.
+        invalid_worker_count,   ///< The worker count must be greater than zero.
+        invalid_queue_capacity, ///< The queue capacity must be greater than zero.
+        shutdown,               ///< The async pool is no longer accepting operations.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::async_pool::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+
+   private:
+    template <typename R, typename F>
+    static void invoke(std::promise<R>& promise, F& fn, v1::client& client) {
+        promise.set_value(fn(client));
+    }
+
+    template <typename F>
+    static void invoke(std::promise<void>& promise, F& fn, v1::client& client) {
+        fn(client);
+        promise.set_value();
+    }
+
+    template <typename R, typename F>
+    static void complete(std::promise<R>& promise, F& fn, v1::client* client, std::exception_ptr error) {
+        if (error) {
+            promise.set_exception(std::move(error));
+            return;
+        }
+
+        try {
+            invoke(promise, fn, *client);
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    }
+};
+
+///
+/// Options for @ref mongocxx::v1::async_pool.
+///
+/// Supported fields include:
+/// - `queue_capacity`
+/// - `worker_count`
+///
+class async_pool::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "worker_count" field.
+    ///
+    /// The number of worker threads. When unset, `std::thread::hardware_concurrency()` is used (minimum 1).
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) worker_count(std::size_t v);
+
+    ///
+    /// Return the current "worker_count" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) worker_count() const;
+
+    ///
+    /// Set the "queue_capacity" field.
+    ///
+    /// The maximum number of queued operations which have not yet begun executing. When unset, 1024 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) queue_capacity(std::size_t v);
+
+    ///
+    /// Return the current "queue_capacity" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) queue_capacity() const;
+};
+
+#if defined(__cpp_impl_coroutine)
+
+///
+/// An awaitable operation returned by @ref mongocxx::v1::async_pool::co_submit.
+///
+/// @important The associated async pool must outlive this object.
+///
+template <typename T>
+class async_pool::awaitable {
+   private:
+    async_pool* _pool;
+    std::function<T(v1::client&)> _fn;
+    std::promise<T> _promise;
+    std::future<T> _future;
+
+   public:
+    ///
+    /// Initialize with the operation to execute.
+    ///
+    awaitable(async_pool& pool, std::function<T(v1::client&)> fn)
+        : _pool{&pool}, _fn{std::move(fn)}, _future{_promise.get_future()} {}
+
+    ///
+    /// Always suspend the awaiting coroutine.
+    ///
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    ///
+    /// Enqueue the operation and resume `handle` on the worker thread once it has completed and the client object has
+    /// been released.
+    ///
+    void await_suspend(std::coroutine_handle<> handle) {
+        _pool->post(
+            [this](v1::client* client, std::exception_ptr error) {
+                async_pool::complete(_promise, _fn, client, std::move(error));
+            },
+            [handle] { handle.resume(); });
+    }
+
+    ///
+    /// Return the value returned by the operation or rethrow its exception.
+    ///
+    T await_resume() {
+        return _future.get();
+    }
+};
+
+#endif
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::async_pool::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::async_pool.
+///
@@ -30,7 +30,9 @@
 #include <mongocxx/v1/write_concern-fwd.hpp>
 
 #include <bsoncxx/v1/array/value.hpp>
+#include <bsoncxx/v1/array/view.hpp>
 #include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
 #include <bsoncxx/v1/stdx/optional.hpp>
 #include <bsoncxx/v1/types/view.hpp>
 
@@ -97,6 +99,12 @@ class bulk_write {
     class replace_one;
     class delete_one;
     class delete_many;
+    class insert_one_view;
+    class update_one_view;
+    class update_many_view;
+    class replace_one_view;
+    class delete_one_view;
+    class delete_many_view;
     class single;
     class options;
     class result;
@@ -144,6 +152,29 @@ class bulk_write {
     ///
     MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(single const& op);
 
+    ///
+    /// Append a single write operation which references (rather than owns) its documents.
+    ///
+    /// The referenced documents are copied directly into the bulk write operation. They only need to remain valid
+    /// until this function returns.
+    ///
+    /// @throws mongocxx::v1::exception when a client-side error is encountered.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(insert_one_view const& op);
+
+    MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(update_one_view const& op);
+
+    MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(update_many_view const& op);
+
+    MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(replace_one_view const& op);
+
+    MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(delete_one_view const& op);
+
+    MONGOCXX_ABI_EXPORT_CDECL(bulk_write&) append(delete_many_view const& op);
+    /// @}
+    ///
+
     ///
     /// Execute the appended operations.
     ///
@@ -736,6 +767,594 @@ class bulk_write::delete_many {
     /* explicit(false) */ delete_many(void* impl);
 };
 
+///
+/// A single "Insert One" write operation which references (rather than owns) its document.
+///
+/// Equivalent to @ref bulk_write::insert_one, but without copying the referenced document. Only the referenced
+/// document is copied when the operation is appended to a bulk write operation.
+///
+/// @important The referenced document must remain valid until this operation is appended to a bulk write operation.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class bulk_write::insert_one_view {
+   public:
+    ///
+    /// The document to be inserted.
+    ///
+    bsoncxx::v1::document::view value;
+
+    ///
+    /// Initialize with `doc`.
+    ///
+    explicit insert_one_view(bsoncxx::v1::document::view doc) : value{doc} {}
+
+    ///
+    /// Equivalent to `this->value`.
+    ///
+    bsoncxx::v1::document::view document() const {
+        return value;
+    }
+};
+
+///
+/// A single "Update One" write operation which references (rather than owns) its documents.
+///
+/// Equivalent to @ref bulk_write::update_one, but without copying the referenced documents. Only the referenced
+/// documents are copied when the operation is appended to a bulk write operation.
+///
+/// Supported fields include:
+/// - `array_filters` ("arrayFilters")
+/// - `collation`
+/// - `filter`
+/// - `hint`
+/// - `sort`
+/// - `update`
+/// - `upsert`
+///
+/// @important The referenced documents and hint must remain valid until this operation is appended to a bulk write
+/// operation.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class bulk_write::update_one_view {
+   private:
+    bsoncxx::v1::document::view _filter;
+    bsoncxx::v1::document::view _update;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _collation;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> _hint;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _sort;
+    bsoncxx::v1::stdx::optional<bool> _upsert;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::array::view> _array_filters;
+
+   public:
+    ///
+    /// Initialize with the given "filter" and "update" documents.
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    update_one_view(bsoncxx::v1::document::view filter, bsoncxx::v1::document::view update)
+        : _filter{filter}, _update{update} {}
+
+    ///
+    /// Initialize with the given "filter" document and "update" aggregation pipeline.
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    update_one_view(bsoncxx::v1::document::view filter, bsoncxx::v1::array::view update)
+        : _filter{filter}, _update{update} {}
+
+    ///
+    /// Return the current "filter" field.
+    ///
+    bsoncxx::v1::document::view filter() const {
+        return _filter;
+    }
+
+    ///
+    /// Return the current "update" field.
+    ///
+    bsoncxx::v1::document::view update() const {
+        return _update;
+    }
+
+    ///
+    /// Set the "collation" field.
+    ///
+    update_one_view& collation(bsoncxx::v1::document::view v) {
+        _collation = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "collation" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> collation() const {
+        return _collation;
+    }
+
+    ///
+    /// Set the "hint" field.
+    ///
+    /// The hint is either an index specification (a document) or an index name (a string), e.g. as given by
+    /// @ref v1::hint::to_value.
+    ///
+    update_one_view& hint(bsoncxx::v1::types::view v) {
+        _hint = v;
+        return *this;
+    }
+
+    ///
+    /// The hint is referenced rather than owned: a temporary @ref v1::hint would not outlive this operation.
+    ///
+    update_one_view& hint(v1::hint&& v) = delete;
+
+    ///
+    /// Return the current "hint" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> hint() const {
+        return _hint;
+    }
+
+    ///
+    /// Set the "sort" field.
+    ///
+    update_one_view& sort(bsoncxx::v1::document::view v) {
+        _sort = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "sort" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> sort() const {
+        return _sort;
+    }
+
+    ///
+    /// Set the "upsert" field.
+    ///
+    update_one_view& upsert(bool v) {
+        _upsert = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "upsert" field.
+    ///
+    bsoncxx::v1::stdx::optional<bool> upsert() const {
+        return _upsert;
+    }
+
+    ///
+    /// Set the "arrayFilters" field.
+    ///
+    update_one_view& array_filters(bsoncxx::v1::array::view v) {
+        _array_filters = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "arrayFilters" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::array::view> array_filters() const {
+        return _array_filters;
+    }
+};
+
+///
+/// A single "Update Many" write operation which references (rather than owns) its documents.
+///
+/// Equivalent to @ref bulk_write::update_many, but without copying the referenced documents. Only the referenced
+/// documents are copied when the operation is appended to a bulk write operation.
+///
+/// Supported fields include:
+/// - `array_filters` ("arrayFilters")
+/// - `collation`
+/// - `filter`
+/// - `hint`
+/// - `update`
+/// - `upsert`
+///
+/// @important The referenced documents and hint must remain valid until this operation is appended to a bulk write
+/// operation.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class bulk_write::update_many_view {
+   private:
+    bsoncxx::v1::document::view _filter;
+    bsoncxx::v1::document::view _update;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _collation;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> _hint;
+    bsoncxx::v1::stdx::optional<bool> _upsert;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::array::view> _array_filters;
+
+   public:
+    ///
+    /// Initialize with the given "filter" and "update" documents.
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    update_many_view(bsoncxx::v1::document::view filter, bsoncxx::v1::document::view update)
+        : _filter{filter}, _update{update} {}
+
+    ///
+    /// Initialize with the given "filter" document and "update" aggregation pipeline.
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    update_many_view(bsoncxx::v1::document::view filter, bsoncxx::v1::array::view update)
+        : _filter{filter}, _update{update} {}
+
+    ///
+    /// Return the current "filter" field.
+    ///
+    bsoncxx::v1::document::view filter() const {
+        return _filter;
+    }
+
+    ///
+    /// Return the current "update" field.
+    ///
+    bsoncxx::v1::document::view update() const {
+        return _update;
+    }
+
+    ///
+    /// Set the "collation" field.
+    ///
+    update_many_view& collation(bsoncxx::v1::document::view v) {
+        _collation = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "collation" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> collation() const {
+        return _collation;
+    }
+
+    ///
+    /// Set the "hint" field.
+    ///
+    /// The hint is either an index specification (a document) or an index name (a string), e.g. as given by
+    /// @ref v1::hint::to_value.
+    ///
+    update_many_view& hint(bsoncxx::v1::types::view v) {
+        _hint = v;
+        return *this;
+    }
+
+    ///
+    /// The hint is referenced rather than owned: a temporary @ref v1::hint would not outlive this operation.
+    ///
+    update_many_view& hint(v1::hint&& v) = delete;
+
+    ///
+    /// Return the current "hint" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> hint() const {
+        return _hint;
+    }
+
+    ///
+    /// Set the "upsert" field.
+    ///
+    update_many_view& upsert(bool v) {
+        _upsert = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "upsert" field.
+    ///
+    bsoncxx::v1::stdx::optional<bool> upsert() const {
+        return _upsert;
+    }
+
+    ///
+    /// Set the "arrayFilters" field.
+    ///
+    update_many_view& array_filters(bsoncxx::v1::array::view v) {
+        _array_filters = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "arrayFilters" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::array::view> array_filters() const {
+        return _array_filters;
+    }
+};
+
+///
+/// A single "Replace One" write operation which references (rather than owns) its documents.
+///
+/// Equivalent to @ref bulk_write::replace_one, but without copying the referenced documents. Only the referenced
+/// documents are copied when the operation is appended to a bulk write operation.
+///
+/// Supported fields include:
+/// - `collation`
+/// - `filter`
+/// - `hint`
+/// - `replacement`
+/// - `sort`
+/// - `upsert`
+///
+/// @important The referenced documents and hint must remain valid until this operation is appended to a bulk write
+/// operation.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class bulk_write::replace_one_view {
+   private:
+    bsoncxx::v1::document::view _filter;
+    bsoncxx::v1::document::view _replacement;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _collation;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> _hint;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _sort;
+    bsoncxx::v1::stdx::optional<bool> _upsert;
+
+   public:
+    ///
+    /// Initialize with the given "filter" and "replacement" documents.
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    replace_one_view(bsoncxx::v1::document::view filter, bsoncxx::v1::document::view replacement)
+        : _filter{filter}, _replacement{replacement} {}
+
+    ///
+    /// Return the current "filter" field.
+    ///
+    bsoncxx::v1::document::view filter() const {
+        return _filter;
+    }
+
+    ///
+    /// Return the current "replacement" field.
+    ///
+    bsoncxx::v1::document::view replacement() const {
+        return _replacement;
+    }
+
+    ///
+    /// Set the "collation" field.
+    ///
+    replace_one_view& collation(bsoncxx::v1::document::view v) {
+        _collation = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "collation" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> collation() const {
+        return _collation;
+    }
+
+    ///
+    /// Set the "hint" field.
+    ///
+    /// The hint is either an index specification (a document) or an index name (a string), e.g. as given by
+    /// @ref v1::hint::to_value.
+    ///
+    replace_one_view& hint(bsoncxx::v1::types::view v) {
+        _hint = v;
+        return *this;
+    }
+
+    ///
+    /// The hint is referenced rather than owned: a temporary @ref v1::hint would not outlive this operation.
+    ///
+    replace_one_view& hint(v1::hint&& v) = delete;
+
+    ///
+    /// Return the current "hint" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> hint() const {
+        return _hint;
+    }
+
+    ///
+    /// Set the "sort" field.
+    ///
+    replace_one_view& sort(bsoncxx::v1::document::view v) {
+        _sort = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "sort" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> sort() const {
+        return _sort;
+    }
+
+    ///
+    /// Set the "upsert" field.
+    ///
+    replace_one_view& upsert(bool v) {
+        _upsert = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "upsert" field.
+    ///
+    bsoncxx::v1::stdx::optional<bool> upsert() const {
+        return _upsert;
+    }
+};
+
+///
+/// A single "Delete One" write operation which references (rather than owns) its documents.
+///
+/// Equivalent to @ref bulk_write::delete_one, but without copying the referenced documents. Only the referenced
+/// documents are copied when the operation is appended to a bulk write operation.
+///
+/// Supported fields include:
+/// - `collation`
+/// - `filter`
+/// - `hint`
+///
+/// @important The referenced documents and hint must remain valid until this operation is appended to a bulk write
+/// operation.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class bulk_write::delete_one_view {
+   private:
+    bsoncxx::v1::document::view _filter;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _collation;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> _hint;
+
+   public:
+    ///
+    /// Initialize with the given "filter".
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    explicit delete_one_view(bsoncxx::v1::document::view filter) : _filter{filter} {}
+
+    ///
+    /// Return the current "filter" field.
+    ///
+    bsoncxx::v1::document::view filter() const {
+        return _filter;
+    }
+
+    ///
+    /// Set the "collation" field.
+    ///
+    delete_one_view& collation(bsoncxx::v1::document::view v) {
+        _collation = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "collation" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> collation() const {
+        return _collation;
+    }
+
+    ///
+    /// Set the "hint" field.
+    ///
+    /// The hint is either an index specification (a document) or an index name (a string), e.g. as given by
+    /// @ref v1::hint::to_value.
+    ///
+    delete_one_view& hint(bsoncxx::v1::types::view v) {
+        _hint = v;
+        return *this;
+    }
+
+    ///
+    /// The hint is referenced rather than owned: a temporary @ref v1::hint would not outlive this operation.
+    ///
+    delete_one_view& hint(v1::hint&& v) = delete;
+
+    ///
+    /// Return the current "hint" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> hint() const {
+        return _hint;
+    }
+};
+
+///
+/// A single "Delete Many" write operation which references (rather than owns) its documents.
+///
+/// Equivalent to @ref bulk_write::delete_many, but without copying the referenced documents. Only the referenced
+/// documents are copied when the operation is appended to a bulk write operation.
+///
+/// Supported fields include:
+/// - `collation`
+/// - `filter`
+/// - `hint`
+///
+/// @important The referenced documents and hint must remain valid until this operation is appended to a bulk write
+/// operation.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class bulk_write::delete_many_view {
+   private:
+    bsoncxx::v1::document::view _filter;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> _collation;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> _hint;
+
+   public:
+    ///
+    /// Initialize with the given "filter".
+    ///
+    /// @par Postconditions:
+    /// - All other supported fields are "unset" or zero-initialized.
+    ///
+    explicit delete_many_view(bsoncxx::v1::document::view filter) : _filter{filter} {}
+
+    ///
+    /// Return the current "filter" field.
+    ///
+    bsoncxx::v1::document::view filter() const {
+        return _filter;
+    }
+
+    ///
+    /// Set the "collation" field.
+    ///
+    delete_many_view& collation(bsoncxx::v1::document::view v) {
+        _collation = v;
+        return *this;
+    }
+
+    ///
+    /// Return the current "collation" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> collation() const {
+        return _collation;
+    }
+
+    ///
+    /// Set the "hint" field.
+    ///
+    /// The hint is either an index specification (a document) or an index name (a string), e.g. as given by
+    /// @ref v1::hint::to_value.
+    ///
+    delete_many_view& hint(bsoncxx::v1::types::view v) {
+        _hint = v;
+        return *this;
+    }
+
+    ///
+    /// The hint is referenced rather than owned: a temporary @ref v1::hint would not outlive this operation.
+    ///
+    delete_many_view& hint(v1::hint&& v) = delete;
+
+    ///
+    /// Return the current "hint" field.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> hint() const {
+        return _hint;
+    }
+};
+
 ///
 /// A single write operation.
 ///
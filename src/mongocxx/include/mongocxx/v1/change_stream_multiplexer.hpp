@@ -0,0 +1,391 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/change_stream_multiplexer-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/config/export.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Share one change stream per collection among many subscribers in the same process.
+///
+/// The first subscription to a collection opens an upstream change stream which is observed by a background thread
+/// using a client object acquired from the associated pool. The filter of each subscription is evaluated locally
+/// against every event document obtained from the upstream change stream. Matching events are delivered to the queue of
+/// each matching subscription: an event matching multiple subscriptions is stored once and shared by all of them.
+///
+/// When the upstream change stream fails with a resumable (or network) error or is invalidated, it is reestablished
+/// after the latest resume token it reported, so subscriptions do not observe a gap in events. The delay before it is
+/// reestablished is doubled after every consecutive failure. Any other error closes every subscription to the
+/// collection. The upstream change stream is closed when the last subscription to the collection is destroyed.
+///
+/// Filters support the following subset of the query language, applied to the event document (e.g.
+/// `{"operationType": "insert", "fullDocument.status": {"$in": ["A", "B"]}}`):
+/// - implicit equality and dotted field paths,
+/// - `$and`, `$or`, and `$nor`,
+/// - `$eq`, `$ne`, `$gt`, `$gte`, `$lt`, `$lte`, `$in`, `$nin`, `$exists`, and `$not`.
+///
+/// Numeric values are compared by value regardless of their BSON type. Ordered comparisons only match values of the
+/// same kind (numbers, strings, dates, or timestamps). A condition on an array field matches when the array or any of
+/// its elements matches. A dotted field path may only traverse an array by index (e.g. "items.0.q"): an event does not
+/// match a filter which traverses an array by any other field name (e.g. "items.q").
+///
+/// @important The associated pool must outlive this object.
+///
+/// @important Change streams require a replica set or sharded cluster.
+///
+/// @par Thread Safety:
+/// All member functions other than move construction and move assignment may be called concurrently.
+///
+/// @see
+/// - [Change Streams (MongoDB Manual)](https://www.mongodb.com/docs/manual/changeStreams/)
+///
+class change_stream_multiplexer {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+    class subscription;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// All subscriptions are closed. Blocks until all background threads have stopped, which may take up to the
+    /// "maxAwaitTimeMS" of the upstream change streams (or up to the server selection timeout while a change stream is
+    /// being established).
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~change_stream_multiplexer();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() change_stream_multiplexer(change_stream_multiplexer&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(change_stream_multiplexer&) operator=(change_stream_multiplexer&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    change_stream_multiplexer(change_stream_multiplexer const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    change_stream_multiplexer& operator=(change_stream_multiplexer const& other) = delete;
+
+    ///
+    /// Open upstream change streams using client objects acquired from `pool`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::change_stream_multiplexer::errc::invalid_queue_size if
+    /// the queue size is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() change_stream_multiplexer(v1::pool& pool, options const& opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() change_stream_multiplexer(v1::pool& pool);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Subscribe to the events of the collection `coll_name` in the database `db_name` which match `filter`.
+    ///
+    /// Opens the upstream change stream of the collection if not already open. Only events obtained by the upstream
+    /// change stream after this function returns are delivered.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::change_stream_multiplexer::errc::invalid_filter if
+    /// `filter` uses an unsupported query operator, an empty `$and`, `$or`, or `$nor` array, or an array index which
+    /// is out of range.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(subscription) subscribe(
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::document::view filter);
+
+    MONGOCXX_ABI_EXPORT_CDECL(subscription) subscribe(
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name);
+    /// @}
+    ///
+
+    ///
+    /// Return the latest resume token reported by the upstream change stream of the collection `coll_name` in the
+    /// database `db_name`.
+    ///
+    /// The resume token may be used (e.g. with the "resume_after" field of the "change_stream_options" field) to
+    /// restart all upstream change streams after the latest event they obtained. The resume token of an event is only
+    /// reported once the event has been queued by every matching subscription, but it may not yet have been obtained by
+    /// every subscription.
+    ///
+    /// @returns Empty when the collection has no upstream change stream or it has not reported a resume token.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>) resume_token(
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name) const;
+
+    ///
+    /// Return the number of upstream change streams.
+    ///
+    /// An upstream change stream is closed (shortly) after the last subscription to its collection is destroyed or
+    /// after it fails with a non-resumable error.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) upstream_count() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::change_stream_multiplexer.
+    ///
+    enum class errc {
+        zero,               ///< Zero.
+        invalid_queue_size, ///< The queue size must be greater than zero.
+        invalid_filter,     ///< The filter uses an unsupported query operator or an invalid field path.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::change_stream_multiplexer::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+
+    class internal;
+};
+
+///
+/// A subscription to the events of a collection obtained from a @ref mongocxx::v1::change_stream_multiplexer.
+///
+/// Matching events are queued until obtained by @ref try_next or @ref next. When "queue_size" events are waiting to
+/// be obtained, the upstream change stream is blocked until an event is obtained or the subscription is destroyed.
+///
+/// @par Thread Safety:
+/// @ref try_next and @ref next must not be called concurrently.
+///
+class change_stream_multiplexer::subscription {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    /// No further events are delivered to this subscription.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~subscription();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() subscription(subscription&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(subscription&) operator=(subscription&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    subscription(subscription const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    subscription& operator=(subscription const& other) = delete;
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Obtain the next queued event without blocking.
+    ///
+    /// @returns Empty when no event is queued.
+    ///
+    /// @throws The error which closed this subscription (see @ref closed) once every event queued before the error has
+    /// been obtained.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value>) try_next();
+
+    ///
+    /// Obtain the next queued event, blocking for up to `timeout` until an event is queued.
+    ///
+    /// @returns Empty when no event was queued before the timeout expired or the subscription is closed.
+    ///
+    /// @throws The error which closed this subscription (see @ref closed) once every event queued before the error has
+    /// been obtained.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value>) next(
+        std::chrono::milliseconds timeout);
+
+    ///
+    /// Return true when the associated multiplexer has been destroyed or the upstream change stream failed with a
+    /// non-resumable error.
+    ///
+    /// Events queued before the subscription was closed may still be obtained.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) closed() const;
+
+    class internal;
+
+   private:
+    /* explicit(false) */ subscription(void* impl);
+};
+
+///
+/// Options for @ref mongocxx::v1::change_stream_multiplexer.
+///
+/// Supported fields include:
+/// - `change_stream_options`
+/// - `queue_size`
+///
+class change_stream_multiplexer::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "change_stream_options" field.
+    ///
+    /// The options used to open each upstream change stream. The "max_await_time" field (1 second when unset) also
+    /// bounds the delay before a failed upstream change stream is reestablished. The "resume_after", "start_after",
+    /// and "start_at_operation_time" fields are only used until the upstream change stream reports a resume token.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) change_stream_options(v1::change_stream::options v);
+
+    ///
+    /// Return the current "change_stream_options" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::change_stream::options>) change_stream_options() const;
+
+    ///
+    /// Set the "queue_size" field.
+    ///
+    /// The maximum number of events waiting to be obtained by each subscription. When unset, 1024 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) queue_size(std::size_t v);
+
+    ///
+    /// Return the current "queue_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) queue_size() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::change_stream_multiplexer::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::change_stream_multiplexer.
+///
@@ -0,0 +1,38 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+class MONGOCXX_ABI_EXPORT checkpoint_store;
+
+class MONGOCXX_ABI_EXPORT file_checkpoint_store;
+
+class MONGOCXX_ABI_EXPORT collection_checkpoint_store;
+
+} // namespace v1
+} // namespace mongocxx
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Declares @ref mongocxx::v1::checkpoint_store.
+///
@@ -0,0 +1,292 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/checkpoint_store-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/detail/macros.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+BSONCXX_PRIVATE_WARNINGS_PUSH();
+BSONCXX_PRIVATE_WARNINGS_DISABLE(MSVC(4251));
+BSONCXX_PRIVATE_WARNINGS_DISABLE(MSVC(4275));
+
+///
+/// The interface for the durable storage of the resume token of a change stream.
+///
+/// Users may implement this interface to store resume tokens elsewhere than in a file
+/// (@ref mongocxx::v1::file_checkpoint_store) or in a collection (@ref mongocxx::v1::collection_checkpoint_store).
+///
+/// @see
+/// - @ref mongocxx::v1::checkpointer
+/// - [Resume a Change Stream (MongoDB Manual)](https://www.mongodb.com/docs/manual/changeStreams/#resume-a-change-stream)
+///
+class checkpoint_store {
+   public:
+    ///
+    /// Destructor.
+    ///
+    virtual ~checkpoint_store();
+
+    ///
+    /// Move constructor.
+    ///
+    checkpoint_store(checkpoint_store&&) = default;
+
+    ///
+    /// Move assignment operator.
+    ///
+    checkpoint_store& operator=(checkpoint_store&&) = default;
+
+    ///
+    /// Copy constructor.
+    ///
+    checkpoint_store(checkpoint_store const&) = default;
+
+    ///
+    /// Copy assignment operator.
+    ///
+    checkpoint_store& operator=(checkpoint_store const&) = default;
+
+    ///
+    /// Default constructor.
+    ///
+    checkpoint_store() = default;
+
+    ///
+    /// Return the most recently saved resume token.
+    ///
+    /// @returns Empty when no resume token has been saved.
+    ///
+    virtual bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> load() = 0;
+
+    ///
+    /// Durably save `token`, replacing any previously saved resume token.
+    ///
+    /// @note Only invoked by one thread at a time by @ref mongocxx::v1::checkpointer.
+    ///
+    virtual void save(bsoncxx::v1::document::view token) = 0;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::checkpoint_store.
+    ///
+    enum class errc {
+        zero,               ///< Zero.
+        invalid_checkpoint, ///< The saved resume token is not a valid BSON document.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::checkpoint_store::errc.
+    ///
+    static std::error_category const& MONGOCXX_ABI_CDECL error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+};
+
+///
+/// A @ref mongocxx::v1::checkpoint_store which saves the resume token as raw BSON bytes in a file.
+///
+/// The resume token is first written to a temporary file (the path with a ".tmp" suffix) which then replaces the
+/// file, such that an interrupted save never corrupts the previously saved resume token. The temporary file and the
+/// replacement are flushed to durable storage (e.g. via `fsync()` of the file and its directory) before a save
+/// returns.
+///
+class file_checkpoint_store : public checkpoint_store {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    ~file_checkpoint_store() override;
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    file_checkpoint_store(file_checkpoint_store&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    file_checkpoint_store& operator=(file_checkpoint_store&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    file_checkpoint_store(file_checkpoint_store const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    file_checkpoint_store& operator=(file_checkpoint_store const& other) = delete;
+
+    ///
+    /// Save resume tokens in the file at `path`.
+    ///
+    explicit file_checkpoint_store(bsoncxx::v1::stdx::string_view path);
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_CDECL operator bool() const;
+
+    ///
+    /// Return the resume token saved in the file.
+    ///
+    /// @returns Empty when the file does not exist.
+    ///
+    /// @throws mongocxx::v1::exception with a `std::generic_category()` error code if the file could not be read.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::checkpoint_store::errc::invalid_checkpoint if the file
+    /// does not contain a valid BSON document.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> load() override;
+
+    ///
+    /// Save `token` in the file.
+    ///
+    /// @throws mongocxx::v1::exception with a `std::generic_category()` error code if the file could not be written.
+    ///
+    void save(bsoncxx::v1::document::view token) override;
+};
+
+///
+/// A @ref mongocxx::v1::checkpoint_store which saves the resume token in a document of a collection.
+///
+/// The resume token is saved in the "token" field of the document whose "_id" field is equal to the given key. Many
+/// change streams may share a collection by using distinct keys.
+///
+/// @important The associated pool must outlive this object.
+///
+class collection_checkpoint_store : public checkpoint_store {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    ~collection_checkpoint_store() override;
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    collection_checkpoint_store(collection_checkpoint_store&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    collection_checkpoint_store& operator=(collection_checkpoint_store&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    collection_checkpoint_store(collection_checkpoint_store const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    collection_checkpoint_store& operator=(collection_checkpoint_store const& other) = delete;
+
+    ///
+    /// Save resume tokens in the collection `coll_name` of the database `db_name` under the key `key`, using client
+    /// objects acquired from `pool`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    collection_checkpoint_store(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::stdx::string_view key);
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_CDECL operator bool() const;
+
+    ///
+    /// Return the resume token saved in the collection.
+    ///
+    /// @returns Empty when no document with the key exists.
+    ///
+    /// @throws mongocxx::v1::exception when the document could not be obtained from the server.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::checkpoint_store::errc::invalid_checkpoint if the
+    /// "token" field of the document is missing or is not a document.
+    ///
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> load() override;
+
+    ///
+    /// Save `token` in the collection (with an upsert).
+    ///
+    /// @throws mongocxx::v1::exception when the document could not be saved.
+    ///
+    void save(bsoncxx::v1::document::view token) override;
+};
+
+BSONCXX_PRIVATE_WARNINGS_POP();
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::checkpoint_store::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::checkpoint_store.
+///
@@ -0,0 +1,305 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/checkpointer-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/checkpoint_store-fwd.hpp>
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/config/export.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Asynchronously save the resume token of a change stream to a @ref mongocxx::v1::checkpoint_store.
+///
+/// Resume tokens reported via @ref update are coalesced: only the latest resume token is saved by a background thread
+/// once every "flush_interval", or as soon as "flush_count" resume tokens have been reported since the previous save,
+/// whichever comes first. Reporting a resume token never blocks on the checkpoint store.
+///
+/// On restart, @ref configure initializes the change stream options with the latest resume token such that the change
+/// stream resumes after the last saved checkpoint:
+///
+/// ```cpp
+/// mongocxx::v1::file_checkpoint_store store{"orders.token"};
+/// mongocxx::v1::checkpointer checkpointer{store};
+///
+/// mongocxx::v1::change_stream::options opts;
+/// checkpointer.configure(opts);
+///
+/// auto stream = coll.watch(opts);
+///
+/// for (auto const& event : stream) {
+///     process(event);
+///     checkpointer.update(stream);
+/// }
+/// ```
+///
+/// @important The associated checkpoint store must outlive this object.
+///
+/// @par Thread Safety:
+/// All member functions other than move construction and move assignment may be called concurrently.
+///
+class checkpointer {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// Stops the background thread, then saves the latest resume token (if not yet saved). Errors encountered while
+    /// saving the resume token are ignored.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~checkpointer();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() checkpointer(checkpointer&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(checkpointer&) operator=(checkpointer&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    checkpointer(checkpointer const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    checkpointer& operator=(checkpointer const& other) = delete;
+
+    ///
+    /// Save resume tokens to `store`.
+    ///
+    /// @important `store` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::checkpointer::errc::invalid_flush_interval if the flush
+    /// interval is not positive.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::checkpointer::errc::invalid_flush_count if the flush
+    /// count is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() checkpointer(v1::checkpoint_store& store, options const& opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() checkpointer(v1::checkpoint_store& store);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Initialize `opts` to resume after the latest resume token.
+    ///
+    /// The latest resume token is the most recently reported resume token, if any, or else the resume token loaded
+    /// from the checkpoint store. It is assigned to the "resumeAfter" field (or the "startAfter" field, when
+    /// "start_after" is set) and the other resume fields ("resumeAfter", "startAfter", and "startAtOperationTime") are
+    /// unset. `opts` is unmodified when there is no resume token.
+    ///
+    /// @returns true when `opts` was initialized with a resume token.
+    ///
+    /// @throws mongocxx::v1::exception when the resume token could not be loaded from the checkpoint store.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) configure(v1::change_stream::options& opts);
+
+    ///
+    /// Report `token` as the latest resume token.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(void) update(bsoncxx::v1::document::view token);
+
+    ///
+    /// Equivalent to `this->update(*stream.get_resume_token())` when the change stream has a resume token.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) update(v1::change_stream const& stream);
+    /// @}
+    ///
+
+    ///
+    /// Synchronously save the latest resume token (if not yet saved).
+    ///
+    /// @throws mongocxx::v1::exception (or any exception thrown by the checkpoint store) when the resume token could
+    /// not be saved. An exception thrown by the checkpoint store on the background thread since the previous call to
+    /// this function is rethrown if the latest resume token is saved successfully.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) flush();
+
+    ///
+    /// Return the most recently saved resume token, if any.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>) saved() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::checkpointer.
+    ///
+    enum class errc {
+        zero,                   ///< Zero.
+        invalid_flush_interval, ///< The flush interval must be positive.
+        invalid_flush_count,    ///< The flush count must be greater than zero.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::checkpointer::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+};
+
+///
+/// Options for @ref mongocxx::v1::checkpointer.
+///
+/// Supported fields include:
+/// - `flush_count`
+/// - `flush_interval`
+/// - `start_after`
+///
+class checkpointer::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "flush_count" field.
+    ///
+    /// The number of reported resume tokens after which the latest resume token is saved without waiting for the
+    /// flush interval. When unset, 1000 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) flush_count(std::size_t v);
+
+    ///
+    /// Return the current "flush_count" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) flush_count() const;
+
+    ///
+    /// Set the "flush_interval" field.
+    ///
+    /// The maximum delay before a reported resume token is saved. When unset, 1 second is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) flush_interval(std::chrono::milliseconds v);
+
+    ///
+    /// Return the current "flush_interval" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::chrono::milliseconds>) flush_interval() const;
+
+    ///
+    /// Set the "start_after" field.
+    ///
+    /// When true, @ref mongocxx::v1::checkpointer::configure assigns the resume token to the "startAfter" field
+    /// instead of the "resumeAfter" field, which permits resuming after an "invalidate" event. When unset, false is
+    /// used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) start_after(bool v);
+
+    ///
+    /// Return the current "start_after" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bool>) start_after() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::checkpointer::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::checkpointer.
+///
@@ -135,6 +135,11 @@ class client {
     ///
     /// Access the database with the given name.
     ///
+    /// Database and collection handles are cached by this client by name: repeated lookups of the same database (and
+    /// of the same collection via the returned database object) reuse the cached handles.
+    /// At most 64 database handles (and at most 64 collection handles per database) are cached: the cache is cleared
+    /// when a lookup would exceed this limit. Database and collection objects which are still in use are unaffected.
+    ///
     MONGOCXX_ABI_EXPORT_CDECL(v1::database) database(bsoncxx::v1::stdx::string_view name);
 
     ///
@@ -620,6 +620,9 @@ class collection {
     ///
     /// If the document(s) do not contain an "_id" field, an "_id" field is generated using @ref bsoncxx::v1::oid.
     ///
+    /// The document IDs reported by the result are determined by @ref v1::insert_many_options::report_ids. Documents
+    /// which already contain an "_id" field are only copied when their ID is reported.
+    ///
     /// @par Constraints:
     /// - `InputIt` satisfies Cpp17InputIterator.
     /// - The value type of `InputIt` is convertible to @ref bsoncxx::v1::document::view.
@@ -642,11 +645,10 @@ class collection {
     bsoncxx::v1::stdx::optional<v1::insert_many_result>
     insert_many(InputIt begin, Sentinel end, v1::insert_many_options const& opts = {}) {
         v1::bulk_write bulk{this->_create_insert_many(nullptr, opts)};
-        std::vector<bsoncxx::v1::types::value> inserted_ids;
         for (auto iter = begin; iter != end; ++iter) {
-            this->_append_insert_many(bulk, inserted_ids, *iter);
+            this->_append_insert_many(bulk, *iter);
         }
-        return this->_execute_insert_many(bulk, inserted_ids);
+        return this->_execute_insert_many(bulk);
     }
 
     template <
@@ -660,11 +662,10 @@ class collection {
         Sentinel end,
         v1::insert_many_options const& opts = {}) {
         v1::bulk_write bulk{this->_create_insert_many(&session, opts)};
-        std::vector<bsoncxx::v1::types::value> inserted_ids;
         for (auto iter = begin; iter != end; ++iter) {
-            this->_append_insert_many(bulk, inserted_ids, *iter);
+            this->_append_insert_many(bulk, *iter);
         }
-        return this->_execute_insert_many(bulk, inserted_ids);
+        return this->_execute_insert_many(bulk);
     }
     /// @}
     ///
@@ -928,6 +929,14 @@ class collection {
         v1::client_session const* session,
         v1::insert_many_options const& opts);
 
+    static MONGOCXX_ABI_EXPORT_CDECL(void) _append_insert_many(v1::bulk_write& bulk, bsoncxx::v1::document::view doc);
+
+    static MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::insert_many_result>) _execute_insert_many(
+        v1::bulk_write& bulk);
+
+    // For ABI backward compatibility: used by `insert_many()` prior to 4.6.0. Equivalent to the overloads above: the
+    // document IDs are tracked by `bulk`, so `inserted_ids` is unused.
+
     static MONGOCXX_ABI_EXPORT_CDECL(void) _append_insert_many(
         v1::bulk_write& bulk,
         std::vector<bsoncxx::v1::types::value>& inserted_ids,
@@ -0,0 +1,348 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/concurrent_client_bulk_write-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/pipeline-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/client_bulk_write.hpp>
+#include <mongocxx/v1/config/export.hpp>
+
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// A list of bulk write operations across more than one collection which may be executed as several concurrent
+/// bulkWrite commands.
+///
+/// Operations are appended as with @ref mongocxx::v1::client_bulk_write, but are only recorded until @ref execute is
+/// called. When the "ordered" field of the bulk write options is unset or true, every operation is executed in order by
+/// a single @ref mongocxx::v1::client_bulk_write, exactly as if the operations were appended to it directly.
+///
+/// Otherwise, operations are partitioned by namespace into at most "max_concurrency" sub-batches of (approximately)
+/// equal size. Operations targeting the same namespace are always assigned to the same sub-batch and retain their
+/// relative order. Each sub-batch is executed by a @ref mongocxx::v1::client_bulk_write using a distinct client object
+/// acquired from the associated pool, concurrently with the other sub-batches. The results and errors of every
+/// sub-batch are then merged such that model indexes (e.g. the keys of
+/// @ref mongocxx::v1::client_bulk_write::result::insert_results and
+/// @ref mongocxx::v1::client_bulk_write::exception::write_errors) refer to the order in which operations were
+/// appended to this object.
+///
+/// ```cpp
+/// mongocxx::v1::concurrent_client_bulk_write bulk{pool};
+///
+/// using models = mongocxx::v1::client_bulk_write;
+///
+/// bulk.append("db.a", doc, models::insert_one_options{});
+/// bulk.append("db.b", filter, models::delete_many_options{});
+///
+/// auto const res = bulk.execute(models::options{}.ordered(false));
+/// ```
+///
+/// @note Operations are not executed within a session.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @par Thread Safety:
+/// No member functions may be called concurrently, including @ref append while @ref execute is in progress. The
+/// sub-batches are executed on separate threads internally, but @ref execute blocks until all of them complete.
+///
+/// @see
+/// - [bulkWrite (MongoDB Manual)](https://www.mongodb.com/docs/manual/reference/command/bulkWrite/)
+///
+class concurrent_client_bulk_write {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~concurrent_client_bulk_write();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() concurrent_client_bulk_write(concurrent_client_bulk_write&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) operator=(concurrent_client_bulk_write&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    concurrent_client_bulk_write(concurrent_client_bulk_write const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    concurrent_client_bulk_write& operator=(concurrent_client_bulk_write const& other) = delete;
+
+    ///
+    /// Execute bulk write operations with client objects acquired from `pool`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with
+    /// @ref mongocxx::v1::concurrent_client_bulk_write::errc::invalid_max_concurrency if the maximum number of
+    /// concurrent sub-batches is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() concurrent_client_bulk_write(v1::pool& pool, options const& opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() concurrent_client_bulk_write(v1::pool& pool);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Append an "Insert One" operation targeting the given namespace.
+    ///
+    /// `document` and `opts` are copied. Client-side errors are only reported by @ref execute.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view document,
+        v1::client_bulk_write::insert_one_options const& opts);
+
+    ///
+    /// Append an "Update One" operation targeting the given namespace.
+    ///
+    /// `filter`, `update`, and `opts` are copied. Client-side errors are only reported by @ref execute.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        bsoncxx::v1::document::view update,
+        v1::client_bulk_write::update_one_options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        v1::pipeline const& update,
+        v1::client_bulk_write::update_one_options const& opts);
+    /// @}
+    ///
+
+    ///
+    /// Append an "Update Many" operation targeting the given namespace.
+    ///
+    /// `filter`, `update`, and `opts` are copied. Client-side errors are only reported by @ref execute.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        bsoncxx::v1::document::view update,
+        v1::client_bulk_write::update_many_options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        v1::pipeline const& update,
+        v1::client_bulk_write::update_many_options const& opts);
+    /// @}
+    ///
+
+    ///
+    /// Append a "Replace One" operation targeting the given namespace.
+    ///
+    /// `filter`, `replacement`, and `opts` are copied. Client-side errors are only reported by @ref execute.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        bsoncxx::v1::document::view replacement,
+        v1::client_bulk_write::replace_one_options const& opts);
+
+    ///
+    /// Append a "Delete One" operation targeting the given namespace.
+    ///
+    /// `filter` and `opts` are copied. Client-side errors are only reported by @ref execute.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        v1::client_bulk_write::delete_one_options const& opts);
+
+    ///
+    /// Append a "Delete Many" operation targeting the given namespace.
+    ///
+    /// `filter` and `opts` are copied. Client-side errors are only reported by @ref execute.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(concurrent_client_bulk_write&) append(
+        bsoncxx::v1::stdx::string_view ns,
+        bsoncxx::v1::document::view filter,
+        v1::client_bulk_write::delete_many_options const& opts);
+
+    ///
+    /// Return the number of operations appended since construction or the last call to @ref execute.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) size() const;
+
+    ///
+    /// Execute the appended operations.
+    ///
+    /// Blocks until every sub-batch has been executed (or failed). The appended operations are cleared, such that
+    /// operations may continue to be appended afterwards.
+    ///
+    /// When unordered and a sub-batch fails, the other sub-batches are still executed to completion. The thrown
+    /// exception then contains the error (and server reply) of the first failed sub-batch, the write errors and write
+    /// concern errors of every failed sub-batch, and the combined results of every successful sub-batch (and partial
+    /// result of every failed sub-batch) as its partial result.
+    ///
+    /// @returns Empty when the bulk write operation is unacknowledged.
+    ///
+    /// @throws mongocxx::v1::client_bulk_write::exception when a bulk write error (or, when unordered, any other
+    /// @ref mongocxx::v1::exception) is encountered.
+    /// @throws mongocxx::v1::exception for all other runtime errors.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::client_bulk_write::result>) execute(
+        v1::client_bulk_write::options const& opts);
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::concurrent_client_bulk_write.
+    ///
+    enum class errc {
+        zero,                    ///< Zero.
+        invalid_max_concurrency, ///< The maximum number of concurrent sub-batches must be greater than zero.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::concurrent_client_bulk_write::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+
+    class internal;
+};
+
+///
+/// Options for @ref mongocxx::v1::concurrent_client_bulk_write.
+///
+/// Supported fields include:
+/// - `max_concurrency`
+///
+class concurrent_client_bulk_write::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "max_concurrency" field.
+    ///
+    /// The maximum number of sub-batches (and client objects) used to execute unordered operations. When unset, 4 is
+    /// used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_concurrency(std::size_t v);
+
+    ///
+    /// Return the current "max_concurrency" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) max_concurrency() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::concurrent_client_bulk_write::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::concurrent_client_bulk_write.
+///
@@ -24,7 +24,9 @@
 
 #include <mongocxx/v1/config/export.hpp>
 
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
 
 namespace mongocxx {
@@ -66,6 +68,7 @@ class cursor {
     };
 
     class iterator;
+    struct prefetch_stats;
 
     ///
     /// Destroy this object.
@@ -125,6 +128,32 @@ class cursor {
     ///
     iterator end() const;
 
+    ///
+    /// Prefetch result documents on a background thread.
+    ///
+    /// A background thread advances the underlying cursor (issuing "getMore" commands as needed) to fill a buffer of up
+    /// to `buffer_size` result documents while the current buffer is being consumed. Once the current buffer is
+    /// exhausted, the buffers are swapped. The current thread only blocks when the next buffer is not yet available.
+    ///
+    /// Has no effect if prefetching is already enabled, if this is a tailable cursor, or if there are no more result
+    /// documents.
+    ///
+    /// @important While prefetching is enabled, the underlying cursor is advanced by the background thread. The client
+    /// object associated with this cursor must not be used by any other operation until this cursor is destroyed. Use
+    /// a client object dedicated to this cursor (e.g. acquired from a @ref mongocxx::v1::pool).
+    ///
+    /// @note Server-side errors encountered by the background thread are thrown when the iterator is advanced past the
+    /// last result document obtained before the error.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) enable_prefetch(std::size_t buffer_size = 1000u);
+
+    ///
+    /// Return statistics describing the effectiveness of prefetching.
+    ///
+    /// @returns Zero-initialized statistics when prefetching is not enabled.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(prefetch_stats) stats() const;
+
     class internal;
 
    private:
@@ -270,6 +299,31 @@ class cursor::iterator {
     /* explicit(false) */ iterator(void* impl);
 };
 
+///
+/// Statistics describing the effectiveness of prefetching by a @ref mongocxx::v1::cursor.
+///
+struct cursor::prefetch_stats {
+    ///
+    /// The number of result documents obtained from prefetched buffers.
+    ///
+    std::int64_t documents = 0;
+
+    ///
+    /// The number of prefetched buffers which were swapped in.
+    ///
+    std::int64_t buffers = 0;
+
+    ///
+    /// The number of times the current thread blocked because the next buffer was not yet available.
+    ///
+    std::int64_t waits = 0;
+
+    ///
+    /// The total time the current thread spent blocked waiting for the next buffer.
+    ///
+    std::chrono::nanoseconds wait_time{0};
+};
+
 inline cursor::iterator cursor::end() const {
     return {};
 }
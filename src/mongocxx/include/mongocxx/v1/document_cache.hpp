@@ -0,0 +1,325 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/document_cache-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// A read-through cache of documents in a database, keyed by collection name and "_id" field.
+///
+/// Documents are obtained from the server on a cache miss and stored as immutable BSON bytes. When the total size of
+/// cached documents exceeds "max_size", the least recently used documents are evicted.
+///
+/// The cache is kept coherent by a database-level change stream observed by a background thread using a client object
+/// acquired from the associated pool:
+/// - update, replace, and delete events evict the corresponding document, and
+/// - invalidate, drop, rename, and dropDatabase events evict all documents.
+///
+/// Documents are only cached while the change stream is established. When the change stream fails (e.g. it cannot be
+/// resumed), all documents are evicted and documents are not cached until the change stream is reestablished.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @important The change stream requires a replica set or sharded cluster. Against a standalone server, every
+/// lookup is a cache miss.
+///
+/// @important Documents are cached under the exact BSON type and value of their "_id" field. A lookup by an "_id"
+/// value of a different (e.g. numeric) BSON type is always a cache miss.
+///
+/// @par Thread Safety:
+/// All member functions other than move construction and move assignment may be called concurrently.
+///
+/// @see
+/// - [Change Streams (MongoDB Manual)](https://www.mongodb.com/docs/manual/changeStreams/)
+///
+class document_cache {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+    struct cache_stats;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// Blocks until the background thread has stopped, which may take up to "max_await_time" (or up to the server
+    /// selection timeout while the change stream is being established).
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~document_cache();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() document_cache(document_cache&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(document_cache&) operator=(document_cache&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    document_cache(document_cache const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    document_cache& operator=(document_cache const& other) = delete;
+
+    ///
+    /// Cache documents in the database `db_name`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::document_cache::errc::invalid_max_size if the maximum
+    /// size is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() document_cache(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL() document_cache(v1::pool& pool, bsoncxx::v1::stdx::string_view db_name);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Return the document in the collection `coll_name` whose "_id" field is equal to `id`.
+    ///
+    /// On a cache miss, the document is obtained from the server using a client object acquired from the associated
+    /// pool. A document which is not found is not cached.
+    ///
+    /// @returns Empty when no matching document was found.
+    ///
+    /// @throws mongocxx::v1::exception when the document could not be obtained from the server.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value>) find_one(
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::types::view id);
+
+    ///
+    /// Evict the document in the collection `coll_name` whose "_id" field is equal to `id`, if cached.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) evict(bsoncxx::v1::stdx::string_view coll_name, bsoncxx::v1::types::view id);
+
+    ///
+    /// Evict all documents.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) clear();
+
+    ///
+    /// Return true when the change stream is currently established and documents may be cached.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bool) watching() const;
+
+    ///
+    /// Return a snapshot of the statistics of this cache.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(cache_stats) stats() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::document_cache.
+    ///
+    enum class errc {
+        zero,             ///< Zero.
+        invalid_max_size, ///< The maximum size must be greater than zero.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::document_cache::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+
+    class internal;
+};
+
+///
+/// Statistics describing the effectiveness of a @ref mongocxx::v1::document_cache.
+///
+struct document_cache::cache_stats {
+    ///
+    /// The number of lookups which were satisfied by a cached document.
+    ///
+    std::int64_t hits = 0;
+
+    ///
+    /// The number of lookups which required obtaining the document from the server.
+    ///
+    std::int64_t misses = 0;
+
+    ///
+    /// The number of documents evicted to satisfy the maximum size.
+    ///
+    std::int64_t evictions = 0;
+
+    ///
+    /// The number of documents evicted due to change events or explicit eviction.
+    ///
+    std::int64_t invalidations = 0;
+
+    ///
+    /// The number of times all documents were evicted.
+    ///
+    std::int64_t flushes = 0;
+
+    ///
+    /// The number of currently cached documents.
+    ///
+    std::size_t entries = 0;
+
+    ///
+    /// The approximate total size in bytes of currently cached documents.
+    ///
+    std::size_t size = 0;
+};
+
+///
+/// Options for @ref mongocxx::v1::document_cache.
+///
+/// Supported fields include:
+/// - `max_await_time`
+/// - `max_size`
+///
+class document_cache::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "max_await_time" field.
+    ///
+    /// The "maxAwaitTimeMS" of the change stream, which also bounds the delay before the change stream is
+    /// reestablished after a failure and the time required to destroy the cache. When unset, 1 second is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_await_time(std::chrono::milliseconds v);
+
+    ///
+    /// Return the current "max_await_time" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::chrono::milliseconds>) max_await_time() const;
+
+    ///
+    /// Set the "max_size" field.
+    ///
+    /// The maximum approximate total size in bytes of cached documents. When unset, 64 MiB is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_size(std::size_t v);
+
+    ///
+    /// Return the current "max_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) max_size() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::document_cache::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::document_cache.
+///
@@ -28,6 +28,7 @@
 #include <mongocxx/v1/gridfs/downloader-fwd.hpp>
 #include <mongocxx/v1/gridfs/upload_result-fwd.hpp>
 #include <mongocxx/v1/gridfs/uploader-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
 #include <mongocxx/v1/read_concern-fwd.hpp>
 #include <mongocxx/v1/read_preference-fwd.hpp>
 #include <mongocxx/v1/write_concern-fwd.hpp>
@@ -190,6 +191,54 @@ class bucket {
     /// @}
     ///
 
+    ///
+    /// Equivalent to @ref upload_from_file_with_id with a file ID generated using @ref bsoncxx::v1::oid.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(v1::gridfs::upload_result) upload_from_file(
+        bsoncxx::v1::stdx::string_view filename,
+        bsoncxx::v1::stdx::string_view path,
+        v1::gridfs::upload_options const& opts = {});
+
+    MONGOCXX_ABI_EXPORT_CDECL(v1::gridfs::upload_result) upload_from_file(
+        v1::client_session const& session,
+        bsoncxx::v1::stdx::string_view filename,
+        bsoncxx::v1::stdx::string_view path,
+        v1::gridfs::upload_options const& opts = {});
+    /// @}
+    ///
+
+    ///
+    /// Upload the contents of the file at `path` as a new file to this bucket.
+    ///
+    /// Equivalent to @ref upload_from_stream_with_id with an input stream reading the file at `path`. However, on POSIX
+    /// platforms, the file is memory-mapped (one region at a time, with a sequential access hint) and each chunk
+    /// document is built directly from the mapped pages, such that the contents of the file are copied only once.
+    ///
+    /// @important The file must not be truncated while it is being uploaded.
+    ///
+    /// @throws mongocxx::v1::exception with a @ref std::generic_category() error code if the file cannot be opened, is
+    /// not a regular file, or cannot be memory-mapped. The upload stream is not opened when the file cannot be opened.
+    /// @throws std::ios_base::failure if an error is encountered when reading the file (when not memory-mapped).
+    /// @throws mongocxx::v1::server_error when a server-side error is encountered and a raw server error is available.
+    /// @throws mongocxx::v1::exception for all other runtime errors.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(void) upload_from_file_with_id(
+        bsoncxx::v1::types::view id,
+        bsoncxx::v1::stdx::string_view filename,
+        bsoncxx::v1::stdx::string_view path,
+        v1::gridfs::upload_options const& opts = {});
+
+    MONGOCXX_ABI_EXPORT_CDECL(void) upload_from_file_with_id(
+        v1::client_session const& session,
+        bsoncxx::v1::types::view id,
+        bsoncxx::v1::stdx::string_view filename,
+        bsoncxx::v1::stdx::string_view path,
+        v1::gridfs::upload_options const& opts = {});
+    /// @}
+    ///
+
     ///
     /// Return a downloader for the requested file from this bucket.
     ///
@@ -254,6 +303,81 @@ class bucket {
     /// @}
     ///
 
+    ///
+    /// Download the entire contents of the requested file from this bucket into the file at `path`.
+    ///
+    /// The file at `path` is created if it does not exist and truncated otherwise. Storage for the file is preallocated
+    /// (where supported) and each chunk is written directly at its offset within the file (as if by `pwrite()`) with no
+    /// intermediate buffering.
+    ///
+    /// The requested file is looked up before the file at `path` is opened. The contents of the file at `path` are
+    /// unspecified if an exception is thrown after it is opened.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::gridfs::bucket::errc::not_found if the requested file
+    /// does not exist.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::gridfs::bucket::errc::corrupt_data if the
+    /// GridFS file data is invalid or inconsistent.
+    /// @throws mongocxx::v1::exception with a @ref std::generic_category() error code if the file at `path` cannot be
+    /// opened or written to.
+    /// @throws mongocxx::v1::server_error when a server-side error is encountered and a raw server error is available.
+    /// @throws mongocxx::v1::exception for all other runtime errors.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(void) download_to_file(bsoncxx::v1::types::view id, bsoncxx::v1::stdx::string_view path);
+
+    MONGOCXX_ABI_EXPORT_CDECL(void) download_to_file(
+        v1::client_session const& session,
+        bsoncxx::v1::types::view id,
+        bsoncxx::v1::stdx::string_view path);
+    /// @}
+    ///
+
+    ///
+    /// Download the entire contents of the requested file from this bucket into the file referred to by `fd`.
+    ///
+    /// Equivalent to @ref download_to_file(bsoncxx::v1::types::view id, bsoncxx::v1::stdx::string_view path), but the
+    /// contents are written at the byte offsets `[0, length)` of the already-open file descriptor `fd`, which must
+    /// refer to a regular file opened for writing. The file offset of `fd` is unspecified after this operation. `fd` is
+    /// not closed.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(void) download_to_file(bsoncxx::v1::types::view id, int fd);
+
+    MONGOCXX_ABI_EXPORT_CDECL(void)
+    download_to_file(v1::client_session const& session, bsoncxx::v1::types::view id, int fd);
+    /// @}
+    ///
+
+    ///
+    /// Download the entire contents of the requested file from this bucket into the file at `path` (or referred to by
+    /// `fd`) using up to `max_concurrency` concurrent cursors.
+    ///
+    /// Equivalent to @ref download_to_file(bsoncxx::v1::types::view id, bsoncxx::v1::stdx::string_view path), but the
+    /// chunks are partitioned into up to `max_concurrency` contiguous ranges, each of which is fetched by its own
+    /// cursor on its own thread and written at its offsets within the file in any order.
+    ///
+    /// The first range is fetched by this bucket on the calling thread. The other ranges are fetched with client
+    /// objects acquired from `pool` without waiting (as if by @ref mongocxx::v1::pool::try_acquire): fewer ranges are
+    /// used when fewer client objects are available. The read concern and read preference of this bucket are applied
+    /// to each cursor.
+    ///
+    /// @important `pool` must be connected to the same deployment as the client object this bucket was obtained from.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::gridfs::bucket::errc::invalid_max_concurrency if
+    /// `max_concurrency` is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(void) download_to_file(
+        v1::pool& pool,
+        bsoncxx::v1::types::view id,
+        bsoncxx::v1::stdx::string_view path,
+        std::size_t max_concurrency);
+
+    MONGOCXX_ABI_EXPORT_CDECL(void)
+    download_to_file(v1::pool& pool, bsoncxx::v1::types::view id, int fd, std::size_t max_concurrency);
+    /// @}
+    ///
+
     ///
     /// Delete the requested file from this bucket.
     ///
@@ -298,6 +422,7 @@ class bucket {
         not_found,                ///< The requested GridFS file does not exist.
         corrupt_data,             ///< The GridFS file is in an invalid or inconsistent state.
         invalid_byte_range, ///< [start, end) must be a valid range of byte indexes within the requested GridFS file.
+        invalid_max_concurrency, ///< The maximum concurrency must be a positive value.
     };
 
     ///
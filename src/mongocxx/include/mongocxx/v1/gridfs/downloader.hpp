@@ -129,6 +129,10 @@ class downloader {
     /// underlying GridFS download stream was already closed.
     /// @throws mongocxx::v1::exception with @ref mongocxx::v1::gridfs::downloader::errc::corrupt_data if the
     /// GridFS file data is invalid or inconsistent.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::gridfs::downloader::errc::digest_mismatch if the final
+    /// byte of the file is read (or the file is empty), the file was read from its first byte, and its contents do not
+    /// match the content digest stored in the files document by an uploader (see
+    /// @ref mongocxx::v1::gridfs::upload_options::content_digest).
     /// @throws mongocxx::v1::server_error when a server-side error is encountered and a raw server error is available.
     ///
     MONGOCXX_ABI_EXPORT_CDECL(std::size_t) read(std::uint8_t* data, std::size_t length);
@@ -137,9 +141,10 @@ class downloader {
     /// Errors codes which may be returned by @ref mongocxx::v1::gridfs::downloader.
     ///
     enum class errc {
-        zero,         ///< Zero.
-        is_closed,    ///< The GridFS file download stream is not open.
-        corrupt_data, ///< The GridFS file is in an invalid or inconsistent state.
+        zero,            ///< Zero.
+        is_closed,       ///< The GridFS file download stream is not open.
+        corrupt_data,    ///< The GridFS file is in an invalid or inconsistent state.
+        digest_mismatch, ///< The contents of the GridFS file do not match its stored content digest.
     };
 
     ///
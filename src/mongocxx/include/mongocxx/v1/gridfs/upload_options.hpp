@@ -38,6 +38,7 @@ namespace gridfs {
 ///
 /// Supported fields include:
 /// - `chunk_size_bytes` ("chunkSizeBytes")
+/// - `content_digest`
 /// - `metadata` ("metadata")
 ///
 /// @see
@@ -110,6 +111,31 @@ class upload_options {
     ///
     MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view>) metadata() const;
 
+    ///
+    /// A content digest which may be computed while a file is uploaded.
+    ///
+    enum class digest_algorithm {
+        k_sha256, ///< SHA-256 (FIPS 180-4), stored as a lowercase hexadecimal string in "metadata.sha256".
+    };
+
+    ///
+    /// Set the content digest to compute while the file is uploaded.
+    ///
+    /// The digest is computed incrementally from the bytes given to @ref mongocxx::v1::gridfs::uploader::write and is
+    /// stored in the "metadata" field of the files document when the upload is closed, together with the field
+    /// "metadata.contentDigest" set to the name of the algorithm (e.g. `"sha256"`). Both fields replace any fields with
+    /// the same names in the user-provided metadata. Where supported by the CPU, the digest is hardware-accelerated.
+    ///
+    /// A @ref mongocxx::v1::gridfs::downloader which reads the entire file verifies its contents against the stored
+    /// digest only when "metadata.contentDigest" is present. Hexadecimal digits are compared case-insensitively.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(upload_options&) content_digest(digest_algorithm v);
+
+    ///
+    /// Return the current content digest.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<digest_algorithm>) content_digest() const;
+
     class internal;
 };
 
@@ -43,6 +43,9 @@ namespace v1 {
 /// - `read_concern` ("readConcern")
 /// - `write_concern` ("writeConcern")
 ///
+/// The `report_ids` field is not sent to the server: it only determines which document IDs are reported by
+/// @ref mongocxx::v1::insert_many_result::inserted_ids.
+///
 /// @see
 /// - [Insert Methods (MongoDB Manual)](https://www.mongodb.com/docs/manual/reference/insert-methods/)
 ///
@@ -52,6 +55,31 @@ class insert_many_options {
     void* _impl;
 
    public:
+    ///
+    /// The document IDs to report in the result of an "insertMany" operation.
+    ///
+    enum class id_mode {
+        ///
+        /// Report the ID of every inserted document.
+        ///
+        k_all,
+
+        ///
+        /// Only report the IDs generated for documents without an "_id" field.
+        ///
+        /// The ID of every other document is the "_id" field of the document at the same index in the input range.
+        ///
+        k_generated,
+
+        ///
+        /// Do not report any IDs.
+        ///
+        /// Documents are not copied prior to being appended to the bulk write operation. An "_id" field is still
+        /// generated for documents without one, but it is not reported.
+        ///
+        k_none,
+    };
+
     ///
     /// Destroy this object.
     ///
@@ -143,6 +171,18 @@ class insert_many_options {
     ///
     MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view>) comment() const;
 
+    ///
+    /// Set the document IDs to report in the result.
+    ///
+    /// When unset, equivalent to @ref id_mode::k_all.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(insert_many_options&) report_ids(id_mode v);
+
+    ///
+    /// Return the current document IDs to report in the result.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<id_mode>) report_ids() const;
+
     class internal;
 };
 
@@ -97,6 +97,8 @@ class insert_many_result {
     ///
     /// Return a map from the operation index to the inserted document ID.
     ///
+    /// Only contains the document IDs reported as determined by @ref v1::insert_many_options::report_ids.
+    ///
     MONGOCXX_ABI_EXPORT_CDECL(id_map) inserted_ids() const;
 
     ///
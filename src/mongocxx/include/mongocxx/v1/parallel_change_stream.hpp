@@ -0,0 +1,287 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/parallel_change_stream-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/change_stream-fwd.hpp>
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Consume the events of a change stream using multiple threads in parallel.
+///
+/// Each event is assigned to one of several partitions by the hash of its "documentKey" field. Each partition is
+/// processed by a separate thread in the order its events were obtained from the change stream: events for the same
+/// document are always processed in order, while events for different documents may be processed concurrently.
+///
+/// Events without a "documentKey" field (e.g. "drop", "rename", or "invalidate" events) apply to more than one
+/// document: they are only processed once all preceding events have been processed, and no subsequent event is
+/// processed until they have been processed.
+///
+/// The resume token of the latest event such that it and every preceding event have been processed is tracked by
+/// @ref resume_token. Resuming a change stream after this resume token (e.g. after a restart) never skips an event
+/// which has not been processed.
+///
+/// @important The associated change stream must outlive this object.
+///
+/// @par Thread Safety:
+/// @ref stop and @ref resume_token may be called concurrently (including by the callback passed to @ref run).
+///
+/// @see
+/// - [Resume a Change Stream (MongoDB Manual)](https://www.mongodb.com/docs/manual/changeStreams/#resume-a-change-stream)
+///
+class parallel_change_stream {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+
+    ///
+    /// The callback invoked for each event delivered by @ref run.
+    ///
+    /// `partition` is the index of the partition containing `event`.
+    ///
+    using callback_type = std::function<void(std::size_t partition, bsoncxx::v1::document::view event)>;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// @warning All calls to @ref run must have returned.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~parallel_change_stream();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() parallel_change_stream(parallel_change_stream&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(parallel_change_stream&) operator=(parallel_change_stream&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    parallel_change_stream(parallel_change_stream const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    parallel_change_stream& operator=(parallel_change_stream const& other) = delete;
+
+    ///
+    /// Consume the events of `stream`.
+    ///
+    /// @important `stream` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_change_stream::errc::invalid_partition_count
+    /// if the partition count is zero.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_change_stream::errc::invalid_queue_size if the
+    /// queue size is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() parallel_change_stream(v1::change_stream& stream, options const& opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() parallel_change_stream(v1::change_stream& stream);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Return the number of partitions.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) partition_count() const;
+
+    ///
+    /// Obtain events from the associated change stream on the current thread and invoke `fn` for each event on the
+    /// thread processing its partition.
+    ///
+    /// The current thread is blocked while "queue_size" events of the same partition are waiting to be processed.
+    ///
+    /// Blocks the current thread until @ref stop is called, an "invalidate" event has been processed, or an error
+    /// occurs. Once stopped, the events already obtained from the change stream are processed before returning. When
+    /// obtaining an event fails or `fn` throws an exception, the remaining events are not processed and the first
+    /// exception is rethrown.
+    ///
+    /// @warning This function must not be called concurrently.
+    ///
+    /// @throws mongocxx::v1::server_error when a server-side error is encountered.
+    /// @throws mongocxx::v1::exception when an event could not be obtained from the change stream.
+    /// @throws Any exception thrown by `fn`.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) run(callback_type const& fn);
+
+    ///
+    /// Request the current (or next) call to @ref run to return.
+    ///
+    /// Events which are not yet obtained from the change stream are not processed.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) stop();
+
+    ///
+    /// Return the resume token of the latest event such that it and every preceding event have been processed.
+    ///
+    /// When the change stream is idle and every event has been processed, the resume token of the change stream (e.g.
+    /// the post-batch resume token) is returned instead.
+    ///
+    /// @returns Empty when no event has been processed and the change stream has not reported a resume token.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>) resume_token() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::parallel_change_stream.
+    ///
+    enum class errc {
+        zero,                    ///< Zero.
+        invalid_partition_count, ///< The partition count must be greater than zero.
+        invalid_queue_size,      ///< The queue size must be greater than zero.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::parallel_change_stream::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+};
+
+///
+/// Options for @ref mongocxx::v1::parallel_change_stream.
+///
+/// Supported fields include:
+/// - `partition_count`
+/// - `queue_size`
+///
+class parallel_change_stream::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "partition_count" field.
+    ///
+    /// The number of partitions (and threads). When unset, `std::thread::hardware_concurrency()` (or 1) is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) partition_count(std::size_t v);
+
+    ///
+    /// Return the current "partition_count" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) partition_count() const;
+
+    ///
+    /// Set the "queue_size" field.
+    ///
+    /// The maximum number of events of each partition waiting to be processed. When unset, 1024 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) queue_size(std::size_t v);
+
+    ///
+    /// Return the current "queue_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) queue_size() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::parallel_change_stream::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::parallel_change_stream.
+///
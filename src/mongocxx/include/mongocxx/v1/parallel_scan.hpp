@@ -0,0 +1,390 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/parallel_scan-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/find_options-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/array/value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Scan a collection using multiple cursors in parallel.
+///
+/// The values of a partition key (the "_id" field by default) are split into contiguous ranges, one per partition.
+/// Each partition is scanned by a separate cursor on a separate thread using a client object acquired from the
+/// associated pool. Every document matching the filter is delivered exactly once.
+///
+/// The split points between partitions are either user-provided or sampled from the collection using the "$sample"
+/// aggregation stage. Only values with the same BSON type as the split points are split into ranges: documents whose
+/// partition key has a different BSON type or is missing are all delivered by the first partition.
+///
+/// Documents whose partition key is an array, or whose path to the partition key traverses an array (e.g. "a.b" where
+/// "a" is an array of embedded documents), are also delivered by the first partition, as each comparison of a range
+/// may otherwise be satisfied by a different element of the array.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @par Thread Safety:
+/// @ref for_each, @ref for_each_partition, and @ref partition_filters may be called concurrently.
+///
+/// @see
+/// - [$sample (MongoDB Manual)](https://www.mongodb.com/docs/manual/reference/operator/aggregation/sample/)
+///
+class parallel_scan {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+
+    ///
+    /// The callback invoked for each document delivered by @ref for_each.
+    ///
+    using callback_type = std::function<void(bsoncxx::v1::document::view doc)>;
+
+    ///
+    /// The callback invoked for each document delivered by @ref for_each_partition.
+    ///
+    /// `partition` is the index of the partition containing `doc`.
+    ///
+    using partition_callback_type = std::function<void(std::size_t partition, bsoncxx::v1::document::view doc)>;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// @warning All calls to @ref for_each and @ref for_each_partition must have returned.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~parallel_scan();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() parallel_scan(parallel_scan&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(parallel_scan&) operator=(parallel_scan&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    parallel_scan(parallel_scan const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    parallel_scan& operator=(parallel_scan const& other) = delete;
+
+    ///
+    /// Scan the collection `coll_name` in the database `db_name`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_scan::errc::invalid_partition_count if the
+    /// partition count is zero.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_scan::errc::invalid_key if the partition key
+    /// is empty.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_scan::errc::invalid_sample_size if the sample
+    /// size is not positive.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_scan::errc::invalid_boundaries if the
+    /// user-provided split points do not all have the same BSON type, are not strictly ascending, or have a BSON type
+    /// other than double, string, ObjectId, bool, date, 32-bit integer, timestamp, or 64-bit integer.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::parallel_scan::errc::invalid_find_options if the find
+    /// options specify a limit, skip, or sort.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() parallel_scan(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL() parallel_scan(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Return the filter used to scan each partition, in partition order.
+    ///
+    /// When the split points are not user-provided, they are sampled from the collection using a client object
+    /// acquired from the associated pool. Fewer partitions than requested are returned when the sample does not
+    /// contain enough distinct values.
+    ///
+    /// @throws mongocxx::v1::exception when the split points could not be sampled.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::vector<bsoncxx::v1::document::value>) partition_filters() const;
+
+    ///
+    /// Scan all partitions in parallel and invoke `fn` for each document on the thread scanning its partition.
+    ///
+    /// `fn` may be invoked concurrently for documents of different partitions. Documents within a partition are
+    /// delivered in the order they are returned by the partition's cursor.
+    ///
+    /// Blocks the current thread until all partitions have been scanned. When scanning any partition fails or `fn`
+    /// throws an exception, the remaining partitions stop scanning and the first exception is rethrown.
+    ///
+    /// @throws mongocxx::v1::exception when the split points could not be sampled.
+    /// @throws mongocxx::v1::exception when a partition could not be scanned.
+    /// @throws Any exception thrown by `fn`.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) for_each_partition(partition_callback_type const& fn) const;
+
+    ///
+    /// Scan all partitions in parallel and invoke `fn` for each document on the current thread.
+    ///
+    /// Documents from all partitions are merged into a single stream in no particular order. Scanning threads are
+    /// blocked while "buffer_size" documents are waiting to be delivered.
+    ///
+    /// Blocks the current thread until all partitions have been scanned. When scanning any partition fails or `fn`
+    /// throws an exception, the remaining partitions stop scanning and the first exception is rethrown.
+    ///
+    /// @throws mongocxx::v1::exception when the split points could not be sampled.
+    /// @throws mongocxx::v1::exception when a partition could not be scanned.
+    /// @throws Any exception thrown by `fn`.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) for_each(callback_type const& fn) const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::parallel_scan.
+    ///
+    enum class errc {
+        zero,                    ///< Zero.
+        invalid_partition_count, ///< The partition count must be greater than zero.
+        invalid_key,             ///< The partition key must not be empty.
+        invalid_sample_size,     ///< The sample size must be greater than zero.
+        invalid_buffer_size,     ///< The buffer size must be greater than zero.
+        invalid_boundaries,      ///< The split points must be strictly ascending values with the same BSON type.
+        invalid_find_options,    ///< The find options must not specify a limit, skip, or sort.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::parallel_scan::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+
+    class internal;
+};
+
+///
+/// Options for @ref mongocxx::v1::parallel_scan.
+///
+/// Supported fields include:
+/// - `boundaries`
+/// - `buffer_size`
+/// - `filter`
+/// - `find_options`
+/// - `key`
+/// - `partition_count`
+/// - `sample_size`
+///
+class parallel_scan::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "boundaries" field.
+    ///
+    /// The strictly ascending split points between consecutive partitions. When set, the collection is not sampled
+    /// and the "partition_count" and "sample_size" fields are ignored: the number of partitions is one more than the
+    /// number of split points.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) boundaries(bsoncxx::v1::array::value v);
+
+    ///
+    /// Return the current "boundaries" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::array::view>) boundaries() const;
+
+    ///
+    /// Set the "buffer_size" field.
+    ///
+    /// The maximum number of documents waiting to be delivered by @ref parallel_scan::for_each. When unset, 1024 is
+    /// used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) buffer_size(std::size_t v);
+
+    ///
+    /// Return the current "buffer_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) buffer_size() const;
+
+    ///
+    /// Set the "filter" field.
+    ///
+    /// Only documents matching this filter are delivered. When unset, all documents are delivered.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) filter(bsoncxx::v1::document::value v);
+
+    ///
+    /// Return the current "filter" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view>) filter() const;
+
+    ///
+    /// Set the "find_options" field.
+    ///
+    /// The options used by the "find" command of each partition (e.g. a projection or a batch size).
+    ///
+    /// A limit, skip, or sort is not supported, as it would apply to each partition independently rather than to the
+    /// scan as a whole.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) find_options(v1::find_options v);
+
+    ///
+    /// Return the current "find_options" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::find_options>) find_options() const;
+
+    ///
+    /// Set the "key" field.
+    ///
+    /// The (possibly dotted) name of the field whose values are split into ranges. When unset, "_id" is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) key(std::string v);
+
+    ///
+    /// Return the current "key" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bsoncxx::v1::stdx::string_view>) key() const;
+
+    ///
+    /// Set the "partition_count" field.
+    ///
+    /// The requested number of partitions. When unset, `std::thread::hardware_concurrency()` (or 1) is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) partition_count(std::size_t v);
+
+    ///
+    /// Return the current "partition_count" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) partition_count() const;
+
+    ///
+    /// Set the "sample_size" field.
+    ///
+    /// The number of documents sampled to choose the split points. When unset, 32 documents per partition are
+    /// sampled.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) sample_size(std::int32_t v);
+
+    ///
+    /// Return the current "sample_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::int32_t>) sample_size() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::parallel_scan::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::parallel_scan.
+///
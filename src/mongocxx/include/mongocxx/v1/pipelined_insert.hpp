@@ -0,0 +1,427 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/pipelined_insert-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/detail/type_traits.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+#include <mongocxx/v1/insert_many_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Insert an unbounded sequence of documents into a collection as a pipeline of bulk write operations.
+///
+/// Unlike @ref mongocxx::v1::collection::insert_many, which buffers every document (and its "_id" field) before
+/// anything is sent to the server, documents are consumed one at a time and cut into batches of at most
+/// "max_batch_count" documents and (approximately) "max_batch_size" bytes. Each batch is inserted with a client object
+/// acquired from the associated pool on a background thread while subsequent documents are being appended, such that
+/// memory usage is bounded by the size of the batches in flight rather than by the number of documents.
+///
+/// When the "ordered" field of the insert options is unset or true, batches are inserted one at a time in order, and
+/// no further batch is inserted after an error. Otherwise, up to "max_in_flight" batches are inserted concurrently and
+/// an error does not prevent the insertion of other batches.
+///
+/// The result of each batch is reported to the "on_batch" handler (if any) on the thread appending documents, during a
+/// subsequent call to @ref append or @ref finish.
+///
+/// ```cpp
+/// mongocxx::v1::pipelined_insert inserter{pool, "db", "coll", opts};
+///
+/// inserter.append(source.begin(), source.end());
+///
+/// auto const summary = inserter.finish();
+/// ```
+///
+/// @note Inserted "_id" fields are not reported. A document without an "_id" field is assigned one by the server (or
+/// by mongoc) as usual.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @par Thread Safety:
+/// No member functions may be called concurrently.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class pipelined_insert {
+   private:
+    class impl;
+    void* _impl;
+
+    template <typename Sentinel, typename InputIt>
+    struct is_sentinel_for : bsoncxx::detail::is_equality_comparable<Sentinel, InputIt> {};
+
+    static void is_document_iter_expr_impl(bsoncxx::v1::document::view) {}
+
+    template <typename InputIt>
+    using is_document_iter_expr = decltype((is_document_iter_expr_impl)(*std::declval<InputIt&>()));
+
+    template <typename InputIt>
+    struct is_document_iter : bsoncxx::detail::is_detected<is_document_iter_expr, InputIt> {};
+
+   public:
+    class options;
+    struct batch_result;
+    struct summary;
+
+    ///
+    /// The type of the handler for the result of each batch.
+    ///
+    using batch_handler = std::function<void(batch_result const& result)>;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// Documents appended since the last batch was cut are discarded. Blocks until every batch in flight has been
+    /// inserted (or failed). Their results are not reported.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~pipelined_insert();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() pipelined_insert(pipelined_insert&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(pipelined_insert&) operator=(pipelined_insert&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    pipelined_insert(pipelined_insert const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    pipelined_insert& operator=(pipelined_insert const& other) = delete;
+
+    ///
+    /// Insert documents into the collection `coll_name` in the database `db_name`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::pipelined_insert::errc::invalid_max_batch_count if the
+    /// maximum batch count is zero.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::pipelined_insert::errc::invalid_max_batch_size if the
+    /// maximum batch size is zero.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::pipelined_insert::errc::invalid_max_in_flight if the
+    /// maximum number of batches in flight is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() pipelined_insert(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL() pipelined_insert(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Append `doc` to the current batch.
+    ///
+    /// `doc` is copied. When the current batch is full, it is cut and handed to a background thread first, which blocks
+    /// while "max_in_flight" batches (or one batch, when ordered) are already in flight.
+    ///
+    /// @throws The error of a failed batch when ordered.
+    /// @throws Any exception thrown by the "on_batch" handler.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(void) append(bsoncxx::v1::document::view doc);
+
+    ///
+    /// Append each document in the range [`begin`, `end`).
+    ///
+    /// The range is consumed lazily: at most one batch is read ahead of the batches in flight.
+    ///
+    /// @par Constraints:
+    /// - `InputIt` satisfies Cpp17InputIterator.
+    /// - The value type of `InputIt` is convertible to @ref bsoncxx::v1::document::view.
+    /// - `Sentinel` satisfies `std::is_sentinel_for<Sentinel, InputIt>`.
+    ///
+    template <
+        typename InputIt,
+        typename Sentinel,
+        bsoncxx::detail::enable_if_t<is_document_iter<InputIt>::value && is_sentinel_for<Sentinel, InputIt>::value>* =
+            nullptr>
+    void append(InputIt begin, Sentinel end) {
+        for (auto iter = begin; iter != end; ++iter) {
+            this->append(*iter);
+        }
+    }
+
+    ///
+    /// Insert the current batch (if any) and wait for every batch in flight.
+    ///
+    /// Reports the result of every remaining batch.
+    ///
+    /// @returns The totals of every batch inserted by this object so far.
+    ///
+    /// @throws The error of the first failed batch.
+    /// @throws Any exception thrown by the "on_batch" handler.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(summary) finish();
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::pipelined_insert.
+    ///
+    enum class errc {
+        zero,                    ///< Zero.
+        invalid_max_batch_count, ///< The maximum batch count must be greater than zero.
+        invalid_max_batch_size,  ///< The maximum batch size must be greater than zero.
+        invalid_max_in_flight,   ///< The maximum number of batches in flight must be greater than zero.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::pipelined_insert::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+
+    class internal;
+};
+
+///
+/// The result of a batch inserted by @ref mongocxx::v1::pipelined_insert.
+///
+struct pipelined_insert::batch_result {
+    ///
+    /// The zero-based index of the batch.
+    ///
+    std::size_t index = 0u;
+
+    ///
+    /// The zero-based index of the first document of the batch among every appended document.
+    ///
+    std::size_t offset = 0u;
+
+    ///
+    /// The number of documents in the batch.
+    ///
+    std::size_t count = 0u;
+
+    ///
+    /// The total size in bytes of the documents in the batch.
+    ///
+    std::size_t size = 0u;
+
+    ///
+    /// The number of inserted documents reported by the server (zero when unacknowledged or failed).
+    ///
+    std::int64_t inserted_count = 0;
+
+    ///
+    /// The error encountered when inserting the batch, if any.
+    ///
+    std::exception_ptr error;
+};
+
+///
+/// The totals of the batches inserted by @ref mongocxx::v1::pipelined_insert.
+///
+struct pipelined_insert::summary {
+    ///
+    /// The number of batches.
+    ///
+    std::size_t batches = 0u;
+
+    ///
+    /// The number of documents.
+    ///
+    std::size_t documents = 0u;
+
+    ///
+    /// The number of inserted documents reported by the server.
+    ///
+    std::int64_t inserted_count = 0;
+};
+
+///
+/// Options for @ref mongocxx::v1::pipelined_insert.
+///
+/// Supported fields include:
+/// - `insert_many_options`
+/// - `max_batch_count`
+/// - `max_batch_size`
+/// - `max_in_flight`
+/// - `on_batch`
+///
+class pipelined_insert::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "insert_many_options" field.
+    ///
+    /// The options of the bulk write operation of each batch. The "ordered" field also determines whether batches are
+    /// inserted concurrently.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) insert_many_options(v1::insert_many_options v);
+
+    ///
+    /// Return the current "insert_many_options" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::insert_many_options>) insert_many_options() const;
+
+    ///
+    /// Set the "max_batch_count" field.
+    ///
+    /// The maximum number of documents in a batch. When unset, 1000 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_batch_count(std::size_t v);
+
+    ///
+    /// Return the current "max_batch_count" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) max_batch_count() const;
+
+    ///
+    /// Set the "max_batch_size" field.
+    ///
+    /// The maximum total size in bytes of the documents in a batch. A single document larger than this size is
+    /// inserted in a batch of its own. When unset, 16 MiB is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_batch_size(std::size_t v);
+
+    ///
+    /// Return the current "max_batch_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) max_batch_size() const;
+
+    ///
+    /// Set the "max_in_flight" field.
+    ///
+    /// The maximum number of batches inserted concurrently when unordered. When unset, 4 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_in_flight(std::size_t v);
+
+    ///
+    /// Return the current "max_in_flight" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) max_in_flight() const;
+
+    ///
+    /// Set the "on_batch" field.
+    ///
+    /// The handler for the result of each batch.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) on_batch(batch_handler v);
+
+    ///
+    /// Return the current "on_batch" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(batch_handler) on_batch() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::pipelined_insert::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::pipelined_insert.
+///
@@ -29,7 +29,10 @@
 #include <mongocxx/v1/client.hpp> // IWYU pragma: export
 #include <mongocxx/v1/config/export.hpp>
 
+#include <array>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <system_error>
 #include <type_traits>
 
@@ -54,6 +57,7 @@ class pool {
    public:
     class options;
     class entry;
+    struct acquire_stats;
 
     ///
     /// Destroy this object.
@@ -145,6 +149,36 @@ class pool {
     ///
     MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<entry>) try_acquire();
 
+    ///
+    /// Establish the connections of up to `n` client objects ahead of their first use.
+    ///
+    /// Up to `n` distinct client objects are acquired without waiting (as if by @ref try_acquire), then a "ping"
+    /// command is executed on each of them, which establishes and authenticates their connections. The commands are
+    /// executed concurrently by a small, bounded number of threads (including the calling thread). All client objects
+    /// are released back into this pool before returning.
+    ///
+    /// No further client objects are acquired and no further commands are started once `deadline` is reached. A
+    /// command which has already been started is not interrupted.
+    ///
+    /// @returns The number of client objects whose connections were successfully established. Errors encountered while
+    /// establishing a connection are not reported.
+    ///
+    /// @note Client objects released back into this pool are reused most-recently-released first, so client objects
+    /// which are not needed after a burst of concurrent operations remain idle rather than being destroyed. They are
+    /// destroyed (closing their connections) only when this pool is destroyed.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) warm_up(std::size_t n, std::chrono::steady_clock::time_point deadline);
+
+    ///
+    /// Return a snapshot of the statistics describing client object acquisition from this pool.
+    ///
+    /// Statistics are maintained using relaxed atomic counters: obtaining a snapshot does not block concurrent
+    /// acquisition, and the fields of a snapshot are not necessarily mutually consistent.
+    ///
+    /// @note Only client objects acquired via @ref acquire, @ref try_acquire, or @ref warm_up are counted.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(acquire_stats) stats() const;
+
     ///
     /// Append client metadata to the handshake command sent as part of the initial connection handshake.
     ///
@@ -196,6 +230,57 @@ class pool {
     /* explicit(false) */ pool(void* impl);
 };
 
+///
+/// Statistics describing client object acquisition from a @ref mongocxx::v1::pool.
+///
+struct pool::acquire_stats {
+    ///
+    /// The number of client objects successfully acquired.
+    ///
+    std::int64_t acquired = 0;
+
+    ///
+    /// The number of calls to @ref mongocxx::v1::pool::acquire which failed due to "waitQueueTimeoutMS".
+    ///
+    std::int64_t timeouts = 0;
+
+    ///
+    /// The number of calls to @ref mongocxx::v1::pool::try_acquire which did not return a client object.
+    ///
+    std::int64_t misses = 0;
+
+    ///
+    /// The number of client objects currently acquired.
+    ///
+    std::int64_t in_use = 0;
+
+    ///
+    /// The number of client objects currently idle in the pool.
+    ///
+    /// @note Computed as `peak_in_use - in_use`: the pool only creates a new client object when all existing client
+    /// objects are in use, and does not destroy client objects until the pool itself is destroyed.
+    ///
+    std::int64_t idle = 0;
+
+    ///
+    /// The maximum number of client objects which were acquired at the same time.
+    ///
+    std::int64_t peak_in_use = 0;
+
+    ///
+    /// The total time spent waiting to successfully acquire a client object.
+    ///
+    std::chrono::nanoseconds wait_time{0};
+
+    ///
+    /// A histogram of the time spent waiting to successfully acquire a client object.
+    ///
+    /// Element 0 counts waits shorter than 1 microsecond. Element `i` (for `0 < i < 31`) counts waits of at least
+    /// `2^(i-1)` and less than `2^i` microseconds. Element 31 counts all longer waits.
+    ///
+    std::array<std::int64_t, 32> wait_histogram = {};
+};
+
 ///
 /// Options for @ref mongocxx::v1::pool.
 ///
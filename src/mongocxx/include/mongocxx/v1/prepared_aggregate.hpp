@@ -0,0 +1,141 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/prepared_aggregate-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <bsoncxx/v1/document/view-fwd.hpp>
+
+#include <mongocxx/v1/aggregate_options-fwd.hpp>
+#include <mongocxx/v1/client_session-fwd.hpp>
+#include <mongocxx/v1/collection-fwd.hpp>
+#include <mongocxx/v1/pipeline-fwd.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+#include <mongocxx/v1/cursor.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// An "aggregate" command whose pipeline and options are serialized once and reused by every execution.
+///
+/// Equivalent to `coll.aggregate(pipeline, opts)`, but the pipeline and options are only serialized when this object
+/// is constructed. Each execution only binds an (optional) filter, which is prepended to the pipeline as a "$match"
+/// stage.
+///
+/// @par Thread Safety:
+/// @ref execute may be called concurrently (with different collection objects).
+///
+/// @see
+/// - [`aggregate` (database command) (MongoDB Manual)](https://www.mongodb.com/docs/manual/reference/command/aggregate/)
+///
+class prepared_aggregate {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~prepared_aggregate();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() prepared_aggregate(prepared_aggregate&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(prepared_aggregate&) operator=(prepared_aggregate&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() prepared_aggregate(prepared_aggregate const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(prepared_aggregate&) operator=(prepared_aggregate const& other);
+
+    ///
+    /// Prepare an "aggregate" command with the given pipeline and options.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() prepared_aggregate(v1::pipeline const& pipeline, v1::aggregate_options const& opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() prepared_aggregate(v1::pipeline const& pipeline);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Run the prepared pipeline on `coll`.
+    ///
+    /// Equivalent to `coll.aggregate(pipeline, opts)` (or `coll.aggregate(session, pipeline, opts)`) with the
+    /// pipeline and options used to initialize this object.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(v1::cursor) execute(v1::collection& coll) const;
+
+    MONGOCXX_ABI_EXPORT_CDECL(v1::cursor) execute(v1::collection& coll, v1::client_session const& session) const;
+    /// @}
+    ///
+
+    ///
+    /// Run the prepared pipeline on `coll`, preceded by a "$match" stage with `filter`.
+    ///
+    /// When `filter` is empty, equivalent to `this->execute(coll)`.
+    ///
+    /// @important The prepared pipeline must not begin with a stage which must be the first stage of a pipeline (e.g.
+    /// "$geoNear" or "$collStats") unless `filter` is empty.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(v1::cursor) execute(v1::collection& coll, bsoncxx::v1::document::view filter) const;
+
+    MONGOCXX_ABI_EXPORT_CDECL(v1::cursor) execute(
+        v1::collection& coll,
+        v1::client_session const& session,
+        bsoncxx::v1::document::view filter) const;
+    /// @}
+    ///
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::prepared_aggregate.
+///
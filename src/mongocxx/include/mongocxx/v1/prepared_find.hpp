@@ -0,0 +1,124 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/prepared_find-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <bsoncxx/v1/document/view-fwd.hpp>
+
+#include <mongocxx/v1/client_session-fwd.hpp>
+#include <mongocxx/v1/collection-fwd.hpp>
+#include <mongocxx/v1/find_options-fwd.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+#include <mongocxx/v1/cursor.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// A "find" command whose options are serialized once and reused by every execution.
+///
+/// Equivalent to `coll.find(filter, opts)`, but the options (including the hint, projection, and sort) are only
+/// serialized when this object is constructed. Each execution only binds the filter.
+///
+/// @par Thread Safety:
+/// @ref execute may be called concurrently (with different collection objects).
+///
+/// @see
+/// - [`find` (database command) (MongoDB Manual)](https://www.mongodb.com/docs/manual/reference/command/find/)
+///
+class prepared_find {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~prepared_find();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() prepared_find(prepared_find&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(prepared_find&) operator=(prepared_find&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() prepared_find(prepared_find const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(prepared_find&) operator=(prepared_find const& other);
+
+    ///
+    /// Prepare a "find" command with the given options.
+    ///
+    /// @{
+    explicit MONGOCXX_ABI_EXPORT_CDECL() prepared_find(v1::find_options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL() prepared_find();
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Find the documents in `coll` matching `filter`.
+    ///
+    /// Equivalent to `coll.find(filter, opts)` (or `coll.find(session, filter, opts)`) with the options used to
+    /// initialize this object.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(v1::cursor) execute(v1::collection& coll, bsoncxx::v1::document::view filter) const;
+
+    MONGOCXX_ABI_EXPORT_CDECL(v1::cursor) execute(
+        v1::collection& coll,
+        v1::client_session const& session,
+        bsoncxx::v1::document::view filter) const;
+    /// @}
+    ///
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::prepared_find.
+///
@@ -0,0 +1,318 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/thread_affine_pool-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/client-fwd.hpp>
+#include <mongocxx/v1/database-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
+
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// A layer over a @ref mongocxx::v1::pool which keeps a client object checked out per thread.
+///
+/// The first call to @ref acquire by a thread acquires a client object from the associated pool and pins it to that
+/// thread. Subsequent calls by the same thread return the same client object without accessing the associated pool,
+/// which avoids contention on the pool's internal mutex when operations are executed at a high rate.
+///
+/// A pinned client object is released back into the associated pool when:
+/// - it has not been used by its thread for longer than "idle_timeout" (checked by a background thread),
+/// - its thread exits, or
+/// - this object is destroyed.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @par Thread Safety:
+/// All member functions other than move construction, move assignment, and destruction may be called concurrently.
+///
+class thread_affine_pool {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+    class lease;
+
+    ///
+    /// Destroy this object, releasing all pinned client objects back into the associated pool.
+    ///
+    /// @important All leases obtained from this object must be released before it is destroyed.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~thread_affine_pool();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() thread_affine_pool(thread_affine_pool&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(thread_affine_pool&) operator=(thread_affine_pool&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    thread_affine_pool(thread_affine_pool const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    thread_affine_pool& operator=(thread_affine_pool const& other) = delete;
+
+    ///
+    /// Pin client objects acquired from `pool` to the threads which use them.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::thread_affine_pool::errc::invalid_idle_timeout if the
+    /// idle timeout is not positive.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() thread_affine_pool(v1::pool& pool, options const& opts);
+
+    explicit MONGOCXX_ABI_EXPORT_CDECL() thread_affine_pool(v1::pool& pool);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Return a lease of the client object pinned to the current thread.
+    ///
+    /// When no client object is pinned to the current thread, one is acquired from the associated pool (as if by
+    /// @ref mongocxx::v1::pool::acquire) and pinned to the current thread.
+    ///
+    /// When the pinned client object is already leased by the current thread (e.g. due to a nested call), a separate
+    /// client object is acquired from the associated pool for the duration of the returned lease instead.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::pool::errc::wait_queue_timeout if a client object could
+    /// not be acquired from the associated pool within "waitQueueTimeoutMS".
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(lease) acquire();
+
+    ///
+    /// Return the number of client objects currently pinned to a thread.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) size() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::thread_affine_pool.
+    ///
+    enum class errc {
+        zero,                 ///< Zero.
+        invalid_idle_timeout, ///< The idle timeout must be positive.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::thread_affine_pool::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+};
+
+///
+/// Options for @ref mongocxx::v1::thread_affine_pool.
+///
+/// Supported fields include:
+/// - `idle_timeout`
+///
+class thread_affine_pool::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "idle_timeout" field.
+    ///
+    /// The duration after which a pinned client object which has not been leased is released back into the associated
+    /// pool. When unset, 10 seconds is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) idle_timeout(std::chrono::milliseconds v);
+
+    ///
+    /// Return the current "idle_timeout" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::chrono::milliseconds>) idle_timeout() const;
+};
+
+///
+/// A lease of a client object obtained from a @ref mongocxx::v1::thread_affine_pool.
+///
+/// @important A lease must not outlive the thread which obtained it.
+///
+class thread_affine_pool::lease {
+   private:
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object, ending the lease.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~lease();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() lease(lease&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(lease&) operator=(lease&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    lease(lease const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    lease& operator=(lease const& other) = delete;
+
+    ///
+    /// Access the leased client.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(v1::client*) operator->();
+
+    ///
+    /// Access the leased client.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(v1::client&) operator*();
+
+    ///
+    /// Explicitly end the lease.
+    ///
+    /// @par Postconditions:
+    /// - `*this` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(lease&) operator=(std::nullptr_t);
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Equivalent to `(*this)->database(name)`.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL(v1::database) database(bsoncxx::v1::stdx::string_view name);
+    MONGOCXX_ABI_EXPORT_CDECL(v1::database) operator[](bsoncxx::v1::stdx::string_view name);
+    /// @}
+    ///
+
+    class internal;
+
+   private:
+    /* explicit(false) */ lease(void* impl);
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::thread_affine_pool::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::thread_affine_pool.
+///
@@ -0,0 +1,295 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/write_combiner-fwd.hpp> // IWYU pragma: export
+
+//
+
+#include <mongocxx/v1/detail/prelude.hpp>
+
+#include <mongocxx/v1/insert_one_result-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
+#include <mongocxx/v1/write_concern-fwd.hpp>
+
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/config/export.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+
+namespace mongocxx {
+namespace v1 {
+
+///
+/// Combine concurrent single-document inserts into a collection into unordered bulk write operations.
+///
+/// Each call to @ref insert_one joins the currently open batch. The first caller to join a batch executes it, using a
+/// client object acquired from the associated pool, as soon as no other batch is being executed. While another batch
+/// is being executed, concurrent inserts join the open batch until either it contains "max_batch_size" documents,
+/// the other batch has been executed, or "max_delay" has elapsed since its first caller joined. An uncontended insert
+/// is therefore executed immediately. Every caller blocks until its batch has been executed and then observes the
+/// outcome of its own document as though it had been inserted individually.
+///
+/// @important The associated pool must outlive this object.
+///
+/// @par Thread Safety:
+/// @ref insert_one may be called concurrently.
+///
+/// @see
+/// - [Bulk Write Operations (MongoDB Manual)](https://www.mongodb.com/docs/manual/core/bulk-write-operations/)
+///
+class write_combiner {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    class options;
+
+    ///
+    /// Destroy this object.
+    ///
+    /// @warning All calls to @ref insert_one must have returned.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~write_combiner();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() write_combiner(write_combiner&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(write_combiner&) operator=(write_combiner&& other) noexcept;
+
+    ///
+    /// This class is not copyable.
+    ///
+    write_combiner(write_combiner const& other) = delete;
+
+    ///
+    /// This class is not copyable.
+    ///
+    write_combiner& operator=(write_combiner const& other) = delete;
+
+    ///
+    /// Combine inserts into the collection `coll_name` in the database `db_name`.
+    ///
+    /// @important `pool` must outlive this object.
+    ///
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::write_combiner::errc::invalid_max_batch_size if the
+    /// maximum batch size is zero.
+    ///
+    /// @{
+    MONGOCXX_ABI_EXPORT_CDECL() write_combiner(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        options const& opts);
+
+    MONGOCXX_ABI_EXPORT_CDECL() write_combiner(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name);
+    /// @}
+    ///
+
+    ///
+    /// Return true when `*this` is NOT in an assign-or-destroy-only state.
+    ///
+    explicit MONGOCXX_ABI_EXPORT_CDECL() operator bool() const;
+
+    ///
+    /// Insert a single document as part of a combined unordered bulk write operation.
+    ///
+    /// If the document does not contain an "_id" field, an "_id" field is generated using @ref bsoncxx::v1::oid.
+    ///
+    /// Blocks the current thread until the batch containing `document` has been executed. The result reports
+    /// only the insertion of `document`. A write error for `document` is reported only to this caller; the other
+    /// documents in the same batch are not affected by it.
+    ///
+    /// @returns Empty when the bulk write operation is unacknowledged.
+    ///
+    /// @throws mongocxx::v1::exception when a write error for `document` is encountered.
+    /// @throws mongocxx::v1::exception when the combined bulk write operation fails for reasons other than per-document
+    /// write errors (e.g. a write concern error or a network error). All callers in the same batch observe the same
+    /// exception.
+    /// @throws mongocxx::v1::exception with @ref mongocxx::v1::pool::errc::wait_queue_timeout if a client object could
+    /// not be acquired from the associated pool.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::insert_one_result>) insert_one(
+        bsoncxx::v1::document::view document);
+
+    ///
+    /// Return the number of combined bulk write operations executed by this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) batch_count() const;
+
+    ///
+    /// Return the number of documents inserted via this object, including those which encountered a write error.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(std::size_t) document_count() const;
+
+    ///
+    /// Errors codes which may be returned by @ref mongocxx::v1::write_combiner.
+    ///
+    enum class errc {
+        zero,                   ///< Zero.
+        invalid_max_batch_size, ///< The maximum batch size must be greater than zero.
+    };
+
+    ///
+    /// The error category for @ref mongocxx::v1::write_combiner::errc.
+    ///
+    static MONGOCXX_ABI_EXPORT_CDECL(std::error_category const&) error_category();
+
+    ///
+    /// Support implicit conversion to `std::error_code`.
+    ///
+    friend std::error_code make_error_code(errc v) {
+        return {static_cast<int>(v), error_category()};
+    }
+};
+
+///
+/// Options for @ref mongocxx::v1::write_combiner.
+///
+/// Supported fields include:
+/// - `bypass_document_validation` ("bypassDocumentValidation")
+/// - `max_batch_size`
+/// - `max_delay`
+/// - `write_concern` ("writeConcern")
+///
+class write_combiner::options {
+   private:
+    class impl;
+    void* _impl;
+
+   public:
+    ///
+    /// Destroy this object.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() ~options();
+
+    ///
+    /// Move constructor.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options&& other) noexcept;
+
+    ///
+    /// Move assignment.
+    ///
+    /// @par Postconditions:
+    /// - `other` is in an assign-or-destroy-only state.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options&& other) noexcept;
+
+    ///
+    /// Copy construction.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options(options const& other);
+
+    ///
+    /// Copy assignment.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) operator=(options const& other);
+
+    ///
+    /// Default initialization.
+    ///
+    /// @par Postconditions:
+    /// - All supported fields are "unset" or zero-initialized.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL() options();
+
+    ///
+    /// Set the "bypassDocumentValidation" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) bypass_document_validation(bool v);
+
+    ///
+    /// Return the current "bypassDocumentValidation" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<bool>) bypass_document_validation() const;
+
+    ///
+    /// Set the "max_batch_size" field.
+    ///
+    /// The maximum number of documents combined into a single bulk write operation. When unset, 1000 is used.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_batch_size(std::size_t v);
+
+    ///
+    /// Return the current "max_batch_size" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::size_t>) max_batch_size() const;
+
+    ///
+    /// Set the "max_delay" field.
+    ///
+    /// The maximum latency added to an insert while waiting for other inserts to join its batch when another batch is
+    /// being executed. When unset, 1 millisecond is used. When zero, a batch is executed as soon as its first caller
+    /// joins it; only inserts which arrive concurrently are combined.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) max_delay(std::chrono::microseconds v);
+
+    ///
+    /// Return the current "max_delay" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<std::chrono::microseconds>) max_delay() const;
+
+    ///
+    /// Set the "writeConcern" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(options&) write_concern(v1::write_concern v);
+
+    ///
+    /// Return the current "writeConcern" field.
+    ///
+    MONGOCXX_ABI_EXPORT_CDECL(bsoncxx::v1::stdx::optional<v1::write_concern>) write_concern() const;
+};
+
+} // namespace v1
+} // namespace mongocxx
+
+namespace std {
+
+template <>
+struct is_error_code_enum<mongocxx::v1::write_combiner::errc> : true_type {};
+
+} // namespace std
+
+#include <mongocxx/v1/detail/postlude.hpp>
+
+///
+/// @file
+/// Provides @ref mongocxx::v1::write_combiner.
+///
@@ -125,11 +125,17 @@ class insert_many {
     bsoncxx::v_noabi::array::value _inserted_ids;
     id_map _id_map;
 
+    // The keys of `_inserted_ids` are operation indexes, which need not be contiguous (e.g. when only generated IDs
+    // are reported).
     void sync_id_map() {
-        std::size_t index = 0;
         for (auto const& ele : _inserted_ids) {
+            std::size_t index = 0;
+            for (auto const c : ele.key()) {
+                index = index * 10u + static_cast<std::size_t>(c - '0');
+            }
+
             // v_noabi::array::element -> v1::element::view -> v_noabi::document::element
-            _id_map.emplace(index++, bsoncxx::v_noabi::to_v1(ele));
+            _id_map.emplace(index, bsoncxx::v_noabi::to_v1(ele));
         }
     }
 };
@@ -0,0 +1,368 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/private/sha256.hh>
+
+//
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MONGOCXX_PRIVATE_SHA256_SHANI_GNU 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define MONGOCXX_PRIVATE_SHA256_SHANI_MSVC 1
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace mongocxx {
+
+namespace {
+
+using compress_fn = void (*)(std::uint32_t* state, std::uint8_t const* blocks, std::size_t count);
+
+constexpr std::array<std::uint32_t, 64> k = {{
+    0x428a2f98u, 0x71374491u, 0xb5c0fbcfu, 0xe9b5dba5u, 0x3956c25bu, 0x59f111f1u, 0x923f82a4u, 0xab1c5ed5u,
+    0xd807aa98u, 0x12835b01u, 0x243185beu, 0x550c7dc3u, 0x72be5d74u, 0x80deb1feu, 0x9bdc06a7u, 0xc19bf174u,
+    0xe49b69c1u, 0xefbe4786u, 0x0fc19dc6u, 0x240ca1ccu, 0x2de92c6fu, 0x4a7484aau, 0x5cb0a9dcu, 0x76f988dau,
+    0x983e5152u, 0xa831c66du, 0xb00327c8u, 0xbf597fc7u, 0xc6e00bf3u, 0xd5a79147u, 0x06ca6351u, 0x14292967u,
+    0x27b70a85u, 0x2e1b2138u, 0x4d2c6dfcu, 0x53380d13u, 0x650a7354u, 0x766a0abbu, 0x81c2c92eu, 0x92722c85u,
+    0xa2bfe8a1u, 0xa81a664bu, 0xc24b8b70u, 0xc76c51a3u, 0xd192e819u, 0xd6990624u, 0xf40e3585u, 0x106aa070u,
+    0x19a4c116u, 0x1e376c08u, 0x2748774cu, 0x34b0bcb5u, 0x391c0cb3u, 0x4ed8aa4au, 0x5b9cca4fu, 0x682e6ff3u,
+    0x748f82eeu, 0x78a5636fu, 0x84c87814u, 0x8cc70208u, 0x90befffau, 0xa4506cebu, 0xbef9a3f7u, 0xc67178f2u,
+}};
+
+constexpr std::array<std::uint32_t, 8> initial_state = {{
+    0x6a09e667u,
+    0xbb67ae85u,
+    0x3c6ef372u,
+    0xa54ff53au,
+    0x510e527fu,
+    0x9b05688cu,
+    0x1f83d9abu,
+    0x5be0cd19u,
+}};
+
+std::uint32_t rotr(std::uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+std::uint32_t load_be32(std::uint8_t const* p) {
+    return (std::uint32_t{p[0]} << 24) | (std::uint32_t{p[1]} << 16) | (std::uint32_t{p[2]} << 8) | std::uint32_t{p[3]};
+}
+
+void compress_portable(std::uint32_t* state, std::uint8_t const* blocks, std::size_t count) {
+    std::array<std::uint32_t, 64> w;
+
+    for (; count > 0u; --count, blocks += sha256::block_size) {
+        for (std::size_t i = 0u; i < 16u; ++i) {
+            w[i] = load_be32(blocks + (i * 4u));
+        }
+
+        for (std::size_t i = 16u; i < 64u; ++i) {
+            auto const s0 = rotr(w[i - 15u], 7) ^ rotr(w[i - 15u], 18) ^ (w[i - 15u] >> 3);
+            auto const s1 = rotr(w[i - 2u], 17) ^ rotr(w[i - 2u], 19) ^ (w[i - 2u] >> 10);
+
+            w[i] = w[i - 16u] + s0 + w[i - 7u] + s1;
+        }
+
+        auto a = state[0];
+        auto b = state[1];
+        auto c = state[2];
+        auto d = state[3];
+        auto e = state[4];
+        auto f = state[5];
+        auto g = state[6];
+        auto h = state[7];
+
+        for (std::size_t i = 0u; i < 64u; ++i) {
+            auto const t1 = h + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25)) + ((e & f) ^ (~e & g)) + k[i] + w[i];
+            auto const t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+#if defined(MONGOCXX_PRIVATE_SHA256_SHANI_GNU) || defined(MONGOCXX_PRIVATE_SHA256_SHANI_MSVC)
+
+#if defined(MONGOCXX_PRIVATE_SHA256_SHANI_GNU)
+#define MONGOCXX_PRIVATE_SHA256_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+#else
+#define MONGOCXX_PRIVATE_SHA256_TARGET
+#endif
+
+// The state is kept as the (ABEF, CDGH) register pair expected by the SHA-256 round instructions.
+MONGOCXX_PRIVATE_SHA256_TARGET void
+compress_shani(std::uint32_t* state, std::uint8_t const* blocks, std::size_t count) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast): unaligned SIMD loads and stores.
+    __m128i const byteswap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+
+    __m128i state0;
+    __m128i state1;
+
+    {
+        auto const dcba = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(state)), 0xB1);
+        auto const efgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i const*>(state + 4)), 0x1B);
+
+        state0 = _mm_alignr_epi8(dcba, efgh, 8);    // ABEF
+        state1 = _mm_blend_epi16(efgh, dcba, 0xF0); // CDGH
+    }
+
+    for (; count > 0u; --count, blocks += sha256::block_size) {
+        auto const abef = state0;
+        auto const cdgh = state1;
+
+        __m128i w[4];
+
+        for (int i = 0; i < 16; ++i) {
+            if (i < 4) {
+                w[i] = _mm_shuffle_epi8(
+                    _mm_loadu_si128(reinterpret_cast<__m128i const*>(blocks + (i * 16))), byteswap);
+            } else {
+                auto x = _mm_sha256msg1_epu32(w[i & 3], w[(i + 1) & 3]);
+                x = _mm_add_epi32(x, _mm_alignr_epi8(w[(i + 3) & 3], w[(i + 2) & 3], 4));
+                w[i & 3] = _mm_sha256msg2_epu32(x, w[(i + 3) & 3]);
+            }
+
+            auto msg = _mm_add_epi32(w[i & 3], _mm_loadu_si128(reinterpret_cast<__m128i const*>(k.data() + (i * 4))));
+
+            state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+            msg = _mm_shuffle_epi32(msg, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+        }
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+    }
+
+    {
+        auto const feba = _mm_shuffle_epi32(state0, 0x1B);
+        auto const dchg = _mm_shuffle_epi32(state1, 0xB1);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(feba, dchg, 0xF0));    // DCBA
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(dchg, feba, 8)); // HGFE
+    }
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+#undef MONGOCXX_PRIVATE_SHA256_TARGET
+
+bool cpu_supports_shani() {
+    // CPUID.(EAX=1):ECX.SSSE3[bit 9], ECX.SSE4_1[bit 19], and CPUID.(EAX=7,ECX=0):EBX.SHA[bit 29].
+    std::uint32_t ecx1 = 0u;
+    std::uint32_t ebx7 = 0u;
+
+#if defined(MONGOCXX_PRIVATE_SHA256_SHANI_GNU)
+    unsigned int eax = 0u;
+    unsigned int ebx = 0u;
+    unsigned int ecx = 0u;
+    unsigned int edx = 0u;
+
+    if (__get_cpuid_max(0u, nullptr) < 7u) {
+        return false;
+    }
+
+    __cpuid(1, eax, ebx, ecx, edx);
+    ecx1 = ecx;
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    ebx7 = ebx;
+#else
+    int regs[4] = {};
+
+    __cpuid(regs, 0);
+
+    if (regs[0] < 7) {
+        return false;
+    }
+
+    __cpuid(regs, 1);
+    ecx1 = static_cast<std::uint32_t>(regs[2]);
+
+    __cpuidex(regs, 7, 0);
+    ebx7 = static_cast<std::uint32_t>(regs[1]);
+#endif
+
+    return (ecx1 & (1u << 9)) && (ecx1 & (1u << 19)) && (ebx7 & (1u << 29));
+}
+
+#else
+
+bool cpu_supports_shani() {
+    return false;
+}
+
+#endif
+
+compress_fn select_compress() {
+#if defined(MONGOCXX_PRIVATE_SHA256_SHANI_GNU) || defined(MONGOCXX_PRIVATE_SHA256_SHANI_MSVC)
+    if (cpu_supports_shani()) {
+        return &compress_shani;
+    }
+#endif
+
+    return &compress_portable;
+}
+
+compress_fn compress() {
+    static compress_fn const fn = select_compress();
+
+    return fn;
+}
+
+} // namespace
+
+constexpr std::size_t sha256::block_size;
+constexpr std::size_t sha256::digest_size;
+
+sha256::sha256() noexcept : _compress{compress()}, _state(initial_state), _buffer{}, _buffer_len{0u}, _length{0u} {}
+
+void sha256::update(std::uint8_t const* data, std::size_t length) noexcept {
+    if (length == 0u) {
+        return;
+    }
+
+    _length += length;
+
+    // Complete a partially filled block first.
+    if (_buffer_len > 0u) {
+        auto const n = std::min(length, block_size - _buffer_len);
+
+        std::memcpy(_buffer.data() + _buffer_len, data, n);
+        _buffer_len += n;
+        data += n;
+        length -= n;
+
+        if (_buffer_len < block_size) {
+            return;
+        }
+
+        _compress(_state.data(), _buffer.data(), 1u);
+        _buffer_len = 0u;
+    }
+
+    // Process whole blocks directly from `data`.
+    if (auto const count = length / block_size) {
+        _compress(_state.data(), data, count);
+        data += count * block_size;
+        length -= count * block_size;
+    }
+
+    if (length > 0u) {
+        std::memcpy(_buffer.data(), data, length);
+        _buffer_len = length;
+    }
+}
+
+sha256::digest_type sha256::finish() noexcept {
+    auto const bit_length = _length * 8u;
+
+    // Padding: a single 0x80 byte, zeroes, then the message length in bits as a big-endian 64-bit integer.
+    _buffer[_buffer_len++] = 0x80u;
+
+    if (_buffer_len > block_size - 8u) {
+        std::memset(_buffer.data() + _buffer_len, 0, block_size - _buffer_len);
+        _compress(_state.data(), _buffer.data(), 1u);
+        _buffer_len = 0u;
+    }
+
+    std::memset(_buffer.data() + _buffer_len, 0, block_size - 8u - _buffer_len);
+
+    for (std::size_t i = 0u; i < 8u; ++i) {
+        _buffer[block_size - 1u - i] = static_cast<std::uint8_t>(bit_length >> (i * 8u));
+    }
+
+    _compress(_state.data(), _buffer.data(), 1u);
+
+    digest_type ret;
+
+    for (std::size_t i = 0u; i < _state.size(); ++i) {
+        ret[i * 4u + 0u] = static_cast<std::uint8_t>(_state[i] >> 24);
+        ret[i * 4u + 1u] = static_cast<std::uint8_t>(_state[i] >> 16);
+        ret[i * 4u + 2u] = static_cast<std::uint8_t>(_state[i] >> 8);
+        ret[i * 4u + 3u] = static_cast<std::uint8_t>(_state[i]);
+    }
+
+    auto const fn = _compress;
+
+    *this = sha256{};
+    _compress = fn;
+
+    return ret;
+}
+
+std::string sha256::to_hex(digest_type const& digest) {
+    static constexpr char digits[] = "0123456789abcdef";
+
+    std::string ret;
+
+    ret.reserve(digest.size() * 2u);
+
+    for (auto const byte : digest) {
+        ret += digits[byte >> 4];
+        ret += digits[byte & 0x0Fu];
+    }
+
+    return ret;
+}
+
+bool sha256::is_accelerated() {
+    return compress() != &compress_portable;
+}
+
+bool sha256::force(implementation impl) noexcept {
+    switch (impl) {
+        case implementation::k_portable:
+            _compress = &compress_portable;
+            return true;
+
+        case implementation::k_shani:
+#if defined(MONGOCXX_PRIVATE_SHA256_SHANI_GNU) || defined(MONGOCXX_PRIVATE_SHA256_SHANI_MSVC)
+            if (cpu_supports_shani()) {
+                _compress = &compress_shani;
+                return true;
+            }
+#endif
+            return false;
+
+        default:
+            return false;
+    }
+}
+
+} // namespace mongocxx
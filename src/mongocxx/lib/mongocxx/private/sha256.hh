@@ -0,0 +1,70 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <mongocxx/private/export.hh>
+
+namespace mongocxx {
+
+// An incremental SHA-256 digest (FIPS 180-4).
+//
+// Uses the x86 SHA extensions when supported by the current CPU.
+class sha256 {
+   public:
+    static constexpr std::size_t block_size = 64u;
+    static constexpr std::size_t digest_size = 32u;
+
+    using digest_type = std::array<std::uint8_t, digest_size>;
+
+    // An implementation of the SHA-256 compression function.
+    enum class implementation {
+        k_portable, // Portable C++.
+        k_shani,    // The x86 SHA extensions.
+    };
+
+   private:
+    using compress_fn = void (*)(std::uint32_t* state, std::uint8_t const* blocks, std::size_t count);
+
+    compress_fn _compress;
+    std::array<std::uint32_t, 8> _state;
+    std::array<std::uint8_t, block_size> _buffer;
+    std::size_t _buffer_len;
+    std::uint64_t _length; // Total bytes consumed by `update()`.
+
+   public:
+    MONGOCXX_ABI_EXPORT_CDECL_TESTING() sha256() noexcept;
+
+    MONGOCXX_ABI_EXPORT_CDECL_TESTING(void) update(std::uint8_t const* data, std::size_t length) noexcept;
+
+    // Return the digest of all data consumed by `update()`. `*this` is reset to its initial state.
+    MONGOCXX_ABI_EXPORT_CDECL_TESTING(digest_type) finish() noexcept;
+
+    // Return the digest as a lowercase hexadecimal string.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(std::string) to_hex(digest_type const& digest);
+
+    // Return true when the x86 SHA extensions are used by this process.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bool) is_accelerated();
+
+    // For testing: use `impl` instead of the implementation selected for the current CPU. Returns false (without any
+    // effect) when `impl` is not supported by the current CPU.
+    MONGOCXX_ABI_EXPORT_CDECL_TESTING(bool) force(implementation impl) noexcept;
+};
+
+} // namespace mongocxx
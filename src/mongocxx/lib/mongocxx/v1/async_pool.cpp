@@ -0,0 +1,448 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/async_pool.hpp>
+
+//
+
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/pool.hpp>
+
+#include <mongocxx/v1/exception.hh>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = async_pool::errc;
+
+namespace {
+
+std::size_t default_worker_count() {
+    auto const n = std::thread::hardware_concurrency();
+    return n > 0u ? std::size_t{n} : std::size_t{1};
+}
+
+constexpr std::size_t default_queue_capacity = 1024u;
+
+// The async pool which owns the current worker thread, if any.
+thread_local void const* current_worker_owner = nullptr;
+
+} // namespace
+
+class async_pool::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<std::size_t> _worker_count;
+    bsoncxx::v1::stdx::optional<std::size_t> _queue_capacity;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class async_pool::impl {
+   public:
+    v1::pool* _pool;
+    std::size_t _worker_count;
+    std::size_t _queue_capacity;
+
+    struct queued {
+        task_type task;
+        std::function<void()> then; // Invoked after the client object is released.
+    };
+
+    mutable std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::deque<queued> _queue;
+    std::size_t _active = 0u;
+    bool _stopping = false;
+
+    std::vector<std::thread> _workers;
+
+    ~impl() {
+        this->shutdown();
+    }
+
+    impl(impl&& other) noexcept = delete;
+    impl& operator=(impl&& other) noexcept = delete;
+    impl(impl const& other) = delete;
+    impl& operator=(impl const& other) = delete;
+
+    impl(v1::pool& pool, std::size_t worker_count, std::size_t queue_capacity)
+        : _pool{&pool}, _worker_count{worker_count}, _queue_capacity{queue_capacity} {
+        _workers.reserve(worker_count);
+
+        try {
+            for (std::size_t i = 0u; i < worker_count; ++i) {
+                _workers.emplace_back([this] { this->run(); });
+            }
+        } catch (...) {
+            this->shutdown();
+            throw;
+        }
+    }
+
+    void post(task_type task, std::function<void()> then) {
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            // A worker thread waiting for a queue slot may be waiting for itself: do not enforce the capacity.
+            if (current_worker_owner != this) {
+                _not_full.wait(lock, [&] { return _stopping || _queue.size() < _queue_capacity; });
+            }
+
+            if (_stopping) {
+                throw v1::exception::internal::make(code::shutdown);
+            }
+
+            _queue.push_back({std::move(task), std::move(then)});
+        }
+
+        _not_empty.notify_one();
+    }
+
+    bool try_post(task_type task) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (_stopping) {
+                throw v1::exception::internal::make(code::shutdown);
+            }
+
+            if (_queue.size() >= _queue_capacity) {
+                return false;
+            }
+
+            _queue.push_back({std::move(task), {}});
+        }
+
+        _not_empty.notify_one();
+
+        return true;
+    }
+
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+
+        _not_empty.notify_all();
+        _not_full.notify_all();
+
+        for (auto& worker : _workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        _workers.clear();
+    }
+
+    std::size_t pending() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _queue.size() + _active;
+    }
+
+    // Remaining queued tasks are drained before the worker exits.
+    void run() {
+        current_worker_owner = this;
+
+        for (;;) {
+            queued task;
+
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+
+                _not_empty.wait(lock, [&] { return _stopping || !_queue.empty(); });
+
+                if (_queue.empty()) {
+                    return;
+                }
+
+                task = std::move(_queue.front());
+                _queue.pop_front();
+                ++_active;
+            }
+
+            _not_full.notify_one();
+
+            this->execute(task);
+
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                --_active;
+            }
+        }
+    }
+
+    // A task or continuation which throws an exception escapes this noexcept function and terminates the program.
+    void execute(queued& task) noexcept {
+        {
+            bsoncxx::v1::stdx::optional<v1::pool::entry> entry;
+            std::exception_ptr error;
+
+            try {
+                entry.emplace(_pool->acquire());
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            if (entry) {
+                task.task(&**entry, nullptr);
+            } else {
+                task.task(nullptr, std::move(error));
+            }
+        }
+
+        if (task.then) {
+            task.then();
+        }
+    }
+
+    static impl const& with(async_pool const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(async_pool const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(async_pool& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(async_pool* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+async_pool::~async_pool() {
+    delete impl::with(this);
+}
+
+async_pool::async_pool(async_pool&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+async_pool& async_pool::operator=(async_pool&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+async_pool::async_pool(v1::pool& pool, options opts) : _impl{nullptr} {
+    auto const worker_count = opts.worker_count().value_or(default_worker_count());
+    auto const queue_capacity = opts.queue_capacity().value_or(default_queue_capacity);
+
+    if (worker_count == 0u) {
+        throw v1::exception::internal::make(code::invalid_worker_count);
+    }
+
+    if (queue_capacity == 0u) {
+        throw v1::exception::internal::make(code::invalid_queue_capacity);
+    }
+
+    _impl = new impl{pool, worker_count, queue_capacity};
+}
+
+async_pool::async_pool(v1::pool& pool) : async_pool{pool, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+async_pool::operator bool() const {
+    return _impl != nullptr;
+}
+
+void async_pool::post(task_type task) {
+    impl::with(this)->post(std::move(task), {});
+}
+
+void async_pool::post(task_type task, std::function<void()> then) {
+    impl::with(this)->post(std::move(task), std::move(then));
+}
+
+bool async_pool::try_post(task_type task) {
+    return impl::with(this)->try_post(std::move(task));
+}
+
+void async_pool::shutdown() {
+    impl::with(this)->shutdown();
+}
+
+std::size_t async_pool::worker_count() const {
+    return impl::with(this)->_worker_count;
+}
+
+std::size_t async_pool::pending() const {
+    return impl::with(this)->pending();
+}
+
+std::error_category const& async_pool::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::async_pool";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_worker_count:
+                    return "the worker count must be greater than zero";
+                case code::invalid_queue_capacity:
+                    return "the queue capacity must be greater than zero";
+                case code::shutdown:
+                    return "the async pool is no longer accepting operations";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_worker_count:
+                    case code::invalid_queue_capacity:
+                    case code::shutdown:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_worker_count:
+                    case code::invalid_queue_capacity:
+                        return type == condition::invalid_argument;
+
+                    case code::shutdown:
+                        return type == condition::runtime_error;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+async_pool::options::~options() {
+    delete impl::with(_impl);
+}
+
+async_pool::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+async_pool::options& async_pool::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+async_pool::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+async_pool::options& async_pool::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+async_pool::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+async_pool::options& async_pool::options::worker_count(std::size_t v) {
+    impl::with(this)->_worker_count = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> async_pool::options::worker_count() const {
+    return impl::with(this)->_worker_count;
+}
+
+async_pool::options& async_pool::options::queue_capacity(std::size_t v) {
+    impl::with(this)->_queue_capacity = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> async_pool::options::queue_capacity() const {
+    return impl::with(this)->_queue_capacity;
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -31,6 +31,8 @@
 #include <mongocxx/v1/hint.hh>
 
 #include <cstdint>
+#include <memory>
+#include <stdexcept>
 
 #include <bsoncxx/private/bson.hh>
 
@@ -45,6 +47,7 @@ class bulk_write::impl {
    public:
     mongoc_bulk_operation_t* _bulk = {};
     bool _is_empty = true;
+    std::unique_ptr<internal::insert_many_type> _insert_many;
 
     ~impl() {
         libmongoc::bulk_operation_destroy(_bulk);
@@ -123,6 +126,43 @@ void append_hint(scoped_bson& options, Op const& op) {
     }
 }
 
+// For operations which reference (rather than own) their "hint" field.
+template <typename Op>
+void append_hint_view(scoped_bson& options, Op const& op) {
+    if (auto const opt = op.hint()) {
+        auto const v = *opt;
+
+        switch (v.type_id()) {
+            // An index specification: appended directly from the referenced document.
+            case bsoncxx::v1::types::id::k_document: {
+                if (!bson_append_document(
+                        options.inout_ptr(), "hint", 4, scoped_bson_view{v.get_document().value}.bson())) {
+                    throw std::logic_error{"mongocxx::v1::bulk_write::append: bson_append_document failed"};
+                }
+            } break;
+
+            // An index name: appended directly from the referenced string.
+            case bsoncxx::v1::types::id::k_string: {
+                auto const str = v.get_string().value;
+
+                if (!bson_append_utf8(options.inout_ptr(), "hint", 4, str.data(), static_cast<int>(str.size()))) {
+                    throw std::logic_error{"mongocxx::v1::bulk_write::append: bson_append_utf8 failed"};
+                }
+            } break;
+
+            // Not a valid hint: forwarded as-is to be rejected by the server.
+            default: {
+                bsoncxx::v1::types::value const value{v};
+
+                if (!bson_append_value(
+                        options.inout_ptr(), "hint", 4, &bsoncxx::v1::types::value::internal::get_bson_value(value))) {
+                    throw std::logic_error{"mongocxx::v1::bulk_write::append: bson_append_value failed"};
+                }
+            } break;
+        }
+    }
+}
+
 template <typename Op>
 void append_sort(scoped_bson& options, Op const& op) {
     if (auto const opt = op.sort()) {
@@ -235,6 +275,95 @@ void append_replace_one(mongoc_bulk_operation_t* bulk, v1::bulk_write::replace_o
     }
 }
 
+void append_insert_one(mongoc_bulk_operation_t* bulk, v1::bulk_write::insert_one_view const& op) {
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_insert_with_opts(bulk, scoped_bson_view{op.value}.bson(), nullptr, &error)) {
+        v1::throw_exception(error);
+    }
+}
+
+void append_delete_one(mongoc_bulk_operation_t* bulk, v1::bulk_write::delete_one_view const& op) {
+    scoped_bson options;
+
+    append_collation(options, op);
+    append_hint_view(options, op);
+
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_remove_one_with_opts(
+            bulk, scoped_bson_view{op.filter()}.bson(), options.bson(), &error)) {
+        v1::throw_exception(error);
+    }
+}
+
+void append_delete_many(mongoc_bulk_operation_t* bulk, v1::bulk_write::delete_many_view const& op) {
+    scoped_bson options;
+
+    append_collation(options, op);
+    append_hint_view(options, op);
+
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_remove_many_with_opts(
+            bulk, scoped_bson_view{op.filter()}.bson(), options.bson(), &error)) {
+        v1::throw_exception(error);
+    }
+}
+
+void append_update_one(mongoc_bulk_operation_t* bulk, v1::bulk_write::update_one_view const& op) {
+    scoped_bson options;
+
+    append_collation(options, op);
+    append_hint_view(options, op);
+    append_sort(options, op);
+    append_upsert(options, op);
+    append_array_filters(options, op);
+
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_update_one_with_opts(
+            bulk, scoped_bson_view{op.filter()}.bson(), scoped_bson_view{op.update()}.bson(), options.bson(), &error)) {
+        v1::throw_exception(error);
+    }
+}
+
+void append_update_many(mongoc_bulk_operation_t* bulk, v1::bulk_write::update_many_view const& op) {
+    scoped_bson options;
+
+    append_collation(options, op);
+    append_hint_view(options, op);
+    append_upsert(options, op);
+    append_array_filters(options, op);
+
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_update_many_with_opts(
+            bulk, scoped_bson_view{op.filter()}.bson(), scoped_bson_view{op.update()}.bson(), options.bson(), &error)) {
+        v1::throw_exception(error);
+    }
+}
+
+void append_replace_one(mongoc_bulk_operation_t* bulk, v1::bulk_write::replace_one_view const& op) {
+    scoped_bson options;
+
+    append_collation(options, op);
+    append_hint_view(options, op);
+    append_sort(options, op);
+    append_upsert(options, op);
+
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_replace_one_with_opts(
+            bulk,
+            scoped_bson_view{op.filter()}.bson(),
+            scoped_bson_view{op.replacement()}.bson(),
+            options.bson(),
+            &error)) {
+        v1::throw_exception(error);
+    }
+}
+
 } // namespace
 
 bulk_write& bulk_write::append(single const& op) {
@@ -268,6 +397,60 @@ bulk_write& bulk_write::append(single const& op) {
     return *this;
 }
 
+bulk_write& bulk_write::append(insert_one_view const& op) {
+    auto& self = impl::with(*this);
+
+    append_insert_one(self._bulk, op);
+    self._is_empty = false;
+
+    return *this;
+}
+
+bulk_write& bulk_write::append(update_one_view const& op) {
+    auto& self = impl::with(*this);
+
+    append_update_one(self._bulk, op);
+    self._is_empty = false;
+
+    return *this;
+}
+
+bulk_write& bulk_write::append(update_many_view const& op) {
+    auto& self = impl::with(*this);
+
+    append_update_many(self._bulk, op);
+    self._is_empty = false;
+
+    return *this;
+}
+
+bulk_write& bulk_write::append(replace_one_view const& op) {
+    auto& self = impl::with(*this);
+
+    append_replace_one(self._bulk, op);
+    self._is_empty = false;
+
+    return *this;
+}
+
+bulk_write& bulk_write::append(delete_one_view const& op) {
+    auto& self = impl::with(*this);
+
+    append_delete_one(self._bulk, op);
+    self._is_empty = false;
+
+    return *this;
+}
+
+bulk_write& bulk_write::append(delete_many_view const& op) {
+    auto& self = impl::with(*this);
+
+    append_delete_many(self._bulk, op);
+    self._is_empty = false;
+
+    return *this;
+}
+
 bsoncxx::v1::stdx::optional<bulk_write::result> bulk_write::execute() {
     scoped_bson reply;
     bson_error_t error = {};
@@ -299,6 +482,10 @@ bool& bulk_write::internal::is_empty(bulk_write& self) {
     return impl::with(self)._is_empty;
 }
 
+std::unique_ptr<bulk_write::internal::insert_many_type>& bulk_write::internal::insert_many(bulk_write& self) {
+    return impl::with(self)._insert_many;
+}
+
 class bulk_write::update_one::impl {
    public:
     bsoncxx::v1::document::value _filter;
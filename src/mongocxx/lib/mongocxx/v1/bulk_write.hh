@@ -27,6 +27,11 @@
 #include <bsoncxx/v1/array/value.hpp>
 #include <bsoncxx/v1/stdx/optional.hpp>
 
+#include <mongocxx/v1/insert_many_options.hpp>
+
+#include <cstdint>
+#include <memory>
+
 #include <mongocxx/private/export.hh>
 #include <mongocxx/private/mongoc.hh>
 #include <mongocxx/private/scoped_bson.hh>
@@ -41,6 +46,29 @@ class bulk_write::internal {
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(mongoc_bulk_operation_t*) as_mongoc(bulk_write& self);
 
     static bool& is_empty(bulk_write& self);
+
+    // State of a bulk write operation created by `v1::collection::insert_many()`.
+    class insert_many_type {
+       public:
+        v1::insert_many_options::id_mode mode;
+        std::int64_t count = 0;       // The number of documents appended so far.
+        bson_t* ids = bson_new();     // The reported document IDs, keyed by operation index.
+        bson_t* scratch = bson_new(); // Reused to prepend a generated "_id" field to a document.
+
+        ~insert_many_type() {
+            bson_destroy(scratch);
+            bson_destroy(ids);
+        }
+
+        insert_many_type(insert_many_type&& other) = delete;
+        insert_many_type& operator=(insert_many_type&& other) = delete;
+        insert_many_type(insert_many_type const& other) = delete;
+        insert_many_type& operator=(insert_many_type const& other) = delete;
+
+        explicit insert_many_type(v1::insert_many_options::id_mode v) : mode{v} {}
+    };
+
+    static std::unique_ptr<insert_many_type>& insert_many(bulk_write& self);
 };
 
 class bulk_write::update_one::internal {
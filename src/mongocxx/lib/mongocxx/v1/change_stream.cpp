@@ -422,6 +422,11 @@ bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>& change_stream::option
     return impl::with(self)._start_after;
 }
 
+bsoncxx::v1::stdx::optional<bsoncxx::v1::types::b_timestamp>& change_stream::options::internal::start_at_operation_time(
+    options& self) {
+    return impl::with(self)._start_at_operation_time;
+}
+
 bsoncxx::v1::document::value change_stream::options::internal::to_document(v1::change_stream::options const& opts) {
     scoped_bson bson;
 
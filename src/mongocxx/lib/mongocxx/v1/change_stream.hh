@@ -21,6 +21,7 @@
 #include <bsoncxx/v1/document/value-fwd.hpp>
 #include <bsoncxx/v1/document/view-fwd.hpp>
 #include <bsoncxx/v1/types/value-fwd.hpp>
+#include <bsoncxx/v1/types/view-fwd.hpp>
 
 #include <bsoncxx/v1/stdx/optional.hpp>
 
@@ -62,6 +63,7 @@ class change_stream::options::internal {
     static bsoncxx::v1::stdx::optional<std::string>& full_document_before_change(options& self);
     static bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>& resume_after(options& self);
     static bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>& start_after(options& self);
+    static bsoncxx::v1::stdx::optional<bsoncxx::v1::types::b_timestamp>& start_at_operation_time(options& self);
 
     static bsoncxx::v1::document::value to_document(options const& self);
 };
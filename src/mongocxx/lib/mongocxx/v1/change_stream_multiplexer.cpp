@@ -0,0 +1,1193 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/change_stream_multiplexer.hh>
+
+//
+
+#include <bsoncxx/v1/array/view.hpp>
+#include <bsoncxx/v1/document/shared_value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/server_error.hpp>
+
+#include <mongocxx/v1/change_stream.hh>
+#include <mongocxx/v1/exception.hh>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = change_stream_multiplexer::errc;
+
+namespace {
+
+using bsoncxx::v1::types::id;
+
+constexpr std::chrono::milliseconds default_max_await_time{1000};
+constexpr std::size_t default_queue_size = 1024u;
+
+// The delay before reestablishing a failed upstream change stream is doubled after every consecutive failure, up to
+// this multiple of the "max_await_time" field.
+constexpr int max_backoff_factor = 32;
+
+bool is_number(id t) {
+    return t == id::k_int32 || t == id::k_int64 || t == id::k_double;
+}
+
+std::int64_t as_int64(bsoncxx::v1::types::view v) {
+    return v.type_id() == id::k_int32 ? v.get_int32().value : v.get_int64().value;
+}
+
+double as_double(bsoncxx::v1::types::view v) {
+    return v.type_id() == id::k_double ? v.get_double().value : static_cast<double>(as_int64(v));
+}
+
+template <typename T>
+int three_way(T const& lhs, T const& rhs) {
+    return (rhs < lhs) - (lhs < rhs);
+}
+
+// Set `result` to the ordering of `lhs` relative to `rhs`. Returns false if they are not comparable: numbers are
+// compared by value regardless of their BSON type, while strings, dates, and timestamps are only comparable with
+// values of the same BSON type.
+bool compare(bsoncxx::v1::types::view lhs, bsoncxx::v1::types::view rhs, int& result) {
+    if (is_number(lhs.type_id()) && is_number(rhs.type_id())) {
+        if (lhs.type_id() != id::k_double && rhs.type_id() != id::k_double) {
+            result = three_way(as_int64(lhs), as_int64(rhs));
+            return true;
+        }
+
+        auto const l = as_double(lhs);
+        auto const r = as_double(rhs);
+
+        if (std::isnan(l) || std::isnan(r)) {
+            return false;
+        }
+
+        result = three_way(l, r);
+        return true;
+    }
+
+    if (lhs.type_id() != rhs.type_id()) {
+        return false;
+    }
+
+    switch (lhs.type_id()) {
+        case id::k_string:
+            result = lhs.get_string().value.compare(rhs.get_string().value);
+            result = (result > 0) - (result < 0);
+            return true;
+
+        case id::k_date:
+            result = three_way(lhs.get_date().value, rhs.get_date().value);
+            return true;
+
+        case id::k_timestamp: {
+            auto const l = lhs.get_timestamp();
+            auto const r = rhs.get_timestamp();
+
+            result = l.timestamp != r.timestamp ? three_way(l.timestamp, r.timestamp)
+                                                : three_way(l.increment, r.increment);
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool equal(bsoncxx::v1::types::view lhs, bsoncxx::v1::types::view rhs) {
+    if (is_number(lhs.type_id()) && is_number(rhs.type_id())) {
+        int result = 0;
+        return compare(lhs, rhs, result) && result == 0;
+    }
+
+    return lhs == rhs;
+}
+
+bool is_truthy(bsoncxx::v1::types::view v) {
+    if (v.type_id() == id::k_bool) {
+        return v.get_bool().value;
+    }
+
+    if (is_number(v.type_id())) {
+        return as_double(v) != 0.0;
+    }
+
+    return v.type_id() != id::k_null && v.type_id() != id::k_undefined;
+}
+
+bool is_operator_document(bsoncxx::v1::element::view e) {
+    if (e.type_id() != id::k_document) {
+        return false;
+    }
+
+    auto const doc = e.get_document().value;
+    auto const iter = doc.begin();
+
+    return iter != doc.end() && !iter->key().empty() && iter->key()[0] == '$';
+}
+
+bool is_digits(bsoncxx::v1::stdx::string_view part) {
+    return !part.empty() && part.find_first_not_of("0123456789") == bsoncxx::v1::stdx::string_view::npos;
+}
+
+// Set `index` to the array index denoted by `part`. Returns false if `part` is not a decimal integer or exceeds the
+// maximum number of elements in a BSON array.
+bool parse_index(bsoncxx::v1::stdx::string_view part, std::uint32_t& index) {
+    constexpr std::uint32_t max_index = INT32_MAX;
+
+    if (!is_digits(part) || part.size() > 10u) {
+        return false;
+    }
+
+    std::uint64_t v = 0u;
+
+    for (auto const c : part) {
+        v = v * 10u + static_cast<std::uint64_t>(c - '0');
+    }
+
+    if (v > max_index) {
+        return false;
+    }
+
+    index = static_cast<std::uint32_t>(v);
+
+    return true;
+}
+
+// Return false if a component of the (possibly dotted) field path `path` cannot be used as an array index.
+bool is_valid_path(bsoncxx::v1::stdx::string_view path) {
+    for (;;) {
+        auto const pos = path.find('.');
+        auto const part = path.substr(0u, pos);
+
+        std::uint32_t index = 0u;
+
+        if (is_digits(part) && !parse_index(part, index)) {
+            return false;
+        }
+
+        if (pos == bsoncxx::v1::stdx::string_view::npos) {
+            return true;
+        }
+
+        path = path.substr(pos + 1u);
+    }
+}
+
+// Resolve the (possibly dotted) field path `path`. Array elements are addressed by their index. Sets `unsupported`
+// when the path traverses an array other than by index (e.g. "a.b" where "a" is an array of documents).
+bsoncxx::v1::element::view resolve(
+    bsoncxx::v1::document::view doc,
+    bsoncxx::v1::stdx::string_view path,
+    bool& unsupported) {
+    auto pos = path.find('.');
+    auto e = doc[path.substr(0u, pos)];
+
+    while (e && pos != bsoncxx::v1::stdx::string_view::npos) {
+        path = path.substr(pos + 1u);
+        pos = path.find('.');
+
+        auto const part = path.substr(0u, pos);
+
+        if (e.type_id() == id::k_array) {
+            std::uint32_t index = 0u;
+
+            if (!parse_index(part, index)) {
+                unsupported = true;
+                return {};
+            }
+
+            e = e[index];
+        } else {
+            e = e[part];
+        }
+    }
+
+    return e;
+}
+
+// A condition on an array field matches when the array or any of its elements matches.
+template <typename Fn>
+bool any_value(bsoncxx::v1::element::view e, Fn fn) {
+    auto const v = e.type_view();
+
+    if (fn(v)) {
+        return true;
+    }
+
+    if (v.type_id() == id::k_array) {
+        for (auto const& elem : v.get_array().value) {
+            if (fn(elem.type_view())) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool match_value(bsoncxx::v1::element::view e, bsoncxx::v1::types::view operand) {
+    if (!e) {
+        return operand.type_id() == id::k_null;
+    }
+
+    return any_value(e, [&](bsoncxx::v1::types::view v) { return equal(v, operand); });
+}
+
+template <typename Pred>
+bool match_ordered(bsoncxx::v1::element::view e, bsoncxx::v1::types::view operand, Pred pred) {
+    if (!e) {
+        return false;
+    }
+
+    return any_value(e, [&](bsoncxx::v1::types::view v) {
+        int result = 0;
+        return compare(v, operand, result) && pred(result);
+    });
+}
+
+bool match_in(bsoncxx::v1::element::view e, bsoncxx::v1::types::view operand) {
+    for (auto const& candidate : operand.get_array().value) {
+        if (match_value(e, candidate.type_view())) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool match_condition(bsoncxx::v1::element::view e, bsoncxx::v1::element::view cond);
+
+bool match_operators(bsoncxx::v1::element::view e, bsoncxx::v1::document::view ops) {
+    for (auto const& op : ops) {
+        auto const name = op.key();
+        auto const operand = op.type_view();
+
+        bool ok = false;
+
+        if (name == "$eq") {
+            ok = match_value(e, operand);
+        } else if (name == "$ne") {
+            ok = !match_value(e, operand);
+        } else if (name == "$gt") {
+            ok = match_ordered(e, operand, [](int r) { return r > 0; });
+        } else if (name == "$gte") {
+            ok = match_ordered(e, operand, [](int r) { return r >= 0; });
+        } else if (name == "$lt") {
+            ok = match_ordered(e, operand, [](int r) { return r < 0; });
+        } else if (name == "$lte") {
+            ok = match_ordered(e, operand, [](int r) { return r <= 0; });
+        } else if (name == "$in") {
+            ok = match_in(e, operand);
+        } else if (name == "$nin") {
+            ok = !match_in(e, operand);
+        } else if (name == "$exists") {
+            ok = static_cast<bool>(e) == is_truthy(operand);
+        } else if (name == "$not") {
+            ok = !match_condition(e, op);
+        }
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool match_condition(bsoncxx::v1::element::view e, bsoncxx::v1::element::view cond) {
+    if (is_operator_document(cond)) {
+        return match_operators(e, cond.get_document().value);
+    }
+
+    return match_value(e, cond.type_view());
+}
+
+bool is_valid_operators(bsoncxx::v1::document::view ops) {
+    for (auto const& op : ops) {
+        auto const name = op.key();
+
+        if (name == "$in" || name == "$nin") {
+            if (op.type_id() != id::k_array) {
+                return false;
+            }
+        } else if (name == "$not") {
+            if (!is_operator_document(op) || !is_valid_operators(op.get_document().value)) {
+                return false;
+            }
+        } else if (
+            name != "$eq" && name != "$ne" && name != "$gt" && name != "$gte" && name != "$lt" && name != "$lte" &&
+            name != "$exists") {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Return true when `doc` matches `filter`. Sets `unsupported` when `filter` cannot be evaluated against `doc`.
+bool match_filter(bsoncxx::v1::document::view filter, bsoncxx::v1::document::view doc, bool& unsupported) {
+    for (auto const& e : filter) {
+        auto const key = e.key();
+
+        if (key == "$and" || key == "$or" || key == "$nor") {
+            bool any = false;
+            bool all = true;
+
+            for (auto const& sub : e.get_array().value) {
+                if (match_filter(sub.get_document().value, doc, unsupported)) {
+                    any = true;
+                } else {
+                    all = false;
+                }
+            }
+
+            if ((key == "$and" && !all) || (key == "$or" && !any) || (key == "$nor" && any)) {
+                return false;
+            }
+
+            continue;
+        }
+
+        if (!match_condition(resolve(doc, key, unsupported), e)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool is_invalidate(bsoncxx::v1::document::view event) {
+    auto const e = event["operationType"];
+    return e && e.type_id() == id::k_string && e.get_string().value == "invalidate";
+}
+
+} // namespace
+
+class change_stream_multiplexer::subscription::internal::queue {
+   public:
+    bsoncxx::v1::document::value const _filter;
+    std::size_t const _capacity;
+
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::deque<bsoncxx::v1::document::shared_value> _events;
+
+    bool _unsubscribed = false; // The subscription was destroyed.
+    bool _closed = false;       // The multiplexer was destroyed or the upstream change stream failed.
+    std::exception_ptr _error;  // The error which terminated the upstream change stream.
+
+    queue(bsoncxx::v1::document::view filter, std::size_t capacity) : _filter{filter}, _capacity{capacity} {}
+
+    // Block while full. Returns false if the event can no longer be delivered.
+    bool push(bsoncxx::v1::document::shared_value const& event) {
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _not_full.wait(lock, [&] { return _unsubscribed || _closed || _events.size() < _capacity; });
+
+            if (_unsubscribed || _closed) {
+                return false;
+            }
+
+            _events.push_back(event);
+        }
+
+        _not_empty.notify_one();
+
+        return true;
+    }
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value> pop(std::chrono::milliseconds timeout) {
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value> ret;
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _not_empty.wait_for(lock, timeout, [&] { return _closed || !_events.empty(); });
+
+            if (_events.empty()) {
+                if (_error) {
+                    std::rethrow_exception(_error);
+                }
+
+                return ret;
+            }
+
+            ret.emplace(std::move(_events.front()));
+            _events.pop_front();
+        }
+
+        _not_full.notify_one();
+
+        return ret;
+    }
+
+    void unsubscribe() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _unsubscribed = true;
+        }
+
+        _not_full.notify_all();
+    }
+
+    bool unsubscribed() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _unsubscribed;
+    }
+
+    void close(std::exception_ptr error = nullptr) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _closed = true;
+            _error = std::move(error);
+        }
+
+        _not_empty.notify_all();
+        _not_full.notify_all();
+    }
+
+    bool closed() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _closed;
+    }
+};
+
+namespace {
+
+using queue_type = change_stream_multiplexer::subscription::internal::queue;
+
+// The upstream change stream of a collection.
+struct channel {
+    std::string db_name;
+    std::string coll_name;
+
+    // Guarded by the mutex of the multiplexer.
+    std::vector<std::shared_ptr<queue_type>> subscribers;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> resume_token;
+    bool invalidated = false; // The resume token is that of an "invalidate" event.
+    bool closed = false;      // Removed from the multiplexer: the watcher must stop.
+
+    std::thread watcher;
+};
+
+} // namespace
+
+class change_stream_multiplexer::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<v1::change_stream::options> _change_stream_options;
+    bsoncxx::v1::stdx::optional<std::size_t> _queue_size;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class change_stream_multiplexer::subscription::impl {
+   public:
+    std::shared_ptr<internal::queue> _queue;
+
+    static impl const& with(subscription const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl& with(subscription& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class change_stream_multiplexer::impl {
+   public:
+    using key_type = std::pair<std::string, std::string>;
+
+    v1::pool* _pool;
+    v1::change_stream::options _change_stream_options;
+    std::chrono::milliseconds _max_await_time;
+    std::size_t _queue_size;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stopping = false;
+
+    std::map<key_type, std::unique_ptr<channel>> _channels;
+    std::vector<std::unique_ptr<channel>> _closed; // Channels whose watcher has yet to be joined.
+
+    ~impl() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            _stopping = true;
+
+            for (auto const& kv : _channels) {
+                for (auto const& q : kv.second->subscribers) {
+                    q->close();
+                }
+            }
+        }
+
+        _cv.notify_all();
+
+        // Channels are not closed once `_stopping` is set.
+        for (auto const& kv : _channels) {
+            join(*kv.second);
+        }
+
+        for (auto const& ch : _closed) {
+            join(*ch);
+        }
+    }
+
+    impl(impl&& other) noexcept = delete;
+    impl& operator=(impl&& other) noexcept = delete;
+    impl(impl const& other) = delete;
+    impl& operator=(impl const& other) = delete;
+
+    impl(v1::pool& pool, v1::change_stream::options change_stream_options, std::size_t queue_size)
+        : _pool{&pool},
+          _change_stream_options{std::move(change_stream_options)},
+          _max_await_time{_change_stream_options.max_await_time().value_or(default_max_await_time)},
+          _queue_size{queue_size} {
+        if (!_change_stream_options.max_await_time()) {
+            _change_stream_options.max_await_time(_max_await_time);
+        }
+    }
+
+    subscription subscribe(
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::document::view filter) {
+        if (!change_stream_multiplexer::internal::is_valid(filter)) {
+            throw v1::exception::internal::make(code::invalid_filter);
+        }
+
+        auto q = std::make_shared<queue_type>(filter, _queue_size);
+
+        std::vector<std::unique_ptr<channel>> closed;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            auto& ch = _channels[key_type{std::string{db_name}, std::string{coll_name}}];
+
+            if (!ch) {
+                ch.reset(new channel{});
+                ch->db_name = std::string{db_name};
+                ch->coll_name = std::string{coll_name};
+
+                auto const ptr = ch.get();
+                ch->watcher = std::thread{[this, ptr] { this->run(*ptr); }};
+            }
+
+            ch->subscribers.push_back(q);
+
+            closed.swap(_closed);
+        }
+
+        // Joined without holding `_mutex`: the watchers of closed channels may still acquire it before they stop.
+        for (auto const& ptr : closed) {
+            join(*ptr);
+        }
+
+        return subscription::internal::make(std::move(q));
+    }
+
+    static void join(channel& ch) {
+        if (ch.watcher.joinable()) {
+            ch.watcher.join();
+        }
+    }
+
+    channel* find(bsoncxx::v1::stdx::string_view db_name, bsoncxx::v1::stdx::string_view coll_name) const {
+        auto const iter = _channels.find(key_type{std::string{db_name}, std::string{coll_name}});
+        return iter == _channels.end() ? nullptr : iter->second.get();
+    }
+
+    // Remove destroyed subscriptions. `_mutex` must be held.
+    static void prune(channel& ch) {
+        auto& subs = ch.subscribers;
+
+        for (auto iter = subs.begin(); iter != subs.end();) {
+            if ((*iter)->unsubscribed()) {
+                iter = subs.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+
+    // Remove `ch` from the multiplexer so that subsequent subscriptions open a new upstream change stream. The watcher
+    // of `ch` stops once it observes `ch.closed`. `_mutex` must be held.
+    void remove(channel& ch) {
+        if (ch.closed || _stopping) {
+            return;
+        }
+
+        auto const iter = _channels.find(key_type{ch.db_name, ch.coll_name});
+
+        ch.closed = true;
+        _closed.push_back(std::move(iter->second));
+        _channels.erase(iter);
+    }
+
+    // Return false when the watcher of `ch` must stop. Removes `ch` once its last subscription is destroyed.
+    bool active(channel& ch) {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        if (_stopping || ch.closed) {
+            return false;
+        }
+
+        prune(ch);
+
+        if (ch.subscribers.empty()) {
+            this->remove(ch);
+            return false;
+        }
+
+        return true;
+    }
+
+    // Close every subscription of `ch` with `error` and remove `ch`.
+    void close(channel& ch, std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            for (auto const& q : ch.subscribers) {
+                q->close(error);
+            }
+
+            ch.subscribers.clear();
+
+            this->remove(ch);
+        }
+
+        _cv.notify_all();
+    }
+
+    // Deliver `event` to every matching subscription. The event document is copied at most once. The resume token is
+    // only advanced once the event has been delivered.
+    void publish(channel& ch, bsoncxx::v1::document::view event) {
+        std::vector<std::shared_ptr<queue_type>> subscribers;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            prune(ch);
+            subscribers = ch.subscribers;
+        }
+
+        bsoncxx::v1::document::shared_value shared;
+
+        for (auto const& q : subscribers) {
+            if (!change_stream_multiplexer::internal::matches(q->_filter.view(), event)) {
+                continue;
+            }
+
+            if (!shared) {
+                shared = bsoncxx::v1::document::shared_value{event};
+            }
+
+            q->push(shared);
+        }
+
+        auto const token = event["_id"];
+
+        if (token && token.type_id() == id::k_document) {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            ch.resume_token.emplace(token.get_document().value);
+            ch.invalidated = is_invalidate(event);
+        }
+    }
+
+    // Observe change events until the upstream change stream fails or is invalidated, the multiplexer is destroyed, or
+    // the last subscription of `ch` is destroyed. Resets `delay` once the upstream change stream is established.
+    void watch(channel& ch, std::chrono::milliseconds& delay) {
+        auto opts = _change_stream_options;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            // Resume after (or start after an "invalidate" event with) the latest resume token.
+            if (ch.resume_token) {
+                v1::change_stream::options::internal::resume_after(opts).reset();
+                v1::change_stream::options::internal::start_after(opts).reset();
+                v1::change_stream::options::internal::start_at_operation_time(opts).reset();
+
+                if (ch.invalidated) {
+                    v1::change_stream::options::internal::start_after(opts) = *ch.resume_token;
+                } else {
+                    v1::change_stream::options::internal::resume_after(opts) = *ch.resume_token;
+                }
+            }
+        }
+
+        auto entry = _pool->acquire();
+        auto stream = entry->database(ch.db_name)[ch.coll_name].watch(opts);
+
+        delay = _max_await_time;
+
+        while (this->active(ch)) {
+            auto const event = stream.try_next();
+
+            if (event) {
+                this->publish(ch, *event);
+
+                if (is_invalidate(*event)) {
+                    return;
+                }
+
+                continue;
+            }
+
+            if (auto const token = stream.get_resume_token()) {
+                if (!token->empty()) {
+                    std::lock_guard<std::mutex> lock{_mutex};
+
+                    ch.resume_token.emplace(*token);
+                    ch.invalidated = false;
+                }
+            }
+        }
+    }
+
+    void run(channel& ch) noexcept {
+        auto delay = _max_await_time;
+
+        while (this->active(ch)) {
+            try {
+                this->watch(ch, delay);
+            } catch (v1::server_error const& ex) {
+                // Resumable errors are already retried once by the upstream change stream.
+                if (!ex.has_error_label("ResumableChangeStreamError")) {
+                    this->close(ch, std::current_exception());
+                    return;
+                }
+            } catch (v1::exception const& ex) {
+                // Network and server selection errors.
+                if (ex.code() != v1::source_errc::mongoc) {
+                    this->close(ch, std::current_exception());
+                    return;
+                }
+            } catch (...) {
+                this->close(ch, std::current_exception());
+                return;
+            }
+
+            // Reestablish the upstream change stream after a delay.
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+
+                if (_cv.wait_for(lock, delay, [&] { return _stopping || ch.closed; })) {
+                    return;
+                }
+            }
+
+            delay = (std::min)(delay * 2, _max_await_time * max_backoff_factor);
+        }
+    }
+
+    static impl const& with(change_stream_multiplexer const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(change_stream_multiplexer const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(change_stream_multiplexer& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(change_stream_multiplexer* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+change_stream_multiplexer::~change_stream_multiplexer() {
+    delete impl::with(this);
+}
+
+change_stream_multiplexer::change_stream_multiplexer(change_stream_multiplexer&& other) noexcept
+    : _impl{exchange(other._impl, nullptr)} {}
+
+change_stream_multiplexer& change_stream_multiplexer::operator=(change_stream_multiplexer&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+change_stream_multiplexer::change_stream_multiplexer(v1::pool& pool, options const& opts) : _impl{nullptr} {
+    auto const queue_size = opts.queue_size().value_or(default_queue_size);
+
+    if (queue_size == 0u) {
+        throw v1::exception::internal::make(code::invalid_queue_size);
+    }
+
+    _impl = new impl{pool, opts.change_stream_options().value_or(v1::change_stream::options{}), queue_size};
+}
+
+change_stream_multiplexer::change_stream_multiplexer(v1::pool& pool) : change_stream_multiplexer{pool, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+change_stream_multiplexer::operator bool() const {
+    return _impl != nullptr;
+}
+
+change_stream_multiplexer::subscription change_stream_multiplexer::subscribe(
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    bsoncxx::v1::document::view filter) {
+    return impl::with(this)->subscribe(db_name, coll_name, filter);
+}
+
+change_stream_multiplexer::subscription change_stream_multiplexer::subscribe(
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name) {
+    return impl::with(this)->subscribe(db_name, coll_name, bsoncxx::v1::document::view{});
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> change_stream_multiplexer::resume_token(
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name) const {
+    auto const& self = impl::with(*this);
+
+    std::lock_guard<std::mutex> lock{self._mutex};
+
+    if (auto const ch = self.find(db_name, coll_name)) {
+        return ch->resume_token;
+    }
+
+    return {};
+}
+
+std::size_t change_stream_multiplexer::upstream_count() const {
+    auto const& self = impl::with(*this);
+
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._channels.size();
+}
+
+std::error_category const& change_stream_multiplexer::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::change_stream_multiplexer";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_queue_size:
+                    return "the queue size must be greater than zero";
+                case code::invalid_filter:
+                    return "the filter uses an unsupported query operator or an invalid field path";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_queue_size:
+                    case code::invalid_filter:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_queue_size:
+                    case code::invalid_filter:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+bool change_stream_multiplexer::internal::is_valid(bsoncxx::v1::document::view filter) {
+    for (auto const& e : filter) {
+        auto const key = e.key();
+
+        if (key == "$and" || key == "$or" || key == "$nor") {
+            if (e.type_id() != id::k_array || e.get_array().value.empty()) {
+                return false;
+            }
+
+            for (auto const& sub : e.get_array().value) {
+                if (sub.type_id() != id::k_document || !is_valid(sub.get_document().value)) {
+                    return false;
+                }
+            }
+
+            continue;
+        }
+
+        if (!key.empty() && key[0] == '$') {
+            return false;
+        }
+
+        if (!is_valid_path(key)) {
+            return false;
+        }
+
+        if (is_operator_document(e) && !is_valid_operators(e.get_document().value)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool change_stream_multiplexer::internal::matches(
+    bsoncxx::v1::document::view filter,
+    bsoncxx::v1::document::view doc) {
+    bool unsupported = false;
+
+    auto const ret = match_filter(filter, doc, unsupported);
+
+    return ret && !unsupported;
+}
+
+void change_stream_multiplexer::internal::publish(
+    change_stream_multiplexer& self,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    bsoncxx::v1::document::view event) {
+    auto& mux = impl::with(self);
+
+    channel* ch = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock{mux._mutex};
+        ch = mux.find(db_name, coll_name);
+    }
+
+    if (ch) {
+        mux.publish(*ch, event);
+    }
+}
+
+void change_stream_multiplexer::internal::close(
+    change_stream_multiplexer& self,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    std::exception_ptr error) {
+    auto& mux = impl::with(self);
+
+    channel* ch = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock{mux._mutex};
+        ch = mux.find(db_name, coll_name);
+    }
+
+    if (ch) {
+        mux.close(*ch, std::move(error));
+    }
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+change_stream_multiplexer::subscription::~subscription() {
+    if (auto const ptr = impl::with(_impl)) {
+        ptr->_queue->unsubscribe();
+    }
+
+    delete impl::with(_impl);
+}
+
+change_stream_multiplexer::subscription::subscription(subscription&& other) noexcept
+    : _impl{exchange(other._impl, nullptr)} {}
+
+change_stream_multiplexer::subscription& change_stream_multiplexer::subscription::operator=(
+    subscription&& other) noexcept {
+    if (this != &other) {
+        if (auto const ptr = impl::with(_impl)) {
+            ptr->_queue->unsubscribe();
+        }
+
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+change_stream_multiplexer::subscription::subscription(void* impl) : _impl{impl} {}
+
+change_stream_multiplexer::subscription change_stream_multiplexer::subscription::internal::make(
+    std::shared_ptr<queue> q) {
+    return {new subscription::impl{std::move(q)}};
+}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+change_stream_multiplexer::subscription::operator bool() const {
+    return _impl != nullptr;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value> change_stream_multiplexer::subscription::try_next() {
+    return impl::with(*this)._queue->pop(std::chrono::milliseconds{0});
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value> change_stream_multiplexer::subscription::next(
+    std::chrono::milliseconds timeout) {
+    return impl::with(*this)._queue->pop(timeout);
+}
+
+bool change_stream_multiplexer::subscription::closed() const {
+    return impl::with(*this)._queue->closed();
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+change_stream_multiplexer::options::~options() {
+    delete impl::with(_impl);
+}
+
+change_stream_multiplexer::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+change_stream_multiplexer::options& change_stream_multiplexer::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+change_stream_multiplexer::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+change_stream_multiplexer::options& change_stream_multiplexer::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+change_stream_multiplexer::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+change_stream_multiplexer::options& change_stream_multiplexer::options::change_stream_options(
+    v1::change_stream::options v) {
+    impl::with(this)->_change_stream_options = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<v1::change_stream::options> change_stream_multiplexer::options::change_stream_options()
+    const {
+    return impl::with(this)->_change_stream_options;
+}
+
+change_stream_multiplexer::options& change_stream_multiplexer::options::queue_size(std::size_t v) {
+    impl::with(this)->_queue_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> change_stream_multiplexer::options::queue_size() const {
+    return impl::with(this)->_queue_size;
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,68 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/change_stream_multiplexer.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <exception>
+#include <memory>
+
+#include <mongocxx/private/export.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class change_stream_multiplexer::internal {
+   public:
+    // Return true when `filter` only uses supported query operators.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bool) is_valid(bsoncxx::v1::document::view filter);
+
+    // Return true when `doc` matches `filter`, which must be valid.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bool) matches(
+        bsoncxx::v1::document::view filter,
+        bsoncxx::v1::document::view doc);
+
+    // Deliver `event` as though it was obtained by the upstream change stream of the collection `coll_name` in the
+    // database `db_name`. Does nothing if the collection has no upstream change stream.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(void) publish(
+        change_stream_multiplexer& self,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::document::view event);
+
+    // Close every subscription to the collection `coll_name` in the database `db_name` with `error` as though it
+    // terminated the upstream change stream. Does nothing if the collection has no upstream change stream.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(void) close(
+        change_stream_multiplexer& self,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        std::exception_ptr error);
+};
+
+class change_stream_multiplexer::subscription::internal {
+   public:
+    // The events waiting to be obtained by a subscription. Shared with the upstream change stream.
+    class queue;
+
+    static subscription make(std::shared_ptr<queue> q);
+};
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,430 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/checkpoint_store.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/replace_one_options.hpp>
+#include <mongocxx/v1/replace_one_result.hpp>
+
+#include <mongocxx/v1/exception.hh>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#else
+#include <winsock2.h> // Must be included before <windows.h>.
+
+#include <windows.h>
+#endif
+
+#include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = checkpoint_store::errc;
+
+checkpoint_store::~checkpoint_store() = default;
+
+std::error_category const& checkpoint_store::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::checkpoint_store";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_checkpoint:
+                    return "the saved resume token is not a valid BSON document";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_checkpoint:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_checkpoint:
+                        return type == condition::runtime_error;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+namespace {
+
+[[noreturn]] void throw_errno(int err, char const* message) {
+    throw v1::exception::internal::make(err, std::generic_category(), message);
+}
+
+#if !defined(_WIN32)
+
+// Write `token` to a new file at `path` and flush it to durable storage.
+void write_file(std::string const& path, bsoncxx::v1::document::view token) {
+    int const fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (fd == -1) {
+        throw_errno(errno, "could not open the temporary checkpoint file");
+    }
+
+    auto data = token.data();
+    auto remaining = token.length();
+
+    while (remaining > 0u) {
+        auto const n = ::write(fd, data, remaining);
+
+        if (n < 0) {
+            auto const err = errno;
+
+            if (err == EINTR) {
+                continue;
+            }
+
+            (void)::close(fd);
+            throw_errno(err, "could not write the temporary checkpoint file");
+        }
+
+        data += n;
+        remaining -= static_cast<std::size_t>(n);
+    }
+
+    if (::fsync(fd) != 0) {
+        auto const err = errno;
+
+        (void)::close(fd);
+        throw_errno(err, "could not flush the temporary checkpoint file");
+    }
+
+    if (::close(fd) != 0) {
+        throw_errno(errno, "could not close the temporary checkpoint file");
+    }
+}
+
+// Replace the file at `to` with the file at `from`, then flush the directory entry to durable storage.
+void replace_file(std::string const& from, std::string const& to) {
+    if (std::rename(from.c_str(), to.c_str()) != 0) {
+        throw_errno(errno, "could not replace the checkpoint file");
+    }
+
+    auto const pos = to.find_last_of('/');
+    auto const dir = pos == std::string::npos ? std::string{"."} : to.substr(0u, (std::max)(pos, std::size_t{1}));
+
+    int const fd = ::open(dir.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd == -1) {
+        throw_errno(errno, "could not open the checkpoint directory");
+    }
+
+    // Some file systems do not support flushing a directory.
+    if (::fsync(fd) != 0 && errno != EINVAL) {
+        auto const err = errno;
+
+        (void)::close(fd);
+        throw_errno(err, "could not flush the checkpoint directory");
+    }
+
+    (void)::close(fd);
+}
+
+#else
+
+[[noreturn]] void throw_last_error(DWORD err, char const* message) {
+    throw v1::exception::internal::make(static_cast<int>(err), std::system_category(), message);
+}
+
+// Write `token` to a new file at `path` and flush it to durable storage.
+void write_file(std::string const& path, bsoncxx::v1::document::view token) {
+    HANDLE const file =
+        ::CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE) {
+        throw_last_error(::GetLastError(), "could not open the temporary checkpoint file");
+    }
+
+    // The length of a BSON document is representable as a 32-bit integer.
+    auto const length = static_cast<DWORD>(token.length());
+    DWORD written = 0;
+
+    if (!::WriteFile(file, token.data(), length, &written, nullptr) || written != length) {
+        auto const err = ::GetLastError();
+
+        (void)::CloseHandle(file);
+        throw_last_error(err, "could not write the temporary checkpoint file");
+    }
+
+    if (!::FlushFileBuffers(file)) {
+        auto const err = ::GetLastError();
+
+        (void)::CloseHandle(file);
+        throw_last_error(err, "could not flush the temporary checkpoint file");
+    }
+
+    (void)::CloseHandle(file);
+}
+
+// Replace the file at `to` with the file at `from`. The replacement is flushed to durable storage before returning.
+void replace_file(std::string const& from, std::string const& to) {
+    if (!::MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        throw_last_error(::GetLastError(), "could not replace the checkpoint file");
+    }
+}
+
+#endif // !defined(_WIN32)
+
+} // namespace
+
+class file_checkpoint_store::impl {
+   public:
+    std::string _path;
+    std::string _tmp_path;
+
+    explicit impl(bsoncxx::v1::stdx::string_view path) : _path{path}, _tmp_path{_path + ".tmp"} {}
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> load() const {
+        errno = 0;
+
+        std::ifstream file{_path, std::ios::binary};
+
+        if (!file) {
+            auto const err = errno;
+
+            if (err == ENOENT) {
+                return {};
+            }
+
+            throw_errno(err, "could not open the checkpoint file");
+        }
+
+        std::vector<std::uint8_t> const bytes{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+
+        if (file.bad()) {
+            throw_errno(errno, "could not read the checkpoint file");
+        }
+
+        bson_t bson;
+
+        if (!bson_init_static(&bson, bytes.data(), bytes.size()) ||
+            !bson_validate(&bson, BSON_VALIDATE_NONE, nullptr)) {
+            throw v1::exception::internal::make(code::invalid_checkpoint);
+        }
+
+        return bsoncxx::v1::document::value{bsoncxx::v1::document::view{bytes.data(), bytes.size()}};
+    }
+
+    // The temporary file is flushed to durable storage before it replaces the file, and the replacement is flushed
+    // before returning, such that a crash never leaves an empty or partially-written checkpoint file.
+    void save(bsoncxx::v1::document::view token) const {
+        write_file(_tmp_path, token);
+        replace_file(_tmp_path, _path);
+    }
+
+    static impl& with(file_checkpoint_store& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+file_checkpoint_store::~file_checkpoint_store() {
+    delete impl::with(_impl);
+}
+
+file_checkpoint_store::file_checkpoint_store(file_checkpoint_store&& other) noexcept
+    : checkpoint_store{std::move(other)}, _impl{exchange(other._impl, nullptr)} {}
+
+file_checkpoint_store& file_checkpoint_store::operator=(file_checkpoint_store&& other) noexcept {
+    if (this != &other) {
+        checkpoint_store::operator=(std::move(other));
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+file_checkpoint_store::file_checkpoint_store(bsoncxx::v1::stdx::string_view path) : _impl{new impl{path}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+file_checkpoint_store::operator bool() const {
+    return _impl != nullptr;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> file_checkpoint_store::load() {
+    return impl::with(*this).load();
+}
+
+void file_checkpoint_store::save(bsoncxx::v1::document::view token) {
+    impl::with(*this).save(token);
+}
+
+class collection_checkpoint_store::impl {
+   public:
+    v1::pool* _pool;
+    std::string _db_name;
+    std::string _coll_name;
+    std::string _key;
+
+    impl(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::stdx::string_view key)
+        : _pool{&pool}, _db_name{db_name}, _coll_name{coll_name}, _key{key} {}
+
+    scoped_bson filter() const {
+        return scoped_bson{BCON_NEW("_id", BCON_UTF8(_key.c_str()))};
+    }
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> load() const {
+        auto entry = _pool->acquire();
+        auto const doc = entry->database(_db_name)[_coll_name].find_one(this->filter().view());
+
+        if (!doc) {
+            return {};
+        }
+
+        auto const token = doc->view()["token"];
+
+        if (!token || token.type_id() != bsoncxx::v1::types::id::k_document) {
+            throw v1::exception::internal::make(code::invalid_checkpoint);
+        }
+
+        return bsoncxx::v1::document::value{token.get_document().value};
+    }
+
+    void save(bsoncxx::v1::document::view token) const {
+        scoped_bson doc{
+            BCON_NEW("_id", BCON_UTF8(_key.c_str()), "token", BCON_DOCUMENT(scoped_bson_view{token}.bson()))};
+
+        auto entry = _pool->acquire();
+        (void)entry->database(_db_name)[_coll_name].replace_one(
+            this->filter().view(), std::move(doc).value(), v1::replace_one_options{}.upsert(true));
+    }
+
+    static impl& with(collection_checkpoint_store& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+collection_checkpoint_store::~collection_checkpoint_store() {
+    delete impl::with(_impl);
+}
+
+collection_checkpoint_store::collection_checkpoint_store(collection_checkpoint_store&& other) noexcept
+    : checkpoint_store{std::move(other)}, _impl{exchange(other._impl, nullptr)} {}
+
+collection_checkpoint_store& collection_checkpoint_store::operator=(collection_checkpoint_store&& other) noexcept {
+    if (this != &other) {
+        checkpoint_store::operator=(std::move(other));
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+collection_checkpoint_store::collection_checkpoint_store(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    bsoncxx::v1::stdx::string_view key)
+    : _impl{new impl{pool, db_name, coll_name, key}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+collection_checkpoint_store::operator bool() const {
+    return _impl != nullptr;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> collection_checkpoint_store::load() {
+    return impl::with(*this).load();
+}
+
+void collection_checkpoint_store::save(bsoncxx::v1::document::view token) {
+    impl::with(*this).save(token);
+}
+
+} // namespace v1
+} // namespace mongocxx
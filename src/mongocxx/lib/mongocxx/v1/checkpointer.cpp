@@ -0,0 +1,459 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/checkpointer.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/checkpoint_store.hpp>
+
+#include <mongocxx/v1/change_stream.hh>
+#include <mongocxx/v1/exception.hh>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = checkpointer::errc;
+
+namespace {
+
+constexpr std::chrono::milliseconds default_flush_interval{1000};
+constexpr std::size_t default_flush_count = 1000u;
+
+} // namespace
+
+class checkpointer::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<std::size_t> _flush_count;
+    bsoncxx::v1::stdx::optional<std::chrono::milliseconds> _flush_interval;
+    bsoncxx::v1::stdx::optional<bool> _start_after;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class checkpointer::impl {
+   public:
+    v1::checkpoint_store* _store;
+    std::chrono::milliseconds _flush_interval;
+    std::size_t _flush_count;
+    bool _start_after;
+
+    std::mutex _store_mutex; // Serializes access to the checkpoint store.
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stopping = false;
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _latest; // The most recently reported resume token.
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _saved;  // The most recently saved resume token.
+    std::size_t _pending = 0u;                                          // Reports since `_latest` was last saved.
+    bool _dirty = false;                                                // `_latest` is not yet saved.
+    std::exception_ptr _error;                                          // The latest error on the background thread.
+
+    std::thread _flusher;
+
+    ~impl() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+
+        _cv.notify_all();
+        _flusher.join();
+
+        try {
+            this->save();
+        } catch (...) {
+            // Best effort.
+        }
+    }
+
+    impl(impl&& other) noexcept = delete;
+    impl& operator=(impl&& other) noexcept = delete;
+    impl(impl const& other) = delete;
+    impl& operator=(impl const& other) = delete;
+
+    impl(
+        v1::checkpoint_store& store,
+        std::chrono::milliseconds flush_interval,
+        std::size_t flush_count,
+        bool start_after)
+        : _store{&store}, _flush_interval{flush_interval}, _flush_count{flush_count}, _start_after{start_after} {
+        _flusher = std::thread{[this] { this->run(); }};
+    }
+
+    // Save the latest resume token if not yet saved. On failure, the resume token is saved by the next attempt. When
+    // `background` is true, the error is recorded to be reported by `flush()` instead.
+    void save(bool background = false) {
+        std::lock_guard<std::mutex> store_lock{_store_mutex};
+
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> token;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (!_dirty) {
+                return;
+            }
+
+            token = _latest;
+            _dirty = false;
+            _pending = 0u;
+        }
+
+        try {
+            _store->save(token->view());
+        } catch (...) {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            // Retry with the latest resume token, which may have been superseded in the meantime.
+            _dirty = true;
+
+            if (background) {
+                _error = std::current_exception();
+                return;
+            }
+
+            throw;
+        }
+
+        std::lock_guard<std::mutex> lock{_mutex};
+        _saved = std::move(token);
+    }
+
+    void run() noexcept {
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        while (!_stopping) {
+            _cv.wait_for(lock, _flush_interval, [&] { return _stopping || _pending >= _flush_count; });
+
+            if (_stopping) {
+                break;
+            }
+
+            lock.unlock();
+
+            try {
+                this->save(true);
+            } catch (...) {
+                // Only from allocation failures.
+            }
+
+            lock.lock();
+        }
+    }
+
+    void update(bsoncxx::v1::document::view token) {
+        bool notify = false;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            _latest.emplace(token);
+            _dirty = true;
+            notify = ++_pending == _flush_count;
+        }
+
+        if (notify) {
+            _cv.notify_one();
+        }
+    }
+
+    bool configure(v1::change_stream::options& opts) {
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> token;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            token = _latest;
+        }
+
+        if (!token) {
+            std::lock_guard<std::mutex> store_lock{_store_mutex};
+
+            token = _store->load();
+
+            if (!token) {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock{_mutex};
+            _saved = token;
+        }
+
+        v1::change_stream::options::internal::resume_after(opts).reset();
+        v1::change_stream::options::internal::start_after(opts).reset();
+        v1::change_stream::options::internal::start_at_operation_time(opts).reset();
+
+        if (_start_after) {
+            v1::change_stream::options::internal::start_after(opts) = std::move(token);
+        } else {
+            v1::change_stream::options::internal::resume_after(opts) = std::move(token);
+        }
+
+        return true;
+    }
+
+    void flush() {
+        this->save();
+
+        std::exception_ptr error;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            error = exchange(_error, nullptr);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    static impl const& with(checkpointer const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl& with(checkpointer& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(checkpointer* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+checkpointer::~checkpointer() {
+    delete impl::with(this);
+}
+
+checkpointer::checkpointer(checkpointer&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+checkpointer& checkpointer::operator=(checkpointer&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+checkpointer::checkpointer(v1::checkpoint_store& store, options const& opts) : _impl{nullptr} {
+    auto const flush_interval = opts.flush_interval().value_or(default_flush_interval);
+    auto const flush_count = opts.flush_count().value_or(default_flush_count);
+
+    if (flush_interval <= std::chrono::milliseconds{0}) {
+        throw v1::exception::internal::make(code::invalid_flush_interval);
+    }
+
+    if (flush_count == 0u) {
+        throw v1::exception::internal::make(code::invalid_flush_count);
+    }
+
+    _impl = new impl{store, flush_interval, flush_count, opts.start_after().value_or(false)};
+}
+
+checkpointer::checkpointer(v1::checkpoint_store& store) : checkpointer{store, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+checkpointer::operator bool() const {
+    return _impl != nullptr;
+}
+
+bool checkpointer::configure(v1::change_stream::options& opts) {
+    return impl::with(this)->configure(opts);
+}
+
+void checkpointer::update(bsoncxx::v1::document::view token) {
+    impl::with(this)->update(token);
+}
+
+void checkpointer::update(v1::change_stream const& stream) {
+    if (auto const token = stream.get_resume_token()) {
+        impl::with(this)->update(*token);
+    }
+}
+
+void checkpointer::flush() {
+    impl::with(this)->flush();
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> checkpointer::saved() const {
+    auto const& self = impl::with(*this);
+
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._saved;
+}
+
+std::error_category const& checkpointer::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::checkpointer";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_flush_interval:
+                    return "the flush interval must be positive";
+                case code::invalid_flush_count:
+                    return "the flush count must be greater than zero";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_flush_interval:
+                    case code::invalid_flush_count:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_flush_interval:
+                    case code::invalid_flush_count:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+checkpointer::options::~options() {
+    delete impl::with(_impl);
+}
+
+checkpointer::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+checkpointer::options& checkpointer::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+checkpointer::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+checkpointer::options& checkpointer::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+checkpointer::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+checkpointer::options& checkpointer::options::flush_count(std::size_t v) {
+    impl::with(this)->_flush_count = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> checkpointer::options::flush_count() const {
+    return impl::with(this)->_flush_count;
+}
+
+checkpointer::options& checkpointer::options::flush_interval(std::chrono::milliseconds v) {
+    impl::with(this)->_flush_interval = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::chrono::milliseconds> checkpointer::options::flush_interval() const {
+    return impl::with(this)->_flush_interval;
+}
+
+checkpointer::options& checkpointer::options::start_after(bool v) {
+    impl::with(this)->_start_after = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<bool> checkpointer::options::start_after() const {
+    return impl::with(this)->_start_after;
+}
+
+} // namespace v1
+} // namespace mongocxx
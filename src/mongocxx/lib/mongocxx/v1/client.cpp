@@ -42,6 +42,7 @@
 #include <memory>
 #include <string>
 #include <system_error>
+#include <unordered_map>
 #include <vector>
 
 #include <bsoncxx/private/bson.hh>
@@ -63,7 +64,13 @@ class client::impl {
     v1::apm _apm;
     v1::oidc_callback _oidc_callback;
 
+    // Database and collection handles are cached by name to avoid reallocating (and copying the read/write concern
+    // and read preference of) a handle for every lookup. The cache is cleared when `_client` is modified.
+    std::unordered_map<std::string, std::shared_ptr<v1::database::internal::handles>> _databases;
+    std::string _key; // Reused by lookups to avoid allocating a temporary key.
+
     ~impl() {
+        _databases.clear();
         libmongoc::client_destroy(_client);
     }
 
@@ -185,9 +192,27 @@ v1::uri client::uri() const {
 }
 
 v1::database client::database(bsoncxx::v1::stdx::string_view name) {
-    auto const _client = impl::with(this)->_client;
+    auto& self = impl::with(*this);
+    auto& key = self._key;
+
+    key.assign(name.data(), name.size());
+
+    auto iter = self._databases.find(key);
+
+    if (iter == self._databases.end()) {
+        if (self._databases.size() >= v1::database::internal::max_cached_handles) {
+            self._databases.clear(); // Handles which are still in use are kept alive by their database objects.
+        }
 
-    return v1::database::internal::make(libmongoc::client_get_database(_client, std::string{name}.c_str()), _client);
+        iter = self._databases
+                   .emplace(
+                       key,
+                       v1::database::internal::make_handles(
+                           libmongoc::client_get_database(self._client, key.c_str())))
+                   .first;
+    }
+
+    return v1::database::internal::make_cached(iter->second, self._client);
 }
 
 v1::database client::operator[](bsoncxx::v1::stdx::string_view name) {
@@ -484,9 +509,14 @@ void client::internal::set_oidc_callback(client& self, v1::oidc_callback v) {
 }
 
 mongoc_client_t* client::internal::release(client& self) {
+    impl::with(self)._databases.clear();
     return exchange(impl::with(self)._client, nullptr);
 }
 
+void client::internal::clear_handles(client& self) {
+    impl::with(self)._databases.clear();
+}
+
 mongoc_client_t const* client::internal::as_mongoc(client const& self) {
     return impl::with(self)._client;
 }
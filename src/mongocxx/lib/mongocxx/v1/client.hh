@@ -42,6 +42,9 @@ class client::internal {
 
     static mongoc_client_t* release(client& self);
 
+    // Must be called after modifying the read/write concern or read preference of the underlying client.
+    static void clear_handles(client& self);
+
     static mongoc_client_t const* as_mongoc(client const& self);
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(mongoc_client_t*) as_mongoc(client& self);
 };
@@ -480,6 +480,10 @@ client_bulk_write::exception client_bulk_write::exception::internal::make() {
     return exception{v1::exception::internal::make(0, std::generic_category()), std::unique_ptr<impl>{new impl{}}};
 }
 
+client_bulk_write::exception client_bulk_write::exception::internal::make(v1::exception base) {
+    return exception{std::move(base), std::unique_ptr<impl>{new impl{}}};
+}
+
 bsoncxx::v1::document::value& client_bulk_write::exception::internal::write_errors(exception& self) {
     return self._impl->_write_errors;
 }
@@ -488,6 +492,11 @@ bsoncxx::v1::array::value& client_bulk_write::exception::internal::write_concern
     return self._impl->_write_concern_errors;
 }
 
+bsoncxx::v1::stdx::optional<client_bulk_write::result>& client_bulk_write::exception::internal::partial_result(
+    exception& self) {
+    return self._impl->_partial_result;
+}
+
 class client_bulk_write::insert_one_options::impl {};
 
 client_bulk_write::insert_one_options::~insert_one_options() = default;
@@ -65,9 +65,11 @@ class client_bulk_write::exception::internal {
         mongoc_bulkwriteexception_t* exc,
         bsoncxx::v1::stdx::optional<result> partial_result);
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(exception) make();
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(exception) make(v1::exception base);
 
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bsoncxx::v1::document::value&) write_errors(exception& self);
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bsoncxx::v1::array::value&) write_concern_errors(exception& self);
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bsoncxx::v1::stdx::optional<result>&) partial_result(exception& self);
 };
 
 class client_bulk_write::internal {
@@ -36,6 +36,7 @@
 #include <mongocxx/v1/client_session.hh>
 #include <mongocxx/v1/count_options.hh>
 #include <mongocxx/v1/cursor.hh>
+#include <mongocxx/v1/database.hh>
 #include <mongocxx/v1/delete_many_options.hh>
 #include <mongocxx/v1/delete_many_result.hh>
 #include <mongocxx/v1/delete_one_options.hh>
@@ -71,7 +72,7 @@
 #include <stdexcept>
 #include <string>
 #include <system_error>
-#include <vector>
+#include <utility>
 
 #include <bsoncxx/private/bson.hh>
 #include <bsoncxx/private/immortal.hh>
@@ -89,20 +90,57 @@ class collection::impl {
    public:
     mongoc_collection_t* _coll;
     mongoc_client_t* _client;
+    std::shared_ptr<mongoc_collection_t> _shared; // Owns `_coll` when shared with cached handles.
+    std::weak_ptr<v1::database::internal::handles> _owner; // The cached handles which `_shared` was obtained from.
 
     ~impl() {
-        libmongoc::collection_destroy(_coll);
+        if (!_shared) {
+            libmongoc::collection_destroy(_coll);
+        }
     }
 
     impl(impl&& other) noexcept = delete;
     impl& operator=(impl&& other) noexcept = delete;
 
-    impl(impl const& other) : _coll{libmongoc::collection_copy(other._coll)}, _client{other._client} {}
+    impl(impl const& other)
+        : _coll{other._shared ? other._coll : libmongoc::collection_copy(other._coll)},
+          _client{other._client},
+          _shared{other._shared},
+          _owner{other._owner} {}
 
     impl& operator=(impl const& other) = delete;
 
     impl(mongoc_collection_t* db, mongoc_client_t* client) : _coll{db}, _client{client} {}
 
+    impl(
+        std::shared_ptr<mongoc_collection_t> coll,
+        std::weak_ptr<v1::database::internal::handles> owner,
+        mongoc_client_t* client)
+        : _coll{coll.get()}, _client{client}, _shared{std::move(coll)}, _owner{std::move(owner)} {}
+
+    // Obtain an owned copy of shared handles before modifying them.
+    mongoc_collection_t* detach() {
+        if (_shared) {
+            _coll = libmongoc::collection_copy(_coll);
+            _shared.reset();
+            _owner.reset();
+        }
+
+        return _coll;
+    }
+
+    // Obtain an owned copy of shared handles before renaming them. The cached handles are evicted so that subsequent
+    // lookups by either name obtain new handles.
+    mongoc_collection_t* detach_for_rename() {
+        if (_shared) {
+            if (auto const owner = _owner.lock()) {
+                v1::database::internal::evict(*owner, _shared);
+            }
+        }
+
+        return this->detach();
+    }
+
     static impl const& with(collection const& other) {
         return *static_cast<impl const*>(other._impl);
     }
@@ -309,103 +347,6 @@ void append_to(v1::distinct_options const& opts, scoped_bson& doc) {
     }
 }
 
-void append_to(v1::find_options const& opts, scoped_bson& doc) {
-    if (auto const& opt = opts.allow_disk_use()) {
-        doc += scoped_bson{BCON_NEW("allowDiskUse", BCON_BOOL(*opt))};
-    }
-
-    if (auto const& opt = opts.allow_partial_results()) {
-        doc += scoped_bson{BCON_NEW("allowPartialResults", BCON_BOOL(*opt))};
-    }
-
-    if (auto const opt = opts.batch_size()) {
-        doc += scoped_bson{BCON_NEW("batchSize", BCON_INT32(*opt))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::collation(opts)) {
-        doc += scoped_bson{BCON_NEW("collation", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::comment(opts)) {
-        append_comment(*opt, doc);
-    }
-
-    if (auto const& opt = opts.cursor_type()) {
-        switch (*opt) {
-            case cursor::type::k_non_tailable: {
-                // Do nothing.
-            } break;
-
-            case cursor::type::k_tailable: {
-                doc += scoped_bson{BCON_NEW("tailable", BCON_BOOL(true))};
-            } break;
-
-            case cursor::type::k_tailable_await: {
-                doc += scoped_bson{BCON_NEW("tailable", BCON_BOOL(true), "awaitData", BCON_BOOL(true))};
-            } break;
-
-            default:
-                MONGOCXX_PRIVATE_UNREACHABLE;
-        }
-    }
-
-    if (auto const& opt = v1::find_options::internal::hint(opts)) {
-        append_hint(*opt, doc);
-    }
-
-    if (auto const& opt = v1::find_options::internal::let(opts)) {
-        doc += scoped_bson{BCON_NEW("let", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
-    }
-
-    if (auto const& opt = opts.limit()) {
-        doc += scoped_bson{BCON_NEW("limit", BCON_INT64(*opt))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::max(opts)) {
-        doc += scoped_bson{BCON_NEW("max", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
-    }
-
-    if (auto const& opt = opts.max_await_time()) {
-        doc += scoped_bson{BCON_NEW("maxAwaitTimeMS", BCON_INT64(std::int64_t{opt->count()}))};
-    }
-
-    if (auto const& opt = opts.max_time()) {
-        doc += scoped_bson{BCON_NEW("maxTimeMS", BCON_INT64(std::int64_t{opt->count()}))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::min(opts)) {
-        doc += scoped_bson{BCON_NEW("min", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
-    }
-
-    if (auto const& opt = opts.no_cursor_timeout()) {
-        doc += scoped_bson{BCON_NEW("noCursorTimeout", BCON_BOOL(*opt))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::projection(opts)) {
-        doc += scoped_bson{BCON_NEW("projection", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
-    }
-
-    if (auto const& opt = opts.return_key()) {
-        doc += scoped_bson{BCON_NEW("returnKey", BCON_BOOL(*opt))};
-    }
-
-    if (auto const& opt = opts.show_record_id()) {
-        doc += scoped_bson{BCON_NEW("showRecordId", BCON_BOOL(*opt))};
-    }
-
-    if (auto const& opt = opts.skip()) {
-        doc += scoped_bson{BCON_NEW("skip", BCON_INT64(*opt))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::read_concern(opts)) {
-        doc += scoped_bson{BCON_NEW("readConcern", BCON_DOCUMENT(scoped_bson{opt->to_document()}.bson()))};
-    }
-
-    if (auto const& opt = v1::find_options::internal::sort(opts)) {
-        doc += scoped_bson{BCON_NEW("sort", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
-    }
-}
-
 void append_to(v1::insert_many_options const& opts, scoped_bson& doc) {
     // Only include "ordered" when `false` (not the default behavior).
     if (opts.ordered().value_or(true) == false) {
@@ -514,6 +455,21 @@ create_bulk_write_impl(mongoc_collection_t* coll, bson_t const* opts, bsoncxx::v
     return ret;
 }
 
+v1::bulk_write create_insert_many_impl(
+    mongoc_collection_t* coll,
+    v1::client_session const* session,
+    v1::insert_many_options const& opts) {
+    scoped_bson doc;
+
+    append_to(opts, doc);
+
+    if (session) {
+        v1::client_session::internal::append_to(*session, doc);
+    }
+
+    return create_bulk_write_impl(coll, doc.bson(), opts.bypass_document_validation());
+}
+
 std::int64_t count_documents_impl(
     mongoc_collection_t* coll,
     bson_t const* filter,
@@ -547,17 +503,17 @@ estimated_document_count_impl(mongoc_collection_t* coll, bson_t const* opts, mon
 
 bsoncxx::v1::stdx::optional<v1::delete_many_result>
 delete_many_impl(v1::bulk_write bulk, bsoncxx::v1::document::view q, v1::delete_many_options const& delete_opts) {
-    v1::bulk_write::delete_many op{bsoncxx::v1::document::value{q}};
+    v1::bulk_write::delete_many_view op{q};
 
     if (auto const& opt = v1::delete_many_options::internal::collation(delete_opts)) {
         op.collation(*opt);
     }
 
     if (auto const& opt = v1::delete_many_options::internal::hint(delete_opts)) {
-        op.hint(*opt);
+        op.hint(opt->to_value());
     }
 
-    if (auto ret = bulk.append(std::move(op)).execute()) {
+    if (auto ret = bulk.append(op).execute()) {
         return v1::delete_many_result::internal::make(std::move(*ret));
     }
 
@@ -566,17 +522,17 @@ delete_many_impl(v1::bulk_write bulk, bsoncxx::v1::document::view q, v1::delete_
 
 bsoncxx::v1::stdx::optional<v1::delete_one_result>
 delete_one_impl(v1::bulk_write bulk, bsoncxx::v1::document::view q, v1::delete_one_options const& delete_opts) {
-    v1::bulk_write::delete_one op{bsoncxx::v1::document::value{q}};
+    v1::bulk_write::delete_one_view op{q};
 
     if (auto const& opt = v1::delete_one_options::internal::collation(delete_opts)) {
         op.collation(*opt);
     }
 
     if (auto const& opt = v1::delete_one_options::internal::hint(delete_opts)) {
-        op.hint(*opt);
+        op.hint(opt->to_value());
     }
 
-    if (auto ret = bulk.append(std::move(op)).execute()) {
+    if (auto ret = bulk.append(op).execute()) {
         return v1::delete_one_result::internal::make(std::move(*ret));
     }
 
@@ -862,6 +818,15 @@ bsoncxx::v1::document::value with_id(bsoncxx::v1::document::view doc) {
 bsoncxx::v1::stdx::optional<v1::insert_one_result> insert_one_impl(
     v1::bulk_write bulk,
     bsoncxx::v1::document::view document) {
+    // Avoid copying the document when it does not need a generated "_id" field.
+    if (auto const e = document["_id"]) {
+        if (auto res = bulk.append(v1::bulk_write::insert_one_view{document}).execute()) {
+            return v1::insert_one_result::internal::make(std::move(*res), e.type_value());
+        }
+
+        return {};
+    }
+
     auto insert_doc = with_id(document);
     auto id = insert_doc["_id"].type_value();
 
@@ -885,14 +850,14 @@ bsoncxx::v1::stdx::optional<v1::replace_one_result> replace_one_impl(
     bsoncxx::v1::document::view filter,
     bsoncxx::v1::document::view replacement,
     v1::replace_one_options const& opts) {
-    v1::bulk_write::replace_one op{bsoncxx::v1::document::value{filter}, bsoncxx::v1::document::value{replacement}};
+    v1::bulk_write::replace_one_view op{filter, replacement};
 
     if (auto const& opt = v1::replace_one_options::internal::collation(opts)) {
         op.collation(*opt);
     }
 
     if (auto const& opt = v1::replace_one_options::internal::hint(opts)) {
-        op.hint(*opt);
+        op.hint(opt->to_value());
     }
 
     if (auto const& opt = v1::replace_one_options::internal::sort(opts)) {
@@ -903,7 +868,7 @@ bsoncxx::v1::stdx::optional<v1::replace_one_result> replace_one_impl(
         op.upsert(*opt);
     }
 
-    if (auto res = bulk.append(std::move(op)).execute()) {
+    if (auto res = bulk.append(op).execute()) {
         return v1::replace_one_result::internal::make(std::move(*res));
     }
 
@@ -911,13 +876,13 @@ bsoncxx::v1::stdx::optional<v1::replace_one_result> replace_one_impl(
 }
 
 bsoncxx::v1::stdx::optional<v1::update_many_result>
-update_many_impl(v1::bulk_write bulk, v1::bulk_write::update_many op, v1::update_many_options const& opts) {
+update_many_impl(v1::bulk_write bulk, v1::bulk_write::update_many_view op, v1::update_many_options const& opts) {
     if (auto const& opt = v1::update_many_options::internal::collation(opts)) {
         op.collation(*opt);
     }
 
     if (auto const& opt = v1::update_many_options::internal::hint(opts)) {
-        op.hint(*opt);
+        op.hint(opt->to_value());
     }
 
     if (auto const& opt = opts.upsert()) {
@@ -925,10 +890,10 @@ update_many_impl(v1::bulk_write bulk, v1::bulk_write::update_many op, v1::update
     }
 
     if (auto const& opt = v1::update_many_options::internal::array_filters(opts)) {
-        op.array_filters(*opt);
+        op.array_filters(opt->view());
     }
 
-    if (auto res = bulk.append(std::move(op)).execute()) {
+    if (auto res = bulk.append(op).execute()) {
         return v1::update_many_result::internal::make(std::move(*res));
     }
 
@@ -940,10 +905,7 @@ bsoncxx::v1::stdx::optional<v1::update_many_result> update_many_impl(
     bsoncxx::v1::document::view filter,
     bsoncxx::v1::document::view update,
     v1::update_many_options const& opts) {
-    return update_many_impl(
-        std::move(bulk),
-        v1::bulk_write::update_many{bsoncxx::v1::document::value{filter}, bsoncxx::v1::document::value{update}},
-        opts);
+    return update_many_impl(std::move(bulk), v1::bulk_write::update_many_view{filter, update}, opts);
 }
 
 bsoncxx::v1::stdx::optional<v1::update_many_result> update_many_impl(
@@ -951,18 +913,17 @@ bsoncxx::v1::stdx::optional<v1::update_many_result> update_many_impl(
     bsoncxx::v1::document::view filter,
     v1::pipeline const& update,
     v1::update_many_options const& opts) {
-    return update_many_impl(
-        std::move(bulk), v1::bulk_write::update_many{bsoncxx::v1::document::value{filter}, update}, opts);
+    return update_many_impl(std::move(bulk), v1::bulk_write::update_many_view{filter, update.view_array()}, opts);
 }
 
 bsoncxx::v1::stdx::optional<v1::update_one_result>
-update_one_impl(v1::bulk_write bulk, v1::bulk_write::update_one op, v1::update_one_options const& opts) {
+update_one_impl(v1::bulk_write bulk, v1::bulk_write::update_one_view op, v1::update_one_options const& opts) {
     if (auto const& opt = v1::update_one_options::internal::collation(opts)) {
         op.collation(*opt);
     }
 
     if (auto const& opt = v1::update_one_options::internal::hint(opts)) {
-        op.hint(*opt);
+        op.hint(opt->to_value());
     }
 
     if (auto const& opt = v1::update_one_options::internal::sort(opts)) {
@@ -974,10 +935,10 @@ update_one_impl(v1::bulk_write bulk, v1::bulk_write::update_one op, v1::update_o
     }
 
     if (auto const& opt = v1::update_one_options::internal::array_filters(opts)) {
-        op.array_filters(*opt);
+        op.array_filters(opt->view());
     }
 
-    if (auto res = bulk.append(std::move(op)).execute()) {
+    if (auto res = bulk.append(op).execute()) {
         return v1::update_one_result::internal::make(std::move(*res));
     }
 
@@ -989,10 +950,7 @@ bsoncxx::v1::stdx::optional<v1::update_one_result> update_one_impl(
     bsoncxx::v1::document::view filter,
     bsoncxx::v1::document::view update,
     v1::update_one_options const& opts) {
-    return update_one_impl(
-        std::move(bulk),
-        v1::bulk_write::update_one{bsoncxx::v1::document::value{filter}, bsoncxx::v1::document::value{update}},
-        opts);
+    return update_one_impl(std::move(bulk), v1::bulk_write::update_one_view{filter, update}, opts);
 }
 
 bsoncxx::v1::stdx::optional<v1::update_one_result> update_one_impl(
@@ -1000,8 +958,7 @@ bsoncxx::v1::stdx::optional<v1::update_one_result> update_one_impl(
     bsoncxx::v1::document::view filter,
     v1::pipeline const& update,
     v1::update_one_options const& opts) {
-    return update_one_impl(
-        std::move(bulk), v1::bulk_write::update_one{bsoncxx::v1::document::value{filter}, update}, opts);
+    return update_one_impl(std::move(bulk), v1::bulk_write::update_one_view{filter, update.view_array()}, opts);
 }
 
 v1::change_stream watch_impl(mongoc_collection_t* coll, bsoncxx::v1::array::view pipeline, bson_t const* opts) {
@@ -1192,7 +1149,7 @@ void collection::drop(
 v1::cursor collection::find(bsoncxx::v1::document::view filter, v1::find_options const& opts) {
     scoped_bson doc;
 
-    append_to(opts, doc);
+    v1::find_options::internal::append_to(opts, doc);
 
     return find_impl(impl::with(this)->_coll, scoped_bson_view{filter}.bson(), doc.bson(), opts);
 }
@@ -1201,7 +1158,7 @@ v1::cursor
 collection::find(v1::client_session const& session, bsoncxx::v1::document::view filter, v1::find_options const& opts) {
     scoped_bson doc;
 
-    append_to(opts, doc);
+    v1::find_options::internal::append_to(opts, doc);
     v1::client_session::internal::append_to(session, doc);
 
     return find_impl(impl::with(this)->_coll, scoped_bson_view{filter}.bson(), doc.bson(), opts);
@@ -1334,7 +1291,7 @@ void collection::rename(
         doc += scoped_bson{BCON_NEW("writeConcern", BCON_DOCUMENT(scoped_bson{write_concern->to_document()}.bson()))};
     }
 
-    return rename_impl(impl::with(this)->_coll, std::string{new_name}.c_str(), drop_target, doc.bson());
+    return rename_impl(impl::with(this)->detach_for_rename(), std::string{new_name}.c_str(), drop_target, doc.bson());
 }
 
 void collection::rename(
@@ -1350,11 +1307,11 @@ void collection::rename(
 
     v1::client_session::internal::append_to(session, doc);
 
-    return rename_impl(impl::with(this)->_coll, std::string{new_name}.c_str(), drop_target, doc.bson());
+    return rename_impl(impl::with(this)->detach_for_rename(), std::string{new_name}.c_str(), drop_target, doc.bson());
 }
 
 void collection::read_concern(v1::read_concern const& rc) {
-    libmongoc::collection_set_read_concern(impl::with(this)->_coll, v1::read_concern::internal::as_mongoc(rc));
+    libmongoc::collection_set_read_concern(impl::with(this)->detach(), v1::read_concern::internal::as_mongoc(rc));
 }
 
 v1::read_concern collection::read_concern() const {
@@ -1363,7 +1320,7 @@ v1::read_concern collection::read_concern() const {
 }
 
 void collection::read_preference(v1::read_preference const& rp) {
-    libmongoc::collection_set_read_prefs(impl::with(this)->_coll, v1::read_preference::internal::as_mongoc(rp));
+    libmongoc::collection_set_read_prefs(impl::with(this)->detach(), v1::read_preference::internal::as_mongoc(rp));
 }
 
 v1::read_preference collection::read_preference() const {
@@ -1573,7 +1530,7 @@ v1::change_stream collection::watch(
 }
 
 void collection::write_concern(v1::write_concern const& wc) {
-    libmongoc::collection_set_write_concern(impl::with(this)->_coll, v1::write_concern::internal::as_mongoc(wc));
+    libmongoc::collection_set_write_concern(impl::with(this)->detach(), v1::write_concern::internal::as_mongoc(wc));
 }
 
 v1::write_concern collection::write_concern() const {
@@ -1641,66 +1598,108 @@ std::error_category const& collection::error_category() {
 collection::collection(void* impl) : _impl{impl} {}
 
 v1::bulk_write collection::_create_insert_many(v1::client_session const* session, v1::insert_many_options const& opts) {
-    scoped_bson doc;
+    auto ret = create_insert_many_impl(impl::with(this)->_coll, session, opts);
 
-    append_to(opts, doc);
+    v1::bulk_write::internal::insert_many(ret).reset(new v1::bulk_write::internal::insert_many_type{
+        opts.report_ids().value_or(v1::insert_many_options::id_mode::k_all)});
 
-    if (session) {
-        v1::client_session::internal::append_to(*session, doc);
-    }
-
-    return create_bulk_write_impl(impl::with(this)->_coll, doc.bson(), opts.bypass_document_validation());
+    return ret;
 }
 
-void collection::_append_insert_many(
-    v1::bulk_write& bulk,
-    std::vector<bsoncxx::v1::types::value>& inserted_ids,
-    bsoncxx::v1::document::view doc) {
-    auto insert_doc = with_id(doc);
-    auto id = insert_doc["_id"].type_value();
+void collection::_append_insert_many(v1::bulk_write& bulk, bsoncxx::v1::document::view doc) {
+    using id_mode = v1::insert_many_options::id_mode;
 
-    bulk.append(v1::bulk_write::insert_one{std::move(insert_doc)});
-    inserted_ids.push_back(std::move(id));
-}
+    auto& state = *v1::bulk_write::internal::insert_many(bulk);
 
-bsoncxx::v1::stdx::optional<v1::insert_many_result> collection::_execute_insert_many(
-    v1::bulk_write& bulk,
-    std::vector<bsoncxx::v1::types::value>& inserted_ids) {
-    struct deleter_type {
-        void operator()(bson_array_builder_t* ptr) const noexcept {
-            bson_array_builder_destroy(ptr);
+    // Keys of the reported document IDs are the operation index.
+    char buf[16];
+    char const* key = nullptr;
+    auto const key_len =
+        static_cast<int>(bson_uint32_to_string(static_cast<std::uint32_t>(state.count), &key, buf, sizeof(buf)));
+
+    scoped_bson_view const view{doc};
+    bson_t const* insert_doc = view.bson();
+
+    // When no ID is reported, a missing "_id" field is generated by mongoc instead.
+    bson_iter_t iter;
+    if (bson_iter_init_find(&iter, view.bson(), "_id")) {
+        if (state.mode == id_mode::k_all && !bson_append_iter(state.ids, key, key_len, &iter)) {
+            throw std::logic_error{"mongocxx::v1::collection::_append_insert_many: bson_append_iter failed"};
         }
-    };
+    } else if (state.mode != id_mode::k_none) {
+        bsoncxx::v1::oid oid;
+        bson_oid_t bson_oid = {};
+        std::memcpy(bson_oid.bytes, oid.bytes(), oid.size());
 
-    using builder_ptr_type = std::unique_ptr<bson_array_builder_t, deleter_type>;
+        // Reuse the same buffer for every document with a generated "_id" field: the bulk write operation makes its
+        // own copy of each document.
+        bson_reinit(state.scratch);
 
-    auto const builder_owner = builder_ptr_type{bson_array_builder_new(), deleter_type{}};
-    auto const builder = builder_owner.get();
+        if (!BSON_APPEND_OID(state.scratch, "_id", &bson_oid) || !bson_concat(state.scratch, view.bson())) {
+            throw std::logic_error{"mongocxx::v1::collection::_append_insert_many: bson_concat failed"};
+        }
 
-    for (auto const& e : inserted_ids) {
-        if (!bson_array_builder_append_value(builder, &bsoncxx::v1::types::value::internal::get_bson_value(e))) {
-            throw std::logic_error{
-                "mongocxx::v1::collection::_execute_insert_many: bson_array_builder_append_value failed"};
+        if (!bson_append_oid(state.ids, key, key_len, &bson_oid)) {
+            throw std::logic_error{"mongocxx::v1::collection::_append_insert_many: bson_append_oid failed"};
         }
+
+        insert_doc = state.scratch;
     }
 
-    scoped_bson arr;
-    if (!bson_array_builder_build(builder, arr.out_ptr())) {
-        throw std::logic_error{"mongocxx::v1::collection::_execute_insert_many: bson_array_builder_build failed"};
+    bson_error_t error = {};
+
+    if (!libmongoc::bulk_operation_insert_with_opts(
+            v1::bulk_write::internal::as_mongoc(bulk), insert_doc, nullptr, &error)) {
+        v1::throw_exception(error);
     }
 
+    v1::bulk_write::internal::is_empty(bulk) = false;
+    ++state.count;
+}
+
+bsoncxx::v1::stdx::optional<v1::insert_many_result> collection::_execute_insert_many(v1::bulk_write& bulk) {
+    auto& state = *v1::bulk_write::internal::insert_many(bulk);
+
     if (auto res = bulk.execute()) {
+        scoped_bson ids{exchange(state.ids, nullptr)}; // Ownership transfer.
+
         return v1::insert_many_result::internal::make(
-            std::move(*res), bsoncxx::v1::array::value{std::move(arr).value().release()});
+            std::move(*res), bsoncxx::v1::array::value{std::move(ids).value().release()});
     }
 
     return {};
 }
 
+void collection::_append_insert_many(
+    v1::bulk_write& bulk,
+    std::vector<bsoncxx::v1::types::value>& inserted_ids,
+    bsoncxx::v1::document::view doc) {
+    (void)inserted_ids;
+    _append_insert_many(bulk, doc);
+}
+
+bsoncxx::v1::stdx::optional<v1::insert_many_result> collection::_execute_insert_many(
+    v1::bulk_write& bulk,
+    std::vector<bsoncxx::v1::types::value>& inserted_ids) {
+    (void)inserted_ids;
+    return _execute_insert_many(bulk);
+}
+
 collection collection::internal::make(mongoc_collection_t* coll, mongoc_client_t* client) {
     return {new impl{coll, client}};
 }
 
+collection collection::internal::make_cached(
+    std::shared_ptr<mongoc_collection_t> coll,
+    std::weak_ptr<v1::database::internal::handles> owner,
+    mongoc_client_t* client) {
+    return {new impl{std::move(coll), std::move(owner), client}};
+}
+
+mongoc_collection_t* collection::internal::detach_for_rename(collection& self) {
+    return impl::with(self).detach_for_rename();
+}
+
 mongoc_client_t* collection::internal::get_client(collection& self) {
     return impl::with(self)._client;
 }
@@ -1713,5 +1712,13 @@ mongoc_collection_t* collection::internal::as_mongoc(collection& self) {
     return impl::with(self)._coll;
 }
 
+bsoncxx::v1::document::value collection::internal::with_id(bsoncxx::v1::document::view doc) {
+    return v1::with_id(doc);
+}
+
+v1::bulk_write collection::internal::create_insert_many(collection& self, v1::insert_many_options const& opts) {
+    return create_insert_many_impl(impl::with(self)._coll, nullptr, opts);
+}
+
 } // namespace v1
 } // namespace mongocxx
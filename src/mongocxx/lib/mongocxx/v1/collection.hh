@@ -18,6 +18,16 @@
 
 //
 
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+
+#include <mongocxx/v1/bulk_write-fwd.hpp>
+#include <mongocxx/v1/insert_many_options-fwd.hpp>
+
+#include <mongocxx/v1/database.hh>
+
+#include <memory>
+
 #include <mongocxx/private/export.hh>
 #include <mongocxx/private/mongoc.hh>
 
@@ -28,10 +38,26 @@ class collection::internal {
    public:
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(collection) make(mongoc_collection_t* coll, mongoc_client_t* client);
 
+    // `coll` is shared with the handles cached by a client object in `owner`: the collection object detaches from
+    // `coll` before modifying its read/write concern or read preference.
+    static collection make_cached(
+        std::shared_ptr<mongoc_collection_t> coll,
+        std::weak_ptr<v1::database::internal::handles> owner,
+        mongoc_client_t* client);
+
+    // Detach from (and evict) cached handles before renaming the underlying collection in place.
+    static mongoc_collection_t* detach_for_rename(collection& self);
+
     static mongoc_client_t* get_client(collection& self);
 
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(mongoc_collection_t const*) as_mongoc(collection const& self);
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(mongoc_collection_t*) as_mongoc(collection& self);
+
+    // Return a copy of `doc` with a generated "_id" field prepended when `doc` does not contain an "_id" field.
+    static bsoncxx::v1::document::value with_id(bsoncxx::v1::document::view doc);
+
+    // Return an empty bulk write operation configured as by `insert_many()`.
+    static v1::bulk_write create_insert_many(collection& self, v1::insert_many_options const& opts);
 };
 
 } // namespace v1
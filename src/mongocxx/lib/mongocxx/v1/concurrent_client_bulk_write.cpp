@@ -0,0 +1,737 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/concurrent_client_bulk_write.hh>
+
+//
+
+#include <bsoncxx/v1/array/value.hpp>
+#include <bsoncxx/v1/array/view.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/client_bulk_write.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+#include <mongocxx/v1/pool.hpp>
+
+#include <mongocxx/v1/client_bulk_write.hh>
+#include <mongocxx/v1/exception.hh>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = concurrent_client_bulk_write::errc;
+
+namespace {
+
+constexpr std::size_t default_max_concurrency = 4u;
+
+using append_type = std::function<void(v1::client_bulk_write& bulk, bsoncxx::v1::stdx::string_view ns)>;
+
+// An operation with a single document (e.g. "Insert One" or "Delete One").
+template <typename Options>
+struct unary_op {
+    bsoncxx::v1::document::value doc;
+    Options opts;
+
+    unary_op(bsoncxx::v1::document::view d, Options const& o) : doc{d}, opts{o} {}
+
+    void operator()(v1::client_bulk_write& bulk, bsoncxx::v1::stdx::string_view ns) const {
+        bulk.append(ns, doc, opts);
+    }
+};
+
+// An operation with a filter and a second document (e.g. "Update One" or "Replace One").
+template <typename Options>
+struct binary_op {
+    bsoncxx::v1::document::value filter;
+    bsoncxx::v1::document::value doc;
+    Options opts;
+
+    binary_op(bsoncxx::v1::document::view f, bsoncxx::v1::document::view d, Options const& o)
+        : filter{f}, doc{d}, opts{o} {}
+
+    void operator()(v1::client_bulk_write& bulk, bsoncxx::v1::stdx::string_view ns) const {
+        bulk.append(ns, filter, doc, opts);
+    }
+};
+
+struct model {
+    std::string ns;
+    append_type append;
+};
+
+// The outcome of a sub-batch.
+struct outcome {
+    bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> result;
+    std::exception_ptr error;
+};
+
+// A document mapping the index of a model within a sub-batch to a value.
+struct indexed_source {
+    bsoncxx::v1::document::view doc;
+    std::vector<std::size_t> const* indexes; // The index of each model of the sub-batch among every appended model.
+};
+
+// Append the value of `iter` with the key `idx`.
+bool append_indexed(bson_t* doc, std::size_t idx, bson_iter_t const* iter) {
+    char buf[16];
+    char const* key = nullptr;
+
+    auto const len = bson_uint32_to_string(static_cast<std::uint32_t>(idx), &key, buf, sizeof(buf));
+
+    return bson_append_iter(doc, key, static_cast<int>(len), iter);
+}
+
+// Merge the given documents into a single document mapping the index of a model among every appended model to the
+// same value, ordered by index.
+bsoncxx::v1::document::value merge_indexed(std::vector<indexed_source> const& sources) {
+    struct entry {
+        std::size_t index;
+        bson_iter_t iter;
+    };
+
+    std::vector<entry> entries;
+
+    for (auto const& source : sources) {
+        bson_iter_t iter = {};
+
+        if (!bson_iter_init_from_data(&iter, source.doc.data(), source.doc.length())) {
+            throw std::logic_error{"mongocxx::v1::concurrent_client_bulk_write: bson_iter_init_from_data failed"};
+        }
+
+        while (bson_iter_next(&iter)) {
+            auto const idx = static_cast<std::size_t>(std::strtoull(bson_iter_key(&iter), nullptr, 10));
+
+            if (idx >= source.indexes->size()) {
+                throw std::logic_error{"mongocxx::v1::concurrent_client_bulk_write: model index out of range"};
+            }
+
+            entries.push_back(entry{(*source.indexes)[idx], iter});
+        }
+    }
+
+    std::sort(entries.begin(), entries.end(), [](entry const& lhs, entry const& rhs) {
+        return lhs.index < rhs.index;
+    });
+
+    bson_t* const doc = bson_new();
+
+    for (auto const& e : entries) {
+        if (!append_indexed(doc, e.index, &e.iter)) {
+            bson_destroy(doc);
+            throw std::logic_error{"mongocxx::v1::concurrent_client_bulk_write: bson_append_iter failed"};
+        }
+    }
+
+    return scoped_bson{doc}.value();
+}
+
+// Concatenate the given arrays.
+bsoncxx::v1::array::value concat(std::vector<bsoncxx::v1::array::view> const& arrays) {
+    bson_t* const arr = bson_new();
+    std::size_t idx = 0u;
+
+    for (auto const& v : arrays) {
+        bson_iter_t iter = {};
+
+        if (!bson_iter_init_from_data(&iter, v.data(), v.length())) {
+            bson_destroy(arr);
+            throw std::logic_error{"mongocxx::v1::concurrent_client_bulk_write: bson_iter_init_from_data failed"};
+        }
+
+        while (bson_iter_next(&iter)) {
+            if (!append_indexed(arr, idx++, &iter)) {
+                bson_destroy(arr);
+                throw std::logic_error{"mongocxx::v1::concurrent_client_bulk_write: bson_append_iter failed"};
+            }
+        }
+    }
+
+    return bsoncxx::v1::array::value{scoped_bson{arr}.array_view()};
+}
+
+// Accumulates the results of every sub-batch.
+class merged_result {
+   private:
+    v1::client_bulk_write::result _result = v1::client_bulk_write::result::internal::make();
+    bool _has_value = false;
+    std::vector<indexed_source> _insert_results;
+    std::vector<indexed_source> _update_results;
+    std::vector<indexed_source> _delete_results;
+
+   public:
+    // `res` and `indexes` must outlive this object.
+    void add(v1::client_bulk_write::result const& res, std::vector<std::size_t> const& indexes) {
+        using internal = v1::client_bulk_write::result::internal;
+
+        internal::inserted_count(_result) += res.inserted_count();
+        internal::upserted_count(_result) += res.upserted_count();
+        internal::matched_count(_result) += res.matched_count();
+        internal::modified_count(_result) += res.modified_count();
+        internal::deleted_count(_result) += res.deleted_count();
+
+        if (auto const doc = res.insert_results()) {
+            _insert_results.push_back({*doc, &indexes});
+        }
+
+        if (auto const doc = res.update_results()) {
+            _update_results.push_back({*doc, &indexes});
+        }
+
+        if (auto const doc = res.delete_results()) {
+            _delete_results.push_back({*doc, &indexes});
+        }
+
+        _has_value = true;
+    }
+
+    bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> value() {
+        using internal = v1::client_bulk_write::result::internal;
+
+        if (!_has_value) {
+            return {};
+        }
+
+        if (!_insert_results.empty()) {
+            internal::insert_results(_result) = merge_indexed(_insert_results);
+        }
+
+        if (!_update_results.empty()) {
+            internal::update_results(_result) = merge_indexed(_update_results);
+        }
+
+        if (!_delete_results.empty()) {
+            internal::delete_results(_result) = merge_indexed(_delete_results);
+        }
+
+        return std::move(_result);
+    }
+};
+
+} // namespace
+
+class concurrent_client_bulk_write::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<std::size_t> _max_concurrency;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class concurrent_client_bulk_write::impl {
+   public:
+    v1::pool* _pool;
+    std::size_t _max_concurrency;
+    internal::execute_type _execute;
+    std::vector<model> _models;
+
+    impl(v1::pool& pool, std::size_t max_concurrency) : _pool{&pool}, _max_concurrency{max_concurrency} {}
+
+    template <typename Op>
+    void push(bsoncxx::v1::stdx::string_view ns, Op op) {
+        _models.push_back(model{std::string{ns}, std::move(op)});
+    }
+
+    bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> execute(
+        std::vector<std::size_t> const& indexes,
+        v1::client_bulk_write::options const& opts) const {
+        if (_execute) {
+            return _execute(indexes, opts);
+        }
+
+        auto entry = _pool->acquire();
+        auto bulk = entry->create_bulk_write();
+
+        for (auto const idx : indexes) {
+            auto const& m = _models[idx];
+            m.append(bulk, m.ns);
+        }
+
+        return bulk.execute(opts);
+    }
+
+    // Partition the models by namespace into at most `_max_concurrency` sub-batches. Namespaces are assigned (largest
+    // first) to the sub-batch with the fewest models so far.
+    std::vector<std::vector<std::size_t>> partition() const {
+        std::vector<std::vector<std::size_t>> groups;
+
+        {
+            std::unordered_map<std::string, std::size_t> group_of;
+
+            for (std::size_t idx = 0u; idx < _models.size(); ++idx) {
+                auto const res = group_of.emplace(_models[idx].ns, groups.size());
+
+                if (res.second) {
+                    groups.emplace_back();
+                }
+
+                groups[res.first->second].push_back(idx);
+            }
+        }
+
+        std::stable_sort(groups.begin(), groups.end(), [](std::vector<std::size_t> const& lhs,
+                                                          std::vector<std::size_t> const& rhs) {
+            return lhs.size() > rhs.size();
+        });
+
+        std::vector<std::vector<std::size_t>> ret(std::min(_max_concurrency, groups.size()));
+
+        for (auto const& group : groups) {
+            auto& batch = *std::min_element(
+                ret.begin(), ret.end(), [](std::vector<std::size_t> const& lhs, std::vector<std::size_t> const& rhs) {
+                    return lhs.size() < rhs.size();
+                });
+
+            batch.insert(batch.end(), group.begin(), group.end());
+        }
+
+        // Preserve the relative order of the models in each sub-batch.
+        for (auto& batch : ret) {
+            std::sort(batch.begin(), batch.end());
+        }
+
+        return ret;
+    }
+
+    bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> execute_ordered(
+        v1::client_bulk_write::options const& opts) const {
+        std::vector<std::size_t> indexes(_models.size());
+
+        for (std::size_t idx = 0u; idx < indexes.size(); ++idx) {
+            indexes[idx] = idx;
+        }
+
+        return this->execute(indexes, opts);
+    }
+
+    bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> execute_unordered(
+        v1::client_bulk_write::options const& opts) const {
+        auto const batches = this->partition();
+
+        if (batches.size() <= 1u) {
+            return this->execute_ordered(opts);
+        }
+
+        std::vector<outcome> outcomes(batches.size());
+
+        auto run = [&](std::size_t i) noexcept {
+            try {
+                outcomes[i].result = this->execute(batches[i], opts);
+            } catch (...) {
+                outcomes[i].error = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::thread> workers;
+
+            workers.reserve(batches.size());
+
+            for (std::size_t i = 1u; i < batches.size(); ++i) {
+                try {
+                    workers.emplace_back(run, i);
+                } catch (std::system_error const&) {
+                    run(i); // Unable to create a thread: execute this sub-batch on the current thread instead.
+                }
+            }
+
+            run(0u);
+
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        return merge(batches, outcomes);
+    }
+
+    // Merge the outcomes of every sub-batch. Throws if any sub-batch failed.
+    static bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> merge(
+        std::vector<std::vector<std::size_t>> const& batches,
+        std::vector<outcome>& outcomes) {
+        merged_result merged;
+
+        bsoncxx::v1::stdx::optional<v1::exception> first_error;
+        std::exception_ptr unexpected_error;
+
+        std::vector<v1::client_bulk_write::exception> errors;
+        std::vector<v1::client_bulk_write::result> partial_results;
+        std::vector<indexed_source> write_errors;
+        std::vector<bsoncxx::v1::array::view> write_concern_errors;
+
+        // Avoid invalidating references to the partial results of each sub-batch.
+        errors.reserve(outcomes.size());
+        partial_results.reserve(outcomes.size());
+
+        for (std::size_t i = 0u; i < outcomes.size(); ++i) {
+            auto& o = outcomes[i];
+
+            if (!o.error) {
+                if (o.result) {
+                    merged.add(*o.result, batches[i]);
+                }
+
+                continue;
+            }
+
+            try {
+                std::rethrow_exception(o.error);
+            } catch (v1::client_bulk_write::exception const& ex) {
+                errors.push_back(ex);
+
+                auto const& e = errors.back();
+
+                if (!first_error) {
+                    first_error.emplace(e);
+                }
+
+                if (!e.write_errors().empty()) {
+                    write_errors.push_back({e.write_errors(), &batches[i]});
+                }
+
+                if (!e.write_concern_errors().empty()) {
+                    write_concern_errors.push_back(e.write_concern_errors());
+                }
+
+                if (auto res = e.partial_result()) {
+                    partial_results.push_back(std::move(*res));
+                    merged.add(partial_results.back(), batches[i]);
+                }
+            } catch (v1::exception const& ex) {
+                if (!first_error) {
+                    first_error.emplace(ex);
+                }
+            } catch (...) {
+                if (!unexpected_error) {
+                    unexpected_error = std::current_exception();
+                }
+            }
+        }
+
+        if (unexpected_error) {
+            std::rethrow_exception(unexpected_error);
+        }
+
+        if (!first_error) {
+            return merged.value();
+        }
+
+        using internal = v1::client_bulk_write::exception::internal;
+
+        auto ex = internal::make(std::move(*first_error));
+
+        if (!write_errors.empty()) {
+            internal::write_errors(ex) = merge_indexed(write_errors);
+        }
+
+        if (!write_concern_errors.empty()) {
+            internal::write_concern_errors(ex) = concat(write_concern_errors);
+        }
+
+        internal::partial_result(ex) = merged.value();
+
+        throw ex;
+    }
+
+    static impl& with(concurrent_client_bulk_write& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl const& with(concurrent_client_bulk_write const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl* with(concurrent_client_bulk_write* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl const* with(concurrent_client_bulk_write const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+concurrent_client_bulk_write::~concurrent_client_bulk_write() {
+    delete impl::with(_impl);
+}
+
+concurrent_client_bulk_write::concurrent_client_bulk_write(concurrent_client_bulk_write&& other) noexcept
+    : _impl{exchange(other._impl, nullptr)} {}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::operator=(concurrent_client_bulk_write&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+concurrent_client_bulk_write::concurrent_client_bulk_write(v1::pool& pool, options const& opts) : _impl{nullptr} {
+    auto const max_concurrency = opts.max_concurrency().value_or(default_max_concurrency);
+
+    if (max_concurrency == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_concurrency);
+    }
+
+    _impl = new impl{pool, max_concurrency};
+}
+
+concurrent_client_bulk_write::concurrent_client_bulk_write(v1::pool& pool)
+    : concurrent_client_bulk_write{pool, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+concurrent_client_bulk_write::operator bool() const {
+    return _impl != nullptr;
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view document,
+    v1::client_bulk_write::insert_one_options const& opts) {
+    impl::with(this)->push(ns, unary_op<v1::client_bulk_write::insert_one_options>{document, opts});
+    return *this;
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    bsoncxx::v1::document::view update,
+    v1::client_bulk_write::update_one_options const& opts) {
+    impl::with(this)->push(ns, binary_op<v1::client_bulk_write::update_one_options>{filter, update, opts});
+    return *this;
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    v1::pipeline const& update,
+    v1::client_bulk_write::update_one_options const& opts) {
+    return this->append(ns, filter, bsoncxx::v1::document::view{update.view_array()}, opts);
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    bsoncxx::v1::document::view update,
+    v1::client_bulk_write::update_many_options const& opts) {
+    impl::with(this)->push(ns, binary_op<v1::client_bulk_write::update_many_options>{filter, update, opts});
+    return *this;
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    v1::pipeline const& update,
+    v1::client_bulk_write::update_many_options const& opts) {
+    return this->append(ns, filter, bsoncxx::v1::document::view{update.view_array()}, opts);
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    bsoncxx::v1::document::view replacement,
+    v1::client_bulk_write::replace_one_options const& opts) {
+    impl::with(this)->push(ns, binary_op<v1::client_bulk_write::replace_one_options>{filter, replacement, opts});
+    return *this;
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    v1::client_bulk_write::delete_one_options const& opts) {
+    impl::with(this)->push(ns, unary_op<v1::client_bulk_write::delete_one_options>{filter, opts});
+    return *this;
+}
+
+concurrent_client_bulk_write& concurrent_client_bulk_write::append(
+    bsoncxx::v1::stdx::string_view ns,
+    bsoncxx::v1::document::view filter,
+    v1::client_bulk_write::delete_many_options const& opts) {
+    impl::with(this)->push(ns, unary_op<v1::client_bulk_write::delete_many_options>{filter, opts});
+    return *this;
+}
+
+std::size_t concurrent_client_bulk_write::size() const {
+    return impl::with(this)->_models.size();
+}
+
+bsoncxx::v1::stdx::optional<v1::client_bulk_write::result> concurrent_client_bulk_write::execute(
+    v1::client_bulk_write::options const& opts) {
+    auto& self = impl::with(*this);
+
+    // Clear the appended operations even when an exception is thrown.
+    struct clear_models {
+        std::vector<model>& models;
+
+        ~clear_models() {
+            models.clear();
+        }
+    } const guard{self._models};
+
+    if (opts.ordered().value_or(true) || self._max_concurrency == 1u) {
+        return self.execute_ordered(opts);
+    }
+
+    return self.execute_unordered(opts);
+}
+
+std::error_category const& concurrent_client_bulk_write::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::concurrent_client_bulk_write";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_max_concurrency:
+                    return "the maximum number of concurrent sub-batches must be greater than zero";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_concurrency:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_concurrency:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+void concurrent_client_bulk_write::internal::set_execute(concurrent_client_bulk_write& self, execute_type fn) {
+    impl::with(self)._execute = std::move(fn);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+concurrent_client_bulk_write::options::~options() {
+    delete impl::with(_impl);
+}
+
+concurrent_client_bulk_write::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+concurrent_client_bulk_write::options& concurrent_client_bulk_write::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+concurrent_client_bulk_write::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+concurrent_client_bulk_write::options& concurrent_client_bulk_write::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+concurrent_client_bulk_write::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+concurrent_client_bulk_write::options& concurrent_client_bulk_write::options::max_concurrency(std::size_t v) {
+    impl::with(this)->_max_concurrency = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> concurrent_client_bulk_write::options::max_concurrency() const {
+    return impl::with(this)->_max_concurrency;
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,46 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/concurrent_client_bulk_write.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/client_bulk_write.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <mongocxx/private/export.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class concurrent_client_bulk_write::internal {
+   public:
+    using execute_type = std::function<bsoncxx::v1::stdx::optional<v1::client_bulk_write::result>(
+        std::vector<std::size_t> const& indexes,
+        v1::client_bulk_write::options const& opts)>;
+
+    // Replace the execution of each sub-batch (given the indexes of its operations in the order they were appended),
+    // which is otherwise performed with a client object acquired from the associated pool.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(void) set_execute(concurrent_client_bulk_write& self, execute_type fn);
+};
+
+} // namespace v1
+} // namespace mongocxx
@@ -16,12 +16,25 @@
 
 //
 
+#include <bsoncxx/v1/document/value.hpp>
 #include <bsoncxx/v1/document/view.hpp>
 
 #include <mongocxx/v1/detail/macros.hpp>
 
 #include <mongocxx/v1/exception.hh>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include <bsoncxx/private/bson.hh>
 
 #include <mongocxx/private/mongoc.hh>
@@ -39,6 +52,155 @@ enum class state {
     is_dead,      // Cannot obtain any more documents (end).
 };
 
+// Double-buffered prefetching of result documents: a background thread fills the back buffer while the consumer
+// iterates over the front buffer.
+class prefetcher {
+   public:
+    using clock = std::chrono::steady_clock;
+
+    mongoc_cursor_t* _cursor;
+    std::size_t _buffer_size;
+
+    // Owned by the consumer.
+    std::vector<bsoncxx::v1::document::value> _front;
+    std::size_t _pos = 0u;
+    bool _finished = false;
+    std::exception_ptr _pending_error;
+
+    // Guarded by `_mutex`.
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<bsoncxx::v1::document::value> _back;
+    bool _back_ready = false;
+    bool _done = false;
+    std::exception_ptr _error;
+
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+
+    ~prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stop = true;
+        }
+
+        _cv.notify_all();
+        _thread.join();
+    }
+
+    prefetcher(prefetcher&&) = delete;
+    prefetcher& operator=(prefetcher&&) = delete;
+    prefetcher(prefetcher const&) = delete;
+    prefetcher& operator=(prefetcher const&) = delete;
+
+    prefetcher(mongoc_cursor_t* cursor, std::size_t buffer_size, std::vector<bsoncxx::v1::document::value> front)
+        : _cursor{cursor}, _buffer_size{(std::max)(buffer_size, std::size_t{1})}, _front{std::move(front)} {
+        _thread = std::thread{[this] { this->run(); }};
+    }
+
+    // Return null when there are no more result documents.
+    bsoncxx::v1::document::value const* next(cursor::prefetch_stats& stats) {
+        while (_pos == _front.size()) {
+            if (_finished) {
+                if (_pending_error) {
+                    std::rethrow_exception(exchange(_pending_error, nullptr));
+                }
+
+                return nullptr;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+
+                if (!_back_ready) {
+                    auto const start = clock::now();
+
+                    _cv.wait(lock, [&] { return _back_ready; });
+
+                    ++stats.waits;
+                    stats.wait_time += std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start);
+                }
+
+                _front.swap(_back);
+                _back.clear();
+                _back_ready = false;
+
+                if (_done) {
+                    _finished = true;
+                    _pending_error = exchange(_error, nullptr);
+                }
+            }
+
+            _cv.notify_all();
+
+            _pos = 0u;
+            ++stats.buffers;
+        }
+
+        ++stats.documents;
+
+        return &_front[_pos++];
+    }
+
+    void run() {
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+
+                _cv.wait(lock, [&] { return _stop || !_back_ready; });
+
+                if (_stop) {
+                    return;
+                }
+            }
+
+            std::vector<bsoncxx::v1::document::value> docs;
+            std::exception_ptr error;
+            bool done = false;
+
+            docs.reserve(_buffer_size);
+
+            try {
+                while (!_stop && docs.size() < _buffer_size) {
+                    scoped_bson_view doc;
+                    bson_error_t bson_error = {};
+
+                    if (libmongoc::cursor_next(_cursor, doc.out_ptr())) {
+                        docs.emplace_back(doc.view());
+                        continue;
+                    }
+
+                    done = true;
+
+                    if (libmongoc::cursor_error_document(_cursor, &bson_error, doc.out_ptr())) {
+                        throw_exception(bson_error, doc.view());
+                    }
+
+                    break;
+                }
+            } catch (...) {
+                error = std::current_exception();
+                done = true;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+
+                _back = std::move(docs);
+                _back_ready = true;
+                _done = done;
+                _error = std::move(error);
+            }
+
+            _cv.notify_all();
+
+            if (done) {
+                return;
+            }
+        }
+    }
+};
+
 } // namespace
 
 class cursor::impl {
@@ -47,8 +209,11 @@ class cursor::impl {
     bsoncxx::v1::document::view _doc; // The result document.
     state _state = state::can_get_more;
     type _type;
+    std::unique_ptr<prefetcher> _prefetcher;
+    prefetch_stats _stats;
 
     ~impl() {
+        _prefetcher.reset(); // Stop using `_cursor` before it is destroyed.
         libmongoc::cursor_destroy(_cursor);
     }
 
@@ -118,6 +283,32 @@ cursor::iterator cursor::begin() {
     }
 }
 
+void cursor::enable_prefetch(std::size_t buffer_size) {
+    auto& self = impl::with(*this);
+
+    if (self._prefetcher || self._type != type::k_non_tailable || self._state == state::is_dead) {
+        return;
+    }
+
+    // The current result document is owned by the underlying cursor and is invalidated by the background thread.
+    std::vector<bsoncxx::v1::document::value> front;
+
+    if (self._state == state::has_doc) {
+        front.emplace_back(self._doc);
+    }
+
+    self._prefetcher.reset(new prefetcher{self._cursor, buffer_size, std::move(front)});
+
+    if (self._state == state::has_doc) {
+        self._doc = self._prefetcher->next(self._stats)->view();
+        self._stats = {}; // Not a prefetched result document.
+    }
+}
+
+cursor::prefetch_stats cursor::stats() const {
+    return impl::with(this)->_stats;
+}
+
 cursor::cursor(void* impl) : _impl{impl} {}
 
 cursor cursor::internal::make(mongoc_cursor_t* cursor, type type) {
@@ -153,6 +344,24 @@ void cursor::internal::advance_iterator(cursor& self) {
     auto& _doc = impl::with(self)._doc;
     auto& _state = impl::with(self)._state;
 
+    if (auto const& _prefetcher = impl::with(self)._prefetcher) {
+        try {
+            if (auto const doc = _prefetcher->next(impl::with(self)._stats)) {
+                _state = state::has_doc;
+                _doc = doc->view();
+            } else {
+                _state = state::is_dead;
+                _doc = {};
+            }
+        } catch (...) {
+            _state = state::is_dead;
+            _doc = {};
+            throw;
+        }
+
+        return;
+    }
+
     scoped_bson_view doc;
     bson_error_t error = {};
 
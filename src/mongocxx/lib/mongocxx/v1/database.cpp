@@ -39,6 +39,8 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <bsoncxx/private/bson.hh>
@@ -50,24 +52,89 @@
 namespace mongocxx {
 namespace v1 {
 
+class database::internal::handles {
+   public:
+    mongoc_database_t* _db;
+    std::unordered_map<std::string, std::shared_ptr<mongoc_collection_t>> _collections;
+    std::string _key; // Reused by lookups to avoid allocating a temporary key.
+
+    ~handles() {
+        libmongoc::database_destroy(_db);
+    }
+
+    handles(handles&& other) noexcept = delete;
+    handles& operator=(handles&& other) noexcept = delete;
+    handles(handles const& other) = delete;
+    handles& operator=(handles const& other) = delete;
+
+    explicit handles(mongoc_database_t* db) : _db{db} {}
+
+    std::shared_ptr<mongoc_collection_t> const& collection(bsoncxx::v1::stdx::string_view name) {
+        _key.assign(name.data(), name.size());
+
+        auto iter = _collections.find(_key);
+
+        if (iter == _collections.end()) {
+            if (_collections.size() >= database::internal::max_cached_handles) {
+                _collections.clear(); // Handles which are still in use are kept alive by their collection objects.
+            }
+
+            std::shared_ptr<mongoc_collection_t> coll{
+                libmongoc::database_get_collection(_db, _key.c_str()),
+                [](mongoc_collection_t* ptr) { libmongoc::collection_destroy(ptr); }};
+
+            iter = _collections.emplace(_key, std::move(coll)).first;
+        }
+
+        return iter->second;
+    }
+
+    void evict(std::shared_ptr<mongoc_collection_t> const& coll) {
+        auto const iter = _collections.find(libmongoc::collection_get_name(coll.get()));
+
+        if (iter != _collections.end() && iter->second == coll) {
+            _collections.erase(iter);
+        }
+    }
+};
+
 class database::impl {
    public:
     mongoc_database_t* _db;
     mongoc_client_t* _client;
+    std::shared_ptr<database::internal::handles> _handles; // Owns `_db` when shared with cached handles.
 
     ~impl() {
-        libmongoc::database_destroy(_db);
+        if (!_handles) {
+            libmongoc::database_destroy(_db);
+        }
     }
 
     impl(impl&& other) noexcept = delete;
     impl& operator=(impl&& other) noexcept = delete;
 
-    impl(impl const& other) : _db{libmongoc::database_copy(other._db)}, _client{other._client} {}
+    impl(impl const& other)
+        : _db{other._handles ? other._db : libmongoc::database_copy(other._db)},
+          _client{other._client},
+          _handles{other._handles} {}
 
     impl& operator=(impl const& other) = delete;
 
     impl(mongoc_database_t* db, mongoc_client_t* client) : _db{db}, _client{client} {}
 
+    impl(std::shared_ptr<database::internal::handles> h, mongoc_client_t* client)
+        : _db{h->_db}, _client{client}, _handles{std::move(h)} {}
+
+    // Obtain an owned copy of shared handles before modifying them.
+    mongoc_database_t* detach() {
+        if (_handles) {
+            _db = libmongoc::database_copy(_db);
+            _handles.reset();
+        }
+
+        return _db;
+    }
+
     static impl const& with(database const& other) {
         return *static_cast<impl const*>(other._impl);
     }
@@ -378,7 +445,7 @@ bsoncxx::v1::stdx::string_view database::name() const {
 }
 
 void database::read_concern(v1::read_concern const& rc) {
-    libmongoc::database_set_read_concern(impl::with(this)->_db, v1::read_concern::internal::as_mongoc(rc));
+    libmongoc::database_set_read_concern(impl::with(this)->detach(), v1::read_concern::internal::as_mongoc(rc));
 }
 
 v1::read_concern database::read_concern() const {
@@ -387,7 +454,7 @@ v1::read_concern database::read_concern() const {
 }
 
 void database::read_preference(v1::read_preference const& rp) {
-    libmongoc::database_set_read_prefs(impl::with(this)->_db, v1::read_preference::internal::as_mongoc(rp));
+    libmongoc::database_set_read_prefs(impl::with(this)->detach(), v1::read_preference::internal::as_mongoc(rp));
 }
 
 v1::read_preference database::read_preference() const {
@@ -396,7 +463,7 @@ v1::read_preference database::read_preference() const {
 }
 
 void database::write_concern(v1::write_concern const& wc) {
-    libmongoc::database_set_write_concern(impl::with(this)->_db, v1::write_concern::internal::as_mongoc(wc));
+    libmongoc::database_set_write_concern(impl::with(this)->detach(), v1::write_concern::internal::as_mongoc(wc));
 }
 
 v1::write_concern database::write_concern() const {
@@ -405,9 +472,14 @@ v1::write_concern database::write_concern() const {
 }
 
 v1::collection database::collection(bsoncxx::v1::stdx::string_view name) const {
+    auto const& self = impl::with(*this);
+
+    if (self._handles) {
+        return v1::collection::internal::make_cached(self._handles->collection(name), self._handles, self._client);
+    }
+
     return v1::collection::internal::make(
-        libmongoc::database_get_collection(impl::with(this)->_db, std::string{name}.c_str()),
-        impl::with(this)->_client);
+        libmongoc::database_get_collection(self._db, std::string{name}.c_str()), self._client);
 }
 
 v1::collection database::operator[](bsoncxx::v1::stdx::string_view name) const {
@@ -451,7 +523,7 @@ v1::gridfs::bucket database::gridfs_bucket(v1::gridfs::bucket::options const& op
     }
 
     return v1::gridfs::bucket::internal::make(
-        std::move(files), std::move(chunks), std::move(bucket_name), default_chunk_size);
+        std::move(files), std::move(chunks), std::move(bucket_name), default_chunk_size, std::string{this->name()});
 }
 
 namespace {
@@ -503,6 +575,18 @@ database database::internal::make(mongoc_database_t* db, mongoc_client_t* client
     return {new impl{db, client}};
 }
 
+database database::internal::make_cached(std::shared_ptr<handles> h, mongoc_client_t* client) {
+    return {new impl{std::move(h), client}};
+}
+
+std::shared_ptr<database::internal::handles> database::internal::make_handles(mongoc_database_t* db) {
+    return std::make_shared<handles>(db);
+}
+
+void database::internal::evict(handles& h, std::shared_ptr<mongoc_collection_t> const& coll) {
+    h.evict(coll);
+}
+
 mongoc_database_t const* database::internal::as_mongoc(database const& self) {
     return impl::with(self)._db;
 }
@@ -18,6 +18,9 @@
 
 //
 
+#include <cstddef>
+#include <memory>
+
 #include <mongocxx/private/export.hh>
 #include <mongocxx/private/mongoc.hh>
 
@@ -26,7 +29,22 @@ namespace v1 {
 
 class database::internal {
    public:
+    // Handles cached by a client object for a single database name. Shared by all database objects obtained by that
+    // name, which must detach from the cached handles before modifying their read/write concern or read preference.
+    class handles;
+
+    // The maximum number of handles cached per client object (for databases) or per database (for collections). The
+    // cache is cleared when a lookup would exceed this limit.
+    static constexpr std::size_t max_cached_handles = 64u;
+
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(database) make(mongoc_database_t* db, mongoc_client_t* client);
+    static database make_cached(std::shared_ptr<handles> h, mongoc_client_t* client);
+
+    // Takes ownership of `db`.
+    static std::shared_ptr<handles> make_handles(mongoc_database_t* db);
+
+    // Remove `coll` from the collection handles cached by `h`, if present.
+    static void evict(handles& h, std::shared_ptr<mongoc_collection_t> const& coll);
 
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(mongoc_database_t const*) as_mongoc(database const& self);
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(mongoc_database_t*) as_mongoc(database& self);
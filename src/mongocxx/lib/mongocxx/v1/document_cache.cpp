@@ -0,0 +1,594 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/document_cache.hh>
+
+//
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+#include <mongocxx/v1/pool.hpp>
+
+#include <bsoncxx/v1/types/value.hh>
+
+#include <mongocxx/v1/exception.hh>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = document_cache::errc;
+
+namespace {
+
+constexpr std::chrono::milliseconds default_max_await_time{1000};
+constexpr std::size_t default_max_size = std::size_t{64u} * 1024u * 1024u;
+
+struct cache_key {
+    std::string coll_name;
+    bsoncxx::v1::types::value id;
+
+    friend bool operator==(cache_key const& lhs, cache_key const& rhs) {
+        return lhs.coll_name == rhs.coll_name && lhs.id == rhs.id;
+    }
+};
+
+struct cache_key_hash {
+    std::size_t operator()(cache_key const& k) const {
+        auto const h = std::hash<std::string>{}(k.coll_name);
+        return h ^ (std::hash<bsoncxx::v1::types::value>{}(k.id) + 0x9e3779b9u + (h << 6) + (h >> 2));
+    }
+};
+
+struct cache_entry {
+    cache_key key;
+    bsoncxx::v1::document::shared_value doc;
+    std::size_t size;
+};
+
+// The approximate memory used by a cached document, including bookkeeping.
+std::size_t entry_size(cache_key const& key, bsoncxx::v1::document::shared_value const& doc) {
+    return sizeof(cache_entry) + key.coll_name.size() + doc.length();
+}
+
+bsoncxx::v1::stdx::string_view get_string(bsoncxx::v1::element::view e) {
+    if (e && e.type_id() == bsoncxx::v1::types::id::k_string) {
+        return e.get_string().value;
+    }
+
+    return {};
+}
+
+} // namespace
+
+class document_cache::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<std::chrono::milliseconds> _max_await_time;
+    bsoncxx::v1::stdx::optional<std::size_t> _max_size;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class document_cache::impl {
+   public:
+    using list_type = std::list<cache_entry>;
+
+    v1::pool* _pool;
+    std::string _db_name;
+    std::chrono::milliseconds _max_await_time;
+    std::size_t _max_size;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cv;
+
+    list_type _lru; // Most recently used first.
+    std::unordered_map<cache_key, list_type::iterator, cache_key_hash> _index;
+    cache_stats _stats;
+
+    // Incremented by every eviction due to a change event or a flush. A document obtained from the server is only
+    // cached if no such eviction occurred while it was being obtained.
+    std::uint64_t _epoch = 0u;
+
+    bool _watching = false;
+    bool _stopping = false;
+
+    std::thread _watcher;
+
+    ~impl() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+
+        _cv.notify_all();
+
+        if (_watcher.joinable()) {
+            _watcher.join();
+        }
+    }
+
+    impl(impl&& other) noexcept = delete;
+    impl& operator=(impl&& other) noexcept = delete;
+    impl(impl const& other) = delete;
+    impl& operator=(impl const& other) = delete;
+
+    impl(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        std::chrono::milliseconds max_await_time,
+        std::size_t max_size)
+        : _pool{&pool}, _db_name{db_name}, _max_await_time{max_await_time}, _max_size{max_size} {
+        _watcher = std::thread{[this] { this->run(); }};
+    }
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value> find_one(
+        bsoncxx::v1::stdx::string_view coll_name,
+        bsoncxx::v1::types::view id) {
+        cache_key key{std::string{coll_name}, bsoncxx::v1::types::value{id}};
+        std::uint64_t epoch = 0u;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            auto const iter = _index.find(key);
+
+            if (iter != _index.end()) {
+                _lru.splice(_lru.begin(), _lru, iter->second);
+                ++_stats.hits;
+                return iter->second->doc;
+            }
+
+            ++_stats.misses;
+            epoch = _epoch;
+        }
+
+        scoped_bson filter;
+        BSON_APPEND_VALUE(filter.inout_ptr(), "_id", &bsoncxx::v1::types::value::internal::get_bson_value(key.id));
+
+        auto entry = _pool->acquire();
+        auto doc = entry->database(_db_name)[coll_name].find_one(filter.view());
+
+        if (!doc) {
+            return {};
+        }
+
+        bsoncxx::v1::document::shared_value ret{std::move(*doc)};
+
+        // Cache the document under the exact BSON type and value of its "_id" field as reported by change events.
+        if (auto const e = ret.view()["_id"]) {
+            key.id = e.type_value();
+
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (_watching && _epoch == epoch) {
+                this->insert(std::move(key), ret);
+            }
+        }
+
+        return ret;
+    }
+
+    // Requires `_mutex` to be locked.
+    void insert(cache_key key, bsoncxx::v1::document::shared_value doc) {
+        auto const size = entry_size(key, doc);
+
+        if (size > _max_size) {
+            return;
+        }
+
+        this->erase(key);
+
+        _lru.push_front(cache_entry{key, std::move(doc), size});
+        _index.emplace(std::move(key), _lru.begin());
+        _stats.size += size;
+
+        while (_stats.size > _max_size) {
+            this->erase(_lru.back().key);
+            ++_stats.evictions;
+        }
+
+        _stats.entries = _index.size();
+    }
+
+    // Requires `_mutex` to be locked.
+    bool erase(cache_key const& key) {
+        auto const iter = _index.find(key);
+
+        if (iter == _index.end()) {
+            return false;
+        }
+
+        auto const entry = iter->second;
+
+        _stats.size -= entry->size;
+        _index.erase(iter);
+        _lru.erase(entry);
+        _stats.entries = _index.size();
+
+        return true;
+    }
+
+    void evict(bsoncxx::v1::stdx::string_view coll_name, bsoncxx::v1::types::view id) {
+        cache_key const key{std::string{coll_name}, bsoncxx::v1::types::value{id}};
+
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        ++_epoch;
+
+        if (this->erase(key)) {
+            ++_stats.invalidations;
+        }
+    }
+
+    // Requires `_mutex` to be locked.
+    void flush() {
+        ++_epoch;
+        ++_stats.flushes;
+
+        _index.clear();
+        _lru.clear();
+        _stats.entries = 0u;
+        _stats.size = 0u;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock{_mutex};
+        this->flush();
+    }
+
+    void set_watching(bool v) {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        // Documents may have been modified while the change stream was unavailable.
+        if (_watching && !v) {
+            this->flush();
+        }
+
+        _watching = v;
+    }
+
+    bool stopping() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+        return _stopping;
+    }
+
+    bool on_event(bsoncxx::v1::document::view event) {
+        auto const op = get_string(event["operationType"]);
+
+        if (op == "update" || op == "replace" || op == "delete") {
+            auto const coll_name = get_string(event["ns"]["coll"]);
+            auto const id = event["documentKey"]["_id"];
+
+            if (id) {
+                this->evict(coll_name, id.type_view());
+            } else {
+                this->clear();
+            }
+
+            return true;
+        }
+
+        if (op == "drop" || op == "rename" || op == "dropDatabase") {
+            this->clear();
+            return true;
+        }
+
+        if (op == "invalidate") {
+            this->clear();
+            return false;
+        }
+
+        return true;
+    }
+
+    // Observe change events until the change stream fails, is invalidated, or the cache is destroyed.
+    void watch() {
+        auto entry = _pool->acquire();
+
+        v1::pipeline pipeline;
+        pipeline.project(scoped_bson{R"({"operationType": 1, "ns": 1, "documentKey": 1})"}.view());
+
+        auto stream = entry->database(_db_name).watch(
+            pipeline, v1::change_stream::options{}.max_await_time(_max_await_time));
+
+        bool established = false;
+
+        while (!this->stopping()) {
+            auto const event = stream.try_next();
+
+            // Errors opening the change stream are only observed when it is first advanced.
+            if (!established) {
+                established = true;
+                this->set_watching(true);
+            }
+
+            if (event && !this->on_event(*event)) {
+                return;
+            }
+        }
+    }
+
+    void run() noexcept {
+        while (!this->stopping()) {
+            try {
+                this->watch();
+            } catch (...) {
+                // Reestablish the change stream after a delay.
+            }
+
+            this->set_watching(false);
+
+            std::unique_lock<std::mutex> lock{_mutex};
+            _cv.wait_for(lock, _max_await_time, [&] { return _stopping; });
+        }
+    }
+
+    static impl const& with(document_cache const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(document_cache const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(document_cache& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(document_cache* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+document_cache::~document_cache() {
+    delete impl::with(this);
+}
+
+document_cache::document_cache(document_cache&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+document_cache& document_cache::operator=(document_cache&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+document_cache::document_cache(v1::pool& pool, bsoncxx::v1::stdx::string_view db_name, options const& opts)
+    : _impl{nullptr} {
+    auto const max_await_time = opts.max_await_time().value_or(default_max_await_time);
+    auto const max_size = opts.max_size().value_or(default_max_size);
+
+    if (max_size == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_size);
+    }
+
+    _impl = new impl{pool, db_name, max_await_time, max_size};
+}
+
+document_cache::document_cache(v1::pool& pool, bsoncxx::v1::stdx::string_view db_name)
+    : document_cache{pool, db_name, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+document_cache::operator bool() const {
+    return _impl != nullptr;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::shared_value> document_cache::find_one(
+    bsoncxx::v1::stdx::string_view coll_name,
+    bsoncxx::v1::types::view id) {
+    return impl::with(this)->find_one(coll_name, id);
+}
+
+void document_cache::evict(bsoncxx::v1::stdx::string_view coll_name, bsoncxx::v1::types::view id) {
+    impl::with(this)->evict(coll_name, id);
+}
+
+void document_cache::clear() {
+    impl::with(this)->clear();
+}
+
+bool document_cache::watching() const {
+    auto const& self = impl::with(*this);
+
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._watching;
+}
+
+document_cache::cache_stats document_cache::stats() const {
+    auto const& self = impl::with(*this);
+
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._stats;
+}
+
+std::error_category const& document_cache::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::document_cache";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_max_size:
+                    return "the maximum size must be greater than zero";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_size:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_size:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+void document_cache::internal::insert(
+    document_cache& self,
+    bsoncxx::v1::stdx::string_view coll_name,
+    bsoncxx::v1::document::view doc) {
+    auto& cache = impl::with(self);
+
+    std::lock_guard<std::mutex> lock{cache._mutex};
+
+    cache.insert(
+        cache_key{std::string{coll_name}, doc["_id"].type_value()}, bsoncxx::v1::document::shared_value{doc});
+}
+
+bool document_cache::internal::on_event(document_cache& self, bsoncxx::v1::document::view event) {
+    return impl::with(self).on_event(event);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+document_cache::options::~options() {
+    delete impl::with(_impl);
+}
+
+document_cache::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+document_cache::options& document_cache::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+document_cache::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+document_cache::options& document_cache::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+document_cache::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+document_cache::options& document_cache::options::max_await_time(std::chrono::milliseconds v) {
+    impl::with(this)->_max_await_time = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::chrono::milliseconds> document_cache::options::max_await_time() const {
+    return impl::with(this)->_max_await_time;
+}
+
+document_cache::options& document_cache::options::max_size(std::size_t v) {
+    impl::with(this)->_max_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> document_cache::options::max_size() const {
+    return impl::with(this)->_max_size;
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,40 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/document_cache.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/private/export.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class document_cache::internal {
+   public:
+    // Cache `doc` as though it was obtained from the collection `coll_name` while the change stream is established.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(void)
+    insert(document_cache& self, bsoncxx::v1::stdx::string_view coll_name, bsoncxx::v1::document::view doc);
+
+    // Apply the change event `event`. Returns false when the change stream must be reestablished.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bool) on_event(document_cache& self, bsoncxx::v1::document::view event);
+};
+
+} // namespace v1
+} // namespace mongocxx
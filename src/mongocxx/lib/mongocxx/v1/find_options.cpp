@@ -20,6 +20,7 @@
 #include <bsoncxx/v1/stdx/optional.hpp>
 
 #include <mongocxx/v1/cursor.hpp>
+#include <mongocxx/v1/detail/macros.hpp>
 #include <mongocxx/v1/read_concern.hpp>
 #include <mongocxx/v1/read_preference.hpp>
 
@@ -29,7 +30,11 @@
 
 #include <chrono>
 #include <cstdint>
+#include <stdexcept>
 
+#include <bsoncxx/private/bson.hh>
+
+#include <mongocxx/private/scoped_bson.hh>
 #include <mongocxx/private/utility.hh>
 
 namespace mongocxx {
@@ -384,5 +389,117 @@ bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>& find_options::interna
     return impl::with(self)._sort;
 }
 
+void find_options::internal::append_to(find_options const& self, scoped_bson& doc) {
+    if (auto const& opt = impl::with(self)._allow_disk_use) {
+        doc += scoped_bson{BCON_NEW("allowDiskUse", BCON_BOOL(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._allow_partial_results) {
+        doc += scoped_bson{BCON_NEW("allowPartialResults", BCON_BOOL(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._batch_size) {
+        doc += scoped_bson{BCON_NEW("batchSize", BCON_INT32(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._collation) {
+        doc += scoped_bson{BCON_NEW("collation", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
+    }
+
+    if (auto const& opt = impl::with(self)._comment) {
+        scoped_bson v;
+
+        if (!BSON_APPEND_VALUE(v.inout_ptr(), "comment", &bsoncxx::v1::types::value::internal::get_bson_value(*opt))) {
+            throw std::logic_error{"mongocxx::v1::find_options::internal::append_to: BSON_APPEND_VALUE failed"};
+        }
+
+        doc += v;
+    }
+
+    if (auto const& opt = impl::with(self)._cursor_type) {
+        switch (*opt) {
+            case v1::cursor::type::k_non_tailable: {
+                // Do nothing.
+            } break;
+
+            case v1::cursor::type::k_tailable: {
+                doc += scoped_bson{BCON_NEW("tailable", BCON_BOOL(true))};
+            } break;
+
+            case v1::cursor::type::k_tailable_await: {
+                doc += scoped_bson{BCON_NEW("tailable", BCON_BOOL(true), "awaitData", BCON_BOOL(true))};
+            } break;
+
+            default:
+                MONGOCXX_PRIVATE_UNREACHABLE;
+        }
+    }
+
+    if (auto const& opt = impl::with(self)._hint) {
+        scoped_bson v;
+
+        if (!BSON_APPEND_VALUE(
+                v.inout_ptr(),
+                "hint",
+                &bsoncxx::v1::types::value::internal::get_bson_value(bsoncxx::v1::types::value{opt->to_value()}))) {
+            throw std::logic_error{"mongocxx::v1::find_options::internal::append_to: BSON_APPEND_VALUE failed"};
+        }
+
+        doc += v;
+    }
+
+    if (auto const& opt = impl::with(self)._let) {
+        doc += scoped_bson{BCON_NEW("let", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
+    }
+
+    if (auto const& opt = impl::with(self)._limit) {
+        doc += scoped_bson{BCON_NEW("limit", BCON_INT64(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._max) {
+        doc += scoped_bson{BCON_NEW("max", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
+    }
+
+    if (auto const& opt = impl::with(self)._max_await_time) {
+        doc += scoped_bson{BCON_NEW("maxAwaitTimeMS", BCON_INT64(std::int64_t{opt->count()}))};
+    }
+
+    if (auto const& opt = impl::with(self)._max_time) {
+        doc += scoped_bson{BCON_NEW("maxTimeMS", BCON_INT64(std::int64_t{opt->count()}))};
+    }
+
+    if (auto const& opt = impl::with(self)._min) {
+        doc += scoped_bson{BCON_NEW("min", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
+    }
+
+    if (auto const& opt = impl::with(self)._no_cursor_timeout) {
+        doc += scoped_bson{BCON_NEW("noCursorTimeout", BCON_BOOL(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._projection) {
+        doc += scoped_bson{BCON_NEW("projection", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
+    }
+
+    if (auto const& opt = impl::with(self)._return_key) {
+        doc += scoped_bson{BCON_NEW("returnKey", BCON_BOOL(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._show_record_id) {
+        doc += scoped_bson{BCON_NEW("showRecordId", BCON_BOOL(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._skip) {
+        doc += scoped_bson{BCON_NEW("skip", BCON_INT64(*opt))};
+    }
+
+    if (auto const& opt = impl::with(self)._read_concern) {
+        doc += scoped_bson{BCON_NEW("readConcern", BCON_DOCUMENT(scoped_bson{opt->to_document()}.bson()))};
+    }
+
+    if (auto const& opt = impl::with(self)._sort) {
+        doc += scoped_bson{BCON_NEW("sort", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
+    }
+}
+
 } // namespace v1
 } // namespace mongocxx
@@ -27,6 +27,8 @@
 
 #include <bsoncxx/v1/stdx/optional.hpp>
 
+#include <mongocxx/private/scoped_bson.hh>
+
 namespace mongocxx {
 namespace v1 {
 
@@ -53,6 +55,8 @@ class find_options::internal {
     static bsoncxx::v1::stdx::optional<v1::read_preference>& read_preference(find_options& self);
     static bsoncxx::v1::stdx::optional<v1::read_concern>& read_concern(find_options& self);
     static bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value>& sort(find_options& self);
+
+    static void append_to(find_options const& self, scoped_bson& doc);
 };
 
 } // namespace v1
@@ -20,15 +20,18 @@
 #include <bsoncxx/v1/stdx/optional.hpp>
 #include <bsoncxx/v1/stdx/string_view.hpp>
 
+#include <mongocxx/v1/client.hpp>
 #include <mongocxx/v1/client_session.hpp>
 #include <mongocxx/v1/collection.hpp>
 #include <mongocxx/v1/cursor.hpp>
+#include <mongocxx/v1/database.hpp>
 #include <mongocxx/v1/delete_many_result.hpp> // IWYU pragma: keep
 #include <mongocxx/v1/delete_one_result.hpp>
 #include <mongocxx/v1/detail/macros.hpp>
 #include <mongocxx/v1/find_options.hpp>
 #include <mongocxx/v1/gridfs/upload_options.hpp>
 #include <mongocxx/v1/indexes.hpp>
+#include <mongocxx/v1/pool.hpp>
 #include <mongocxx/v1/read_concern.hpp>
 #include <mongocxx/v1/read_preference.hpp>
 #include <mongocxx/v1/write_concern.hpp>
@@ -41,17 +44,36 @@
 #include <mongocxx/v1/gridfs/uploader.hh>
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <exception>
+#include <fstream>
 #include <ios>
 #include <istream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <stdexcept>
 #include <string>
 #include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#endif
 
 #include <bsoncxx/private/bson.hh>
 #include <bsoncxx/private/immortal.hh>
@@ -72,13 +94,20 @@ class bucket::impl {
     v1::collection _chunks;
     std::string _bucket_name;
     std::int32_t _default_chunk_size;
+    std::string _database_name;
     bool _indexes_created = false;
 
-    impl(v1::collection files, v1::collection chunks, std::string bucket_name, std::int32_t default_chunk_size)
+    impl(
+        v1::collection files,
+        v1::collection chunks,
+        std::string bucket_name,
+        std::int32_t default_chunk_size,
+        std::string database_name)
         : _files{std::move(files)},
           _chunks{std::move(chunks)},
           _bucket_name{std::move(bucket_name)},
-          _default_chunk_size{default_chunk_size} {}
+          _default_chunk_size{default_chunk_size},
+          _database_name{std::move(database_name)} {}
 
     static impl const& with(bucket const& other) {
         return *static_cast<impl const*>(other._impl);
@@ -153,7 +182,7 @@ v1::gridfs::uploader bucket::open_upload_stream_with_id(
     bsoncxx::v1::stdx::string_view filename,
     v1::gridfs::upload_options const& opts) {
     return internal::open_upload_stream_with_id_impl(
-        *this, nullptr, id, filename, opts.chunk_size_bytes(), opts.metadata());
+        *this, nullptr, id, filename, opts.chunk_size_bytes(), opts.metadata(), opts.content_digest());
 }
 
 v1::gridfs::uploader bucket::open_upload_stream_with_id(
@@ -162,7 +191,7 @@ v1::gridfs::uploader bucket::open_upload_stream_with_id(
     bsoncxx::v1::stdx::string_view filename,
     v1::gridfs::upload_options const& opts) {
     return internal::open_upload_stream_with_id_impl(
-        *this, &session, id, filename, opts.chunk_size_bytes(), opts.metadata());
+        *this, &session, id, filename, opts.chunk_size_bytes(), opts.metadata(), opts.content_digest());
 }
 
 v1::gridfs::upload_result bucket::upload_from_stream(
@@ -207,6 +236,167 @@ void bucket::upload_from_stream_with_id(
 
 namespace {
 
+[[noreturn]] void throw_errno(int err, char const* message) {
+    throw v1::exception::internal::make(err, std::generic_category(), message);
+}
+
+#if !defined(_WIN32)
+
+// A read-only regular file which is memory-mapped one region at a time.
+class input_file {
+   private:
+    // Bound the address space reserved at any one time regardless of the size of the file.
+    static constexpr std::size_t region_size = std::size_t{64} * 1024u * 1024u;
+
+    int _fd;
+    std::uint64_t _size;
+
+   public:
+    ~input_file() {
+        (void)::close(_fd);
+    }
+
+    input_file(input_file&&) = delete;
+    input_file& operator=(input_file&&) = delete;
+    input_file(input_file const&) = delete;
+    input_file& operator=(input_file const&) = delete;
+
+    explicit input_file(std::string const& path) : _fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)}, _size{} {
+        if (_fd < 0) {
+            throw_errno(errno, "mongocxx::v1::gridfs::bucket::upload_from_file: open failed");
+        }
+
+        struct stat st = {};
+
+        if (::fstat(_fd, &st) != 0) {
+            auto const err = errno;
+            (void)::close(_fd);
+            throw_errno(err, "mongocxx::v1::gridfs::bucket::upload_from_file: fstat failed");
+        }
+
+        if (!S_ISREG(st.st_mode)) {
+            (void)::close(_fd);
+            throw_errno(EINVAL, "mongocxx::v1::gridfs::bucket::upload_from_file: not a regular file");
+        }
+
+        _size = static_cast<std::uint64_t>(st.st_size);
+    }
+
+    // Invoke `fn(data, length)` for each consecutive region of the file.
+    template <typename Fn>
+    void for_each_region(Fn fn) const {
+        for (std::uint64_t offset = 0u; offset < _size;) {
+            auto const length = static_cast<std::size_t>((std::min)(_size - offset, std::uint64_t{region_size}));
+
+            void* const ptr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, _fd, static_cast<off_t>(offset));
+
+            if (ptr == MAP_FAILED) {
+                throw_errno(errno, "mongocxx::v1::gridfs::bucket::upload_from_file: mmap failed");
+            }
+
+            struct unmap_guard {
+                void* ptr;
+                std::size_t length;
+
+                ~unmap_guard() {
+                    (void)::munmap(ptr, length);
+                }
+            } const guard{ptr, length};
+
+            // Advisory only: failure does not affect correctness.
+            (void)::posix_madvise(ptr, length, POSIX_MADV_SEQUENTIAL);
+
+            fn(static_cast<std::uint8_t const*>(ptr), length);
+
+            offset += length;
+        }
+    }
+};
+
+void upload_from_file_impl(v1::gridfs::uploader uploader, input_file const& file) {
+    try {
+        file.for_each_region([&](std::uint8_t const* data, std::size_t length) { uploader.write(data, length); });
+    } catch (...) {
+        uploader.abort();
+        throw;
+    }
+
+    uploader.close();
+}
+
+#else
+
+class input_file {
+   private:
+    std::ifstream _input;
+
+   public:
+    explicit input_file(std::string const& path) : _input{path, std::ios::binary} {
+        if (!_input) {
+            throw_errno(ENOENT, "mongocxx::v1::gridfs::bucket::upload_from_file: open failed");
+        }
+    }
+
+    std::istream& stream() {
+        return _input;
+    }
+};
+
+void upload_from_file_impl(v1::gridfs::uploader uploader, input_file& file) {
+    bucket::internal::upload_from_stream_with_id_impl(std::move(uploader), file.stream());
+}
+
+#endif // !defined(_WIN32)
+
+} // namespace
+
+v1::gridfs::upload_result bucket::upload_from_file(
+    bsoncxx::v1::stdx::string_view filename,
+    bsoncxx::v1::stdx::string_view path,
+    v1::gridfs::upload_options const& opts) {
+    bsoncxx::v1::types::value id{bsoncxx::v1::oid{}};
+
+    this->upload_from_file_with_id(id, filename, path, opts);
+
+    return v1::gridfs::upload_result::internal::make(std::move(id));
+}
+
+v1::gridfs::upload_result bucket::upload_from_file(
+    v1::client_session const& session,
+    bsoncxx::v1::stdx::string_view filename,
+    bsoncxx::v1::stdx::string_view path,
+    v1::gridfs::upload_options const& opts) {
+    bsoncxx::v1::types::value id{bsoncxx::v1::oid{}};
+
+    this->upload_from_file_with_id(session, id, filename, path, opts);
+
+    return v1::gridfs::upload_result::internal::make(std::move(id));
+}
+
+void bucket::upload_from_file_with_id(
+    bsoncxx::v1::types::view id,
+    bsoncxx::v1::stdx::string_view filename,
+    bsoncxx::v1::stdx::string_view path,
+    v1::gridfs::upload_options const& opts) {
+    // Open the file first: do not create any server-side state for a file which cannot be read.
+    input_file file{std::string{path}};
+
+    upload_from_file_impl(this->open_upload_stream_with_id(id, filename, opts), file);
+}
+
+void bucket::upload_from_file_with_id(
+    v1::client_session const& session,
+    bsoncxx::v1::types::view id,
+    bsoncxx::v1::stdx::string_view filename,
+    bsoncxx::v1::stdx::string_view path,
+    v1::gridfs::upload_options const& opts) {
+    input_file file{std::string{path}};
+
+    upload_from_file_impl(this->open_upload_stream_with_id(session, id, filename, opts), file);
+}
+
+namespace {
+
 void append_bson_value(char const* name, bsoncxx::v1::types::view const& value, scoped_bson& doc) {
     scoped_bson v;
     if (!BSON_APPEND_VALUE(
@@ -278,6 +468,37 @@ void bucket::download_to_stream(
         std::move(downloader), output, static_cast<std::int64_t>(start), static_cast<std::int64_t>(end));
 }
 
+void bucket::download_to_file(bsoncxx::v1::types::view id, bsoncxx::v1::stdx::string_view path) {
+    internal::download_to_file_impl(*this, nullptr, nullptr, id, path, -1, 1u);
+}
+
+void bucket::download_to_file(
+    v1::client_session const& session,
+    bsoncxx::v1::types::view id,
+    bsoncxx::v1::stdx::string_view path) {
+    internal::download_to_file_impl(*this, &session, nullptr, id, path, -1, 1u);
+}
+
+void bucket::download_to_file(bsoncxx::v1::types::view id, int fd) {
+    internal::download_to_file_impl(*this, nullptr, nullptr, id, {}, fd, 1u);
+}
+
+void bucket::download_to_file(v1::client_session const& session, bsoncxx::v1::types::view id, int fd) {
+    internal::download_to_file_impl(*this, &session, nullptr, id, {}, fd, 1u);
+}
+
+void bucket::download_to_file(
+    v1::pool& pool,
+    bsoncxx::v1::types::view id,
+    bsoncxx::v1::stdx::string_view path,
+    std::size_t max_concurrency) {
+    internal::download_to_file_impl(*this, nullptr, &pool, id, path, -1, max_concurrency);
+}
+
+void bucket::download_to_file(v1::pool& pool, bsoncxx::v1::types::view id, int fd, std::size_t max_concurrency) {
+    internal::download_to_file_impl(*this, nullptr, &pool, id, {}, fd, max_concurrency);
+}
+
 void bucket::delete_file(bsoncxx::v1::types::view id) {
     internal::delete_file_impl(*this, nullptr, id);
 }
@@ -319,6 +540,8 @@ std::error_category const& bucket::error_category() {
                     return "the GridFS file is in an invalid or inconsistent state";
                 case code::invalid_byte_range:
                     return "[start, end) must be a valid range of byte indexes within the requested GridFS file";
+                case code::invalid_max_concurrency:
+                    return "the maximum concurrency must be a positive value";
                 default:
                     return std::string(this->name()) + ':' + std::to_string(v);
             }
@@ -336,6 +559,7 @@ std::error_category const& bucket::error_category() {
                     case code::not_found:
                     case code::corrupt_data:
                     case code::invalid_byte_range:
+                    case code::invalid_max_concurrency:
                         return source == condition::mongocxx;
 
                     case code::zero:
@@ -353,6 +577,7 @@ std::error_category const& bucket::error_category() {
                     case code::invalid_bucket_name:
                     case code::invalid_chunk_size_bytes:
                     case code::invalid_byte_range:
+                    case code::invalid_max_concurrency:
                         return type == condition::invalid_argument;
 
                     case code::not_found:
@@ -484,8 +709,10 @@ bucket bucket::internal::make(
     v1::collection files,
     v1::collection chunks,
     std::string bucket_name,
-    std::int32_t default_chunk_size) {
-    return {new impl{std::move(files), std::move(chunks), std::move(bucket_name), default_chunk_size}};
+    std::int32_t default_chunk_size,
+    std::string database_name) {
+    return {new impl{
+        std::move(files), std::move(chunks), std::move(bucket_name), default_chunk_size, std::move(database_name)}};
 }
 
 std::int32_t bucket::internal::default_chunk_size(bucket const& self) {
@@ -595,6 +822,53 @@ find_files_doc(v1::collection& files, v1::client_session const* session_ptr, bso
     return std::move(*files_doc);
 }
 
+std::int32_t read_chunk_size(bsoncxx::v1::document::view files_doc) {
+    static constexpr std::int64_t max_chunk_size = {16 * 1024 * 1024};
+
+    static_assert(
+        max_chunk_size <= std::numeric_limits<std::int32_t>::max(),
+        "chunkSize must be representable as an std::int32_t");
+
+    auto const raw_chunk_size = read_integral_field("chunkSize", files_doc);
+
+    // Each chunk needs to be able to fit in a single document.
+    if (raw_chunk_size > max_chunk_size) {
+        std::string msg;
+
+        msg += "files document contains unexpected chunk size of ";
+        msg += std::to_string(raw_chunk_size);
+        msg += ", which exceeds maximum chunk size of ";
+        msg += std::to_string(max_chunk_size);
+
+        throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+    } else if (raw_chunk_size <= 0) {
+        std::string msg;
+
+        msg += "files document contains unexpected chunk size: ";
+        msg += std::to_string(raw_chunk_size);
+        msg += "; value must be positive";
+
+        throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+    }
+
+    return static_cast<std::int32_t>(raw_chunk_size);
+}
+
+std::int64_t read_file_length(bsoncxx::v1::document::view files_doc) {
+    auto const raw_file_len = read_integral_field("length", files_doc);
+
+    if (raw_file_len < 0) {
+        std::string msg;
+
+        msg += "files document contains unexpected negative value for \"length\": ";
+        msg += std::to_string(raw_file_len);
+
+        throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+    }
+
+    return raw_file_len;
+}
+
 } // namespace
 
 v1::gridfs::uploader bucket::internal::open_upload_stream_with_id_impl(
@@ -603,7 +877,8 @@ v1::gridfs::uploader bucket::internal::open_upload_stream_with_id_impl(
     bsoncxx::v1::types::view id,
     bsoncxx::v1::stdx::string_view filename,
     bsoncxx::v1::stdx::optional<std::int32_t> chunk_size_bytes,
-    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata) {
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata,
+    bsoncxx::v1::stdx::optional<v1::gridfs::upload_options::digest_algorithm> content_digest) {
     auto& impl = impl::with(self);
 
     auto const chunk_size = internal::compute_chunk_size(self, chunk_size_bytes);
@@ -617,7 +892,8 @@ v1::gridfs::uploader bucket::internal::open_upload_stream_with_id_impl(
         std::string{filename},
         bsoncxx::v1::types::value{id},
         chunk_size,
-        metadata);
+        metadata,
+        content_digest);
 }
 
 v1::gridfs::downloader bucket::internal::open_download_stream_impl(
@@ -634,52 +910,8 @@ v1::gridfs::downloader bucket::internal::open_download_stream_impl(
     auto const files_doc = find_files_doc(files, session_ptr, id);
     auto const file_length = read_integral_field("length", files_doc);
 
-    auto const chunk_size = [&]() -> std::int32_t {
-        static constexpr std::int64_t max_chunk_size = {16 * 1024 * 1024};
-
-        static_assert(
-            max_chunk_size <= std::numeric_limits<std::int32_t>::max(),
-            "chunkSize must be representable as an std::int32_t");
-
-        auto const raw_chunk_size = read_integral_field("chunkSize", files_doc);
-
-        // Each chunk needs to be able to fit in a single document.
-        if (raw_chunk_size > max_chunk_size) {
-            std::string msg;
-
-            msg += "files document contains unexpected chunk size of ";
-            msg += std::to_string(raw_chunk_size);
-            msg += ", which exceeds maximum chunk size of ";
-            msg += std::to_string(max_chunk_size);
-
-            throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
-        } else if (raw_chunk_size <= 0) {
-            std::string msg;
-
-            msg += "files document contains unexpected chunk size: ";
-            msg += std::to_string(raw_chunk_size);
-            msg += "; value must be positive";
-
-            throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
-        }
-
-        return static_cast<std::int32_t>(raw_chunk_size);
-    }();
-
-    auto const file_len = [&]() -> std::int64_t {
-        auto const raw_file_len = read_integral_field("length", files_doc);
-
-        if (raw_file_len < 0) {
-            std::string msg;
-
-            msg += "files document contains unexpected negative value for \"length\": ";
-            msg += std::to_string(raw_file_len);
-
-            throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
-        }
-
-        return raw_file_len;
-    }();
+    auto const chunk_size = read_chunk_size(files_doc);
+    auto const file_len = read_file_length(files_doc);
 
     if (file_length == 0) {
         return v1::gridfs::downloader::internal::make();
@@ -787,6 +1019,369 @@ void bucket::internal::download_to_stream_impl(
     downloader.close();
 }
 
+namespace {
+
+#if !defined(_WIN32)
+
+// A writable file which supports concurrent positioned writes.
+class output_file {
+   private:
+    int _fd;
+    bool _owned;
+
+   public:
+    ~output_file() {
+        if (_owned) {
+            (void)::close(_fd);
+        }
+    }
+
+    output_file(output_file&&) = delete;
+    output_file& operator=(output_file&&) = delete;
+    output_file(output_file const&) = delete;
+    output_file& operator=(output_file const&) = delete;
+
+    explicit output_file(int fd) : _fd{fd}, _owned{false} {}
+
+    explicit output_file(std::string const& path)
+        : _fd{::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666)}, _owned{true} {
+        if (_fd < 0) {
+            throw_errno(errno, "mongocxx::v1::gridfs::bucket::download_to_file: open failed");
+        }
+    }
+
+    void preallocate(std::int64_t length) {
+#if defined(__linux__)
+        // Advisory only: filesystems which do not support preallocation allocate storage on write instead.
+        if (length > 0) {
+            (void)::fallocate(_fd, 0, 0, static_cast<off_t>(length));
+        }
+#else
+        (void)length;
+#endif
+    }
+
+    void write_at(std::int64_t offset, std::uint8_t const* data, std::size_t length) {
+        while (length > 0u) {
+            auto const n = ::pwrite(_fd, data, length, static_cast<off_t>(offset));
+
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                throw_errno(errno, "mongocxx::v1::gridfs::bucket::download_to_file: pwrite failed");
+            }
+
+            data += n;
+            length -= static_cast<std::size_t>(n);
+            offset += n;
+        }
+    }
+};
+
+#else
+
+// A writable file which supports concurrent positioned writes.
+class output_file {
+   private:
+    int _fd;
+    bool _owned;
+    std::mutex _mutex; // Guards the file offset.
+
+   public:
+    ~output_file() {
+        if (_owned) {
+            (void)::_close(_fd);
+        }
+    }
+
+    output_file(output_file&&) = delete;
+    output_file& operator=(output_file&&) = delete;
+    output_file(output_file const&) = delete;
+    output_file& operator=(output_file const&) = delete;
+
+    explicit output_file(int fd) : _fd{fd}, _owned{false} {}
+
+    explicit output_file(std::string const& path)
+        : _fd{::_open(
+              path.c_str(),
+              _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY | _O_NOINHERIT,
+              _S_IREAD | _S_IWRITE)},
+          _owned{true} {
+        if (_fd < 0) {
+            throw_errno(errno, "mongocxx::v1::gridfs::bucket::download_to_file: open failed");
+        }
+    }
+
+    void preallocate(std::int64_t) {}
+
+    void write_at(std::int64_t offset, std::uint8_t const* data, std::size_t length) {
+        std::lock_guard<std::mutex> const lock{_mutex};
+
+        if (::_lseeki64(_fd, offset, SEEK_SET) < 0) {
+            throw_errno(errno, "mongocxx::v1::gridfs::bucket::download_to_file: _lseeki64 failed");
+        }
+
+        while (length > 0u) {
+            auto const count = static_cast<unsigned int>(
+                std::min(length, static_cast<std::size_t>(std::numeric_limits<int>::max())));
+            auto const n = ::_write(_fd, data, count);
+
+            if (n < 0) {
+                throw_errno(errno, "mongocxx::v1::gridfs::bucket::download_to_file: _write failed");
+            }
+
+            data += n;
+            length -= static_cast<std::size_t>(n);
+        }
+    }
+};
+
+#endif // !defined(_WIN32)
+
+// Write the chunks `[first, last)` of the file identified by `id` to their offsets within `output`.
+void download_chunk_range(
+    v1::collection& chunks,
+    v1::client_session const* session_ptr,
+    bsoncxx::v1::types::view id,
+    std::int32_t first,
+    std::int32_t last,
+    std::int32_t total_chunk_count,
+    std::int64_t file_length,
+    std::int32_t chunk_size,
+    output_file& output,
+    std::atomic<bool> const& stopped) {
+    scoped_bson filter;
+    append_bson_value("files_id", id, filter);
+    filter += scoped_bson{BCON_NEW("n", "{", "$gte", BCON_INT32(first), "$lt", BCON_INT32(last), "}")};
+
+    v1::find_options opts;
+    opts.sort(scoped_bson{BCON_NEW("n", BCON_INT32(1))}.value());
+
+    auto cursor = session_ptr ? chunks.find(*session_ptr, filter.view(), opts) : chunks.find(filter.view(), opts);
+
+    auto expected_n = first;
+
+    for (auto const doc : cursor) {
+        if (stopped.load(std::memory_order_relaxed)) {
+            return;
+        }
+
+        auto const n = doc["n"];
+
+        if (!n || n.type_id() != bsoncxx::v1::types::id::k_int32 || n.get_int32().value != expected_n) {
+            std::string msg;
+
+            msg += "chunk #";
+            msg += std::to_string(expected_n);
+            msg += ": expected to find field \"n\" with k_int32 type";
+
+            throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+        }
+
+        auto const data = doc["data"];
+
+        if (!data || data.type_id() != bsoncxx::v1::types::id::k_binary) {
+            std::string msg;
+
+            msg += "chunk #";
+            msg += std::to_string(expected_n);
+            msg += ": expected to find field \"data\" with k_binary type";
+
+            throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+        }
+
+        auto const binary_data = data.get_binary();
+        auto const offset = std::int64_t{expected_n} * chunk_size;
+        auto const expected_size = expected_n < total_chunk_count - 1 ? std::int64_t{chunk_size} : file_length - offset;
+
+        if (binary_data.size != static_cast<std::uint32_t>(expected_size)) {
+            std::string msg;
+
+            msg += "chunk #";
+            msg += std::to_string(expected_n);
+            msg += ": expected size of chunk to be ";
+            msg += std::to_string(expected_size);
+            msg += " bytes, but actual size of chunk is ";
+            msg += std::to_string(binary_data.size);
+            msg += " bytes";
+
+            throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+        }
+
+        output.write_at(offset, binary_data.bytes, binary_data.size);
+
+        ++expected_n;
+    }
+
+    if (expected_n != last) {
+        std::string msg;
+
+        msg += "expected chunks #";
+        msg += std::to_string(first);
+        msg += " to #";
+        msg += std::to_string(last - 1);
+        msg += ", but query to chunks collection only returned ";
+        msg += std::to_string(expected_n - first);
+        msg += " chunk(s)";
+
+        throw v1::exception::internal::make(code::corrupt_data, msg.c_str());
+    }
+}
+
+} // namespace
+
+void bucket::internal::download_to_file_impl(
+    bucket& self,
+    v1::client_session const* session_ptr,
+    v1::pool* pool_ptr,
+    bsoncxx::v1::types::view id,
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::stdx::string_view> path_opt,
+    int fd,
+    std::size_t max_concurrency) {
+    if (max_concurrency == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_concurrency);
+    }
+
+    auto& impl = impl::with(self);
+
+    // Look up the requested file before opening the output file.
+    auto const files_doc = find_files_doc(impl._files, session_ptr, id);
+    auto const chunk_size = read_chunk_size(files_doc);
+    auto const file_length = read_file_length(files_doc);
+
+    auto const total_chunk_count = [&]() -> std::int32_t {
+        auto const count = (file_length / chunk_size) + (file_length % chunk_size > 0 ? 1 : 0);
+
+        if (count > std::numeric_limits<std::int32_t>::max()) {
+            throw v1::exception::internal::make(code::corrupt_data, "file has too many chunks");
+        }
+
+        return static_cast<std::int32_t>(count);
+    }();
+
+    auto const output_owner = path_opt ? bsoncxx::make_unique<output_file>(std::string{*path_opt})
+                                       : bsoncxx::make_unique<output_file>(fd);
+    auto& output = *output_owner;
+
+    if (total_chunk_count == 0) {
+        return;
+    }
+
+    output.preallocate(file_length);
+
+    // Acquire a client object for each additional range without waiting.
+    std::vector<v1::pool::entry> entries;
+
+    if (pool_ptr) {
+        auto const max_range_count = std::min(max_concurrency, static_cast<std::size_t>(total_chunk_count));
+
+        while (entries.size() + 1u < max_range_count) {
+            auto entry = pool_ptr->try_acquire();
+
+            if (!entry) {
+                break;
+            }
+
+            entries.push_back(std::move(*entry));
+        }
+    }
+
+    // Partition the chunks into contiguous ranges of (nearly) equal size.
+    auto const range_count = static_cast<std::int32_t>(entries.size() + 1u);
+    auto const range_first = [&](std::int32_t idx) -> std::int32_t {
+        return static_cast<std::int32_t>(std::int64_t{total_chunk_count} * idx / range_count);
+    };
+
+    std::atomic<bool> stopped{false};
+    std::vector<std::exception_ptr> errors(static_cast<std::size_t>(range_count));
+
+    auto const download_range = [&](std::int32_t idx, v1::collection& chunks, v1::client_session const* ptr) {
+        download_chunk_range(
+            chunks,
+            ptr,
+            id,
+            range_first(idx),
+            range_first(idx + 1),
+            total_chunk_count,
+            file_length,
+            chunk_size,
+            output,
+            stopped);
+    };
+
+    // Record the first exception thrown by each range and stop all other ranges.
+    auto const fail = [&](std::int32_t idx) {
+        errors[static_cast<std::size_t>(idx)] = std::current_exception();
+        stopped.store(true, std::memory_order_relaxed);
+    };
+
+    {
+        std::vector<std::thread> threads;
+
+        // Stop and join any running threads if an exception is thrown while starting them.
+        struct join_guard {
+            std::atomic<bool>& stopped;
+            std::vector<std::thread>& threads;
+
+            ~join_guard() {
+                if (!threads.empty()) {
+                    stopped.store(true, std::memory_order_relaxed);
+                }
+
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+        } const guard{stopped, threads};
+
+        if (range_count > 1) {
+            std::string const chunks_name{impl._chunks.name()};
+            auto const rc = impl._chunks.read_concern();
+            auto const rp = impl._chunks.read_preference();
+
+            threads.reserve(entries.size());
+
+            for (std::int32_t idx = 1; idx < range_count; ++idx) {
+                auto& entry = entries[static_cast<std::size_t>(idx - 1)];
+
+                threads.emplace_back([&, idx] {
+                    try {
+                        auto chunks = entry->database(impl._database_name)[chunks_name];
+
+                        chunks.read_concern(rc);
+                        chunks.read_preference(rp);
+
+                        download_range(idx, chunks, nullptr);
+                    } catch (...) {
+                        fail(idx);
+                    }
+                });
+            }
+        }
+
+        // The first range is downloaded on the calling thread by this bucket.
+        try {
+            download_range(0, impl._chunks, session_ptr);
+        } catch (...) {
+            fail(0);
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        threads.clear();
+    }
+
+    for (auto const& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 void bucket::internal::delete_file_impl(
     bucket& self,
     v1::client_session const* session_ptr,
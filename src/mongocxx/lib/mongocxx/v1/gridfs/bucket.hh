@@ -24,6 +24,7 @@
 #include <mongocxx/v1/collection-fwd.hpp>
 #include <mongocxx/v1/gridfs/downloader-fwd.hpp>
 #include <mongocxx/v1/gridfs/uploader-fwd.hpp>
+#include <mongocxx/v1/pool-fwd.hpp>
 #include <mongocxx/v1/read_concern-fwd.hpp>
 #include <mongocxx/v1/read_preference-fwd.hpp>
 #include <mongocxx/v1/write_concern-fwd.hpp>
@@ -46,8 +47,13 @@ namespace gridfs {
 
 class bucket::internal {
    public:
-    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bucket)
-    make(v1::collection files, v1::collection chunks, std::string bucket_name, std::int32_t default_chunk_size);
+    // `database_name` is only required by @ref download_to_file with a pool.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(bucket) make(
+        v1::collection files,
+        v1::collection chunks,
+        std::string bucket_name,
+        std::int32_t default_chunk_size,
+        std::string database_name = {});
 
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(std::int32_t) default_chunk_size(bucket const& self);
 
@@ -66,7 +72,8 @@ class bucket::internal {
         bsoncxx::v1::types::view id,
         bsoncxx::v1::stdx::string_view filename,
         bsoncxx::v1::stdx::optional<std::int32_t> chunk_size_bytes,
-        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata);
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata,
+        bsoncxx::v1::stdx::optional<v1::gridfs::upload_options::digest_algorithm> content_digest = {});
 
     static void upload_from_stream_with_id_impl(v1::gridfs::uploader uploader, std::istream& input);
 
@@ -83,6 +90,16 @@ class bucket::internal {
         bsoncxx::v1::stdx::optional<std::int64_t> start_opt = {},
         bsoncxx::v1::stdx::optional<std::int64_t> end_opt = {});
 
+    // Writes to the file at `*path_opt` if set, otherwise to `fd`.
+    static void download_to_file_impl(
+        bucket& self,
+        v1::client_session const* session_ptr,
+        v1::pool* pool_ptr,
+        bsoncxx::v1::types::view id,
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::stdx::string_view> path_opt,
+        int fd,
+        std::size_t max_concurrency);
+
     static void delete_file_impl(bucket& self, v1::client_session const* session_ptr, bsoncxx::v1::types::view id);
 };
 
@@ -30,11 +30,14 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <string>
 #include <system_error>
 
 #include <bsoncxx/private/immortal.hh>
+#include <bsoncxx/private/make_unique.hh>
 
+#include <mongocxx/private/sha256.hh>
 #include <mongocxx/private/utility.hh>
 
 namespace mongocxx {
@@ -91,6 +94,11 @@ class downloader::impl {
     std::size_t _chunk_data_len = {};         // Length of the current chunk data.
     std::size_t _chunk_data_offset = {};      // Offset from `chunk_buffer_ptr` to the next byte to read.
 
+    // Content digest verification state: only when the entire file is read and a SHA-256 digest is stored.
+    std::unique_ptr<sha256> _sha256;
+    std::string _expected_sha256;
+    std::int64_t _total_bytes_read = {};
+
     impl() = default;
 
     impl(
@@ -108,7 +116,74 @@ class downloader::impl {
           _initial_chunk_number{initial_chunk_number},
           _initial_byte_offset{initial_byte_offset},
           _chunks_iter{_chunks_cursor ? _chunks_cursor->begin() : v1::cursor::iterator{}},
-          _chunks_end{_chunks_cursor ? _chunks_cursor->end() : v1::cursor::iterator{}} {}
+          _chunks_end{_chunks_cursor ? _chunks_cursor->end() : v1::cursor::iterator{}} {
+        if (_initial_chunk_number != 0 || _initial_byte_offset != 0) {
+            return; // A partial download cannot be verified.
+        }
+
+        auto const metadata = _files_doc.view()["metadata"];
+
+        if (!metadata || metadata.type_id() != bsoncxx::v1::types::id::k_document) {
+            return;
+        }
+
+        auto const doc = metadata.get_document().value;
+
+        // Only verify files whose digest was written by an uploader with `content_digest` set: an arbitrary
+        // user-defined "sha256" field is not necessarily a SHA-256 digest of the file contents.
+        {
+            auto const marker = doc["contentDigest"];
+
+            if (!marker || marker.type_id() != bsoncxx::v1::types::id::k_string ||
+                marker.get_string().value != "sha256") {
+                return;
+            }
+        }
+
+        auto const digest = doc["sha256"];
+
+        if (!digest || digest.type_id() != bsoncxx::v1::types::id::k_string) {
+            return;
+        }
+
+        _sha256 = bsoncxx::make_unique<sha256>();
+        _expected_sha256 = std::string{digest.get_string().value};
+
+        // Hex digits are compared case-insensitively.
+        for (auto& c : _expected_sha256) {
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+        }
+    }
+
+    // Verify the content digest once the entire file has been read.
+    void verify(std::size_t bytes_read) {
+        if (!_sha256) {
+            return;
+        }
+
+        _total_bytes_read += static_cast<std::int64_t>(bytes_read);
+
+        if (_total_bytes_read != _file_length) {
+            return;
+        }
+
+        auto const actual = sha256::to_hex(_sha256->finish());
+
+        _sha256.reset();
+
+        if (actual != _expected_sha256) {
+            std::string msg;
+
+            msg += "expected SHA-256 digest ";
+            msg += _expected_sha256;
+            msg += ", but the SHA-256 digest of the file contents is ";
+            msg += actual;
+
+            throw v1::exception::internal::make(code::digest_mismatch, msg.c_str());
+        }
+    }
 
     static impl const& with(downloader const& other) {
         return *static_cast<impl const*>(other._impl);
@@ -184,6 +259,7 @@ std::size_t downloader::read(std::uint8_t* data, std::size_t length) {
 
     // Nothing to read.
     if (impl._file_length == 0) {
+        impl.verify(0u);
         return 0u;
     }
 
@@ -211,6 +287,10 @@ std::size_t downloader::read(std::uint8_t* data, std::size_t length) {
         auto const available_bytes = std::min(length, chunk_data_len - chunk_data_offset);
         std::memcpy(data, chunk_data_ptr + chunk_data_offset, available_bytes);
 
+        if (impl._sha256) {
+            impl._sha256->update(data, available_bytes);
+        }
+
         // Shift all iterators and increment counters for the next iteration.
         data += available_bytes;
         impl._chunk_data_offset = chunk_data_offset + available_bytes;
@@ -218,6 +298,8 @@ std::size_t downloader::read(std::uint8_t* data, std::size_t length) {
         length -= available_bytes;
     }
 
+    impl.verify(actual_bytes_read);
+
     return actual_bytes_read;
 }
 
@@ -235,6 +317,8 @@ std::error_category const& downloader::error_category() {
                     return "the GridFS file download stream is not open";
                 case code::corrupt_data:
                     return "the GridFS file is in an invalid or inconsistent state";
+                case code::digest_mismatch:
+                    return "the contents of the GridFS file do not match its stored content digest";
                 default:
                     return std::string(this->name()) + ':' + std::to_string(v);
             }
@@ -249,6 +333,7 @@ std::error_category const& downloader::error_category() {
                 switch (static_cast<code>(v)) {
                     case code::is_closed:
                     case code::corrupt_data:
+                    case code::digest_mismatch:
                         return source == condition::mongocxx;
 
                     case code::zero:
@@ -265,6 +350,7 @@ std::error_category const& downloader::error_category() {
                 switch (static_cast<code>(v)) {
                     case code::is_closed:
                     case code::corrupt_data:
+                    case code::digest_mismatch:
                         return type == condition::runtime_error;
 
                     case code::zero:
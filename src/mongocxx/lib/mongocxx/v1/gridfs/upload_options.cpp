@@ -32,6 +32,7 @@ class upload_options::impl {
    public:
     bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _metadata;
     bsoncxx::v1::stdx::optional<std::int32_t> _chunk_size_bytes;
+    bsoncxx::v1::stdx::optional<digest_algorithm> _content_digest;
 
     static impl const& with(upload_options const& other) {
         return *static_cast<impl const*>(other._impl);
@@ -102,6 +103,15 @@ bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> upload_options::metadat
     return impl::with(this)->_metadata;
 }
 
+upload_options& upload_options::content_digest(digest_algorithm v) {
+    impl::with(this)->_content_digest = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<upload_options::digest_algorithm> upload_options::content_digest() const {
+    return impl::with(this)->_content_digest;
+}
+
 bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> const& upload_options::internal::metadata(
     upload_options const& self) {
     return impl::with(self)._metadata;
@@ -17,12 +17,14 @@
 //
 
 #include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/oid.hpp>
 #include <bsoncxx/v1/stdx/optional.hpp>
 #include <bsoncxx/v1/types/view.hpp>
 
 #include <mongocxx/v1/client_session.hpp>
 #include <mongocxx/v1/collection.hpp>
 #include <mongocxx/v1/delete_many_result.hpp> // IWYU pragma: keep
+#include <mongocxx/v1/insert_many_options.hpp>
 #include <mongocxx/v1/insert_one_result.hpp>  // IWYU pragma: keep
 
 #include <bsoncxx/v1/types/value.hh>
@@ -47,6 +49,7 @@
 #include <bsoncxx/private/make_unique.hh>
 
 #include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/sha256.hh>
 #include <mongocxx/private/utility.hh>
 
 namespace mongocxx {
@@ -55,6 +58,17 @@ namespace gridfs {
 
 using code = v1::gridfs::uploader::errc;
 
+namespace {
+
+std::size_t saved_chunks_limit(std::int32_t chunk_size) {
+    // 16 * 1000 * 1000 (16 MB) for approximate consistency with the 16 MiB BSON document limit, but slightly less for
+    // historical reasons (OP_MSG body size limit).
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
+    return 16u * 1000u * 1000u / static_cast<std::size_t>(chunk_size);
+}
+
+} // namespace
+
 class uploader::impl {
    public:
     v1::collection _files;                             // Collection to write the files document to.
@@ -64,6 +78,7 @@ class uploader::impl {
     bsoncxx::v1::types::value _id;                     // The ID of the file being written.
     std::string _filename;                             // The name of the file being written.
     bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _metadata; // Optional user-provided metadata.
+    std::unique_ptr<sha256> _sha256; // Set when computing a SHA-256 content digest.
 
     //  NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays): fixed-size dynamic array: size tracked by `_chunk_size`.
     std::unique_ptr<std::uint8_t[]> _chunk_data;
@@ -80,17 +95,53 @@ class uploader::impl {
         std::string filename,
         bsoncxx::v1::types::value id,
         std::int32_t chunk_size,
-        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> metadata)
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> metadata,
+        bsoncxx::v1::stdx::optional<v1::gridfs::upload_options::digest_algorithm> content_digest)
         : _files{std::move(files)},
           _chunks{std::move(chunks)},
           _session_ptr{session_ptr},
           _id{std::move(id)},
           _filename{std::move(filename)},
           _metadata{std::move(metadata)},
+          _sha256{
+              content_digest == v1::gridfs::upload_options::digest_algorithm::k_sha256
+                  ? bsoncxx::make_unique<sha256>()
+                  : nullptr},
           //  NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays): fixed-size dynamic array: size tracked by `_chunk_size`.
           _chunk_data{bsoncxx::make_unique<std::uint8_t[]>(static_cast<std::size_t>(chunk_size))},
           _chunk_size{chunk_size} {}
 
+    // Save `length` bytes of `data` as the next chunk. Returns true when the buffer of chunks should be flushed.
+    //
+    // `data` is copied exactly once, directly into the chunk document. The chunk document is given an "_id" field such
+    // that it is not copied again to generate one when inserted.
+    bool save_chunk(std::uint8_t const* data, std::int32_t length) {
+        // Already stored INT32_MAX chunks: next chunk number would overflow.
+        if (_next_chunk_number == std::numeric_limits<std::int32_t>::max()) {
+            throw v1::exception::internal::make(code::too_many_chunks);
+        }
+
+        bsoncxx::v1::oid oid;
+        bson_oid_t bson_oid = {};
+        std::memcpy(bson_oid.bytes, oid.bytes(), oid.size());
+
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers): headroom for every field other than "data".
+        bson_t* const doc = bson_sized_new(static_cast<std::size_t>(length) + 128u);
+
+        if (!BSON_APPEND_OID(doc, "_id", &bson_oid) ||
+            !BSON_APPEND_VALUE(doc, "files_id", &bsoncxx::v1::types::value::internal::get_bson_value(_id)) ||
+            !BSON_APPEND_INT32(doc, "n", _next_chunk_number) ||
+            !BSON_APPEND_BINARY(doc, "data", BSON_SUBTYPE_BINARY, data, static_cast<std::uint32_t>(length))) {
+            bson_destroy(doc);
+            throw std::logic_error{"mongocxx::v1::gridfs::uploader::save_chunk: BSON_APPEND failed"};
+        }
+
+        _buffer.push_back(scoped_bson{doc}.value());
+        ++_next_chunk_number;
+
+        return _buffer.size() >= saved_chunks_limit(_chunk_size);
+    }
+
     static impl const& with(uploader const& other) {
         return *static_cast<impl const*>(other._impl);
     }
@@ -181,7 +232,26 @@ v1::gridfs::upload_result uploader::close() {
         BCON_DATE_TIME(std::int64_t{bsoncxx::v1::types::b_date{std::chrono::system_clock::now()}.value.count()}))};
     files_doc += scoped_bson{BCON_NEW("filename", BCON_UTF8(impl._filename.c_str()))};
 
-    if (auto const& opt = impl._metadata) {
+    if (impl._sha256) {
+        auto const digest = sha256::to_hex(impl._sha256->finish());
+
+        bson_t* const doc = bson_new();
+
+        // Replace any user-provided fields with the same names. The "contentDigest" field marks "sha256" as written
+        // by this feature so that the downloader does not verify unrelated user-defined fields.
+        if (auto const& opt = impl._metadata) {
+            bson_copy_to_excluding_noinit(scoped_bson_view{*opt}.bson(), doc, "sha256", "contentDigest", nullptr);
+        }
+
+        if (!BSON_APPEND_UTF8(doc, "sha256", digest.c_str()) || !BSON_APPEND_UTF8(doc, "contentDigest", "sha256")) {
+            bson_destroy(doc);
+            throw std::logic_error{"mongocxx::v1::gridfs::uploader::close: BSON_APPEND_UTF8 failed"};
+        }
+
+        scoped_bson const metadata{doc};
+
+        files_doc += scoped_bson{BCON_NEW("metadata", BCON_DOCUMENT(metadata.bson()))};
+    } else if (auto const& opt = impl._metadata) {
         files_doc += scoped_bson{BCON_NEW("metadata", BCON_DOCUMENT(scoped_bson_view{*opt}.bson()))};
     }
 
@@ -233,6 +303,10 @@ void uploader::write(std::uint8_t const* data, std::size_t length) {
         return;
     }
 
+    if (impl._sha256) {
+        impl._sha256->update(data, length);
+    }
+
     auto const chunk_data = impl._chunk_data.get();
     auto const chunk_size = impl._chunk_size;
 
@@ -244,6 +318,19 @@ void uploader::write(std::uint8_t const* data, std::size_t length) {
         // When no more bytes are available in the current chunk, save the current chunk and prepare the next.
         if (bytes_remaining <= 0) {
             this->save_chunk();
+            continue;
+        }
+
+        // When the current chunk is empty, save whole chunks directly from `data` instead of copying them into the
+        // current chunk first. The final chunk is always copied, as it may be continued by a subsequent write.
+        if (byte_offset == 0 && length > static_cast<std::size_t>(chunk_size)) {
+            if (impl.save_chunk(data, chunk_size)) {
+                this->flush();
+            }
+
+            data += chunk_size;
+            length -= static_cast<std::size_t>(chunk_size);
+            continue;
         }
 
         // Write the next set of available bytes.
@@ -267,10 +354,13 @@ void uploader::flush() {
     auto& chunks = impl._chunks;
     auto& buffer = impl._buffer;
 
+    // The IDs of the chunk documents are not needed.
+    auto const opts = v1::insert_many_options{}.report_ids(v1::insert_many_options::id_mode::k_none);
+
     if (auto const session_ptr = impl._session_ptr) {
-        chunks.insert_many(*session_ptr, buffer);
+        chunks.insert_many(*session_ptr, buffer, opts);
     } else {
-        chunks.insert_many(buffer);
+        chunks.insert_many(buffer, opts);
     }
 
     buffer.clear();
@@ -339,17 +429,6 @@ std::error_category const& uploader::error_category() {
 
 uploader::uploader(void* impl) : _impl{impl} {}
 
-namespace {
-
-std::size_t saved_chunks_limit(std::int32_t chunk_size) {
-    // 16 * 1000 * 1000 (16 MB) for approximate consistency with the 16 MiB BSON document limit, but slightly less for
-    // historical reasons (OP_MSG body size limit).
-    // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers)
-    return 16u * 1000u * 1000u / static_cast<std::size_t>(chunk_size);
-}
-
-} // namespace
-
 void uploader::save_chunk() {
     auto& impl = *impl::with(this);
 
@@ -360,29 +439,12 @@ void uploader::save_chunk() {
         return;
     }
 
-    auto const next_chunk_number = impl._next_chunk_number;
-
-    // Already stored INT32_MAX chunks: next chunk number would overflow.
-    if (next_chunk_number == std::numeric_limits<std::int32_t>::max()) {
-        throw v1::exception::internal::make(code::too_many_chunks);
-    }
-
-    scoped_bson chunk_doc;
-
-    append_bson_value("files_id", impl._id, chunk_doc);
-    chunk_doc += scoped_bson{BCON_NEW("n", BCON_INT32(next_chunk_number))};
-    chunk_doc += scoped_bson{BCON_NEW(
-        "data", BCON_BIN(BSON_SUBTYPE_BINARY, impl._chunk_data.get(), static_cast<std::uint32_t>(bytes_written)))};
-
-    auto& buffer = impl._buffer;
-
     // Save chunk into an internal chunk buffer...
-    buffer.push_back(std::move(chunk_doc).value());
-    ++impl._next_chunk_number;
+    auto const should_flush = impl.save_chunk(impl._chunk_data.get(), bytes_written);
     impl._bytes_written = 0;
 
     // ... and flush (insert) the chunks in bulk to reduce the number of commands.
-    if (buffer.size() >= saved_chunks_limit(impl._chunk_size)) {
+    if (should_flush) {
         this->flush();
     }
 }
@@ -394,7 +456,8 @@ uploader uploader::internal::make(
     std::string filename,
     bsoncxx::v1::types::value id,
     std::int32_t chunk_size,
-    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata) {
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata,
+    bsoncxx::v1::stdx::optional<v1::gridfs::upload_options::digest_algorithm> content_digest) {
     bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> metadata_owner;
 
     if (metadata) {
@@ -408,7 +471,8 @@ uploader uploader::internal::make(
         std::move(filename),
         std::move(id),
         chunk_size,
-        std::move(metadata_owner)}};
+        std::move(metadata_owner),
+        content_digest}};
 }
 
 } // namespace gridfs
@@ -26,6 +26,8 @@
 
 #include <bsoncxx/v1/stdx/optional.hpp>
 
+#include <mongocxx/v1/gridfs/upload_options.hpp>
+
 #include <cstdint>
 #include <string>
 
@@ -44,7 +46,8 @@ class uploader::internal {
         std::string filename,
         bsoncxx::v1::types::value id,
         std::int32_t chunk_size,
-        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata);
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> metadata,
+        bsoncxx::v1::stdx::optional<v1::gridfs::upload_options::digest_algorithm> content_digest = {});
 };
 
 } // namespace gridfs
@@ -36,6 +36,7 @@ class insert_many_options::impl {
     bsoncxx::v1::stdx::optional<v1::write_concern> _write_concern;
     bsoncxx::v1::stdx::optional<bool> _ordered;
     bsoncxx::v1::stdx::optional<bsoncxx::v1::types::value> _comment;
+    bsoncxx::v1::stdx::optional<id_mode> _report_ids;
 
     static impl const& with(insert_many_options const& self) {
         return *static_cast<impl const*>(self._impl);
@@ -134,6 +135,15 @@ bsoncxx::v1::stdx::optional<bsoncxx::v1::types::view> insert_many_options::comme
     return impl::with(this)->_comment;
 }
 
+insert_many_options& insert_many_options::report_ids(id_mode v) {
+    impl::with(this)->_report_ids = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<insert_many_options::id_mode> insert_many_options::report_ids() const {
+    return impl::with(this)->_report_ids;
+}
+
 bsoncxx::v1::stdx::optional<v1::read_concern> const& insert_many_options::internal::read_concern(
     insert_many_options const& self) {
     return impl::with(self)._read_concern;
@@ -71,10 +71,15 @@ class insert_many_result::impl {
     }
 
    private:
+    // The keys of `_inserted_ids` are operation indexes, which need not be contiguous (e.g. when only generated IDs
+    // are reported).
     void sync_id_map() {
-        std::int64_t idx = 0;
         for (auto const e : _inserted_ids) {
-            _id_map.emplace(idx++, e.type_view());
+            std::int64_t idx = 0;
+            for (auto const c : e.key()) {
+                idx = idx * 10 + (c - '0');
+            }
+            _id_map.emplace(idx, e.type_view());
         }
     }
 };
@@ -0,0 +1,574 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/parallel_change_stream.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+
+#include <mongocxx/v1/exception.hh>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = parallel_change_stream::errc;
+
+namespace {
+
+constexpr std::size_t default_queue_size = 1024u;
+
+std::size_t default_partition_count() {
+    auto const n = std::thread::hardware_concurrency();
+    return n > 0u ? std::size_t{n} : std::size_t{1};
+}
+
+bool is_invalidate(bsoncxx::v1::document::view event) {
+    auto const e = event["operationType"];
+    return e && e.type_id() == bsoncxx::v1::types::id::k_string && e.get_string().value == "invalidate";
+}
+
+struct queued_event {
+    std::uint64_t seq;
+    bsoncxx::v1::document::value doc;
+};
+
+// The events of a partition waiting to be processed by its thread.
+struct partition_queue {
+    std::deque<queued_event> events;
+    std::condition_variable not_empty;
+};
+
+// An event which has been obtained from the change stream but whose processing may not be complete yet.
+struct pending_event {
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> token;
+    bool done;
+};
+
+} // namespace
+
+class parallel_change_stream::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<std::size_t> _partition_count;
+    bsoncxx::v1::stdx::optional<std::size_t> _queue_size;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class parallel_change_stream::impl {
+   public:
+    v1::change_stream* _stream;
+    std::size_t _queue_size;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _not_full; // Signaled when an event is popped or processed.
+
+    std::vector<std::unique_ptr<partition_queue>> _queues;
+
+    // Ordered by the sequence number assigned when obtained from the change stream.
+    std::map<std::uint64_t, pending_event> _pending;
+    std::uint64_t _next_seq = 0u;
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _resume_token;
+
+    bool _stopping = false; // Stop obtaining events, but process the queued events.
+    bool _closed = false;   // No more events will be queued.
+    std::exception_ptr _error;
+
+    impl(v1::change_stream& stream, std::size_t partition_count, std::size_t queue_size)
+        : _stream{&stream}, _queue_size{queue_size} {
+        _queues.reserve(partition_count);
+
+        for (std::size_t i = 0u; i < partition_count; ++i) {
+            _queues.push_back(std::unique_ptr<partition_queue>{new partition_queue{}});
+        }
+    }
+
+    std::size_t partition_of(bsoncxx::v1::document::view key) const {
+        return std::hash<bsoncxx::v1::document::view>{}(key) % _queues.size();
+    }
+
+    // Requires `_mutex` to be locked.
+    bool should_stop() const {
+        return _stopping || _error;
+    }
+
+    void fail(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (!_error) {
+                _error = std::move(error);
+            }
+        }
+
+        this->wake_all();
+    }
+
+    void wake_all() {
+        _not_full.notify_all();
+
+        for (auto const& q : _queues) {
+            q->not_empty.notify_all();
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+
+        this->wake_all();
+    }
+
+    // Queue `event` for processing by the thread of `partition`. Returns false if stopped before it could be queued.
+    bool push(std::size_t partition, bsoncxx::v1::document::view event) {
+        auto& q = *_queues[partition];
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _not_full.wait(lock, [&] { return this->should_stop() || q.events.size() < _queue_size; });
+
+            if (this->should_stop()) {
+                return false;
+            }
+
+            auto const seq = _next_seq++;
+
+            pending_event pending{{}, false};
+
+            if (auto const e = event["_id"]) {
+                if (e.type_id() == bsoncxx::v1::types::id::k_document) {
+                    pending.token.emplace(e.get_document().value);
+                }
+            }
+
+            _pending.emplace(seq, std::move(pending));
+            q.events.push_back(queued_event{seq, bsoncxx::v1::document::value{event}});
+        }
+
+        q.not_empty.notify_one();
+
+        return true;
+    }
+
+    // Block until every queued event has been processed. Returns false if an error occurred.
+    bool wait_idle() {
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        _not_full.wait(lock, [&] { return _error || _pending.empty(); });
+
+        return !_error;
+    }
+
+    // Advance the resume token past every leading processed event.
+    void complete(std::uint64_t seq) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            _pending[seq].done = true;
+
+            while (!_pending.empty() && _pending.begin()->second.done) {
+                auto& token = _pending.begin()->second.token;
+
+                if (token) {
+                    _resume_token = std::move(token);
+                }
+
+                _pending.erase(_pending.begin());
+            }
+        }
+
+        _not_full.notify_all();
+    }
+
+    // When idle, every event obtained from the change stream has been processed: the resume token of the change
+    // stream (e.g. the post-batch resume token) may be used instead.
+    void on_idle() {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        if (_pending.empty()) {
+            if (auto const token = _stream->get_resume_token()) {
+                if (!token->empty()) {
+                    _resume_token.emplace(*token);
+                }
+            }
+        }
+    }
+
+    void process(std::size_t partition, callback_type const& fn) {
+        auto& q = *_queues[partition];
+
+        for (;;) {
+            queued_event event{0u, bsoncxx::v1::document::value{}};
+
+            {
+                std::unique_lock<std::mutex> lock{_mutex};
+
+                q.not_empty.wait(lock, [&] { return _error || _closed || !q.events.empty(); });
+
+                if (_error || q.events.empty()) {
+                    return;
+                }
+
+                event = std::move(q.events.front());
+                q.events.pop_front();
+            }
+
+            _not_full.notify_all();
+
+            fn(partition, event.doc.view());
+
+            this->complete(event.seq);
+        }
+    }
+
+    // Obtain events from the change stream and queue them until stopped or invalidated.
+    void dispatch() {
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+
+                if (this->should_stop()) {
+                    return;
+                }
+            }
+
+            auto const event = _stream->try_next();
+
+            if (!event) {
+                this->on_idle();
+                continue;
+            }
+
+            auto const key = (*event)["documentKey"];
+
+            if (key && key.type_id() == bsoncxx::v1::types::id::k_document) {
+                if (!this->push(this->partition_of(key.get_document().value), *event)) {
+                    return;
+                }
+
+                continue;
+            }
+
+            // Events without a document key are processed in isolation by the first partition.
+            if (!this->wait_idle() || !this->push(0u, *event) || !this->wait_idle()) {
+                return;
+            }
+
+            if (is_invalidate(*event)) {
+                return;
+            }
+        }
+    }
+
+    void run(callback_type const& fn) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            _closed = false;
+            _error = nullptr;
+        }
+
+        std::vector<std::thread> threads;
+
+        try {
+            threads.reserve(_queues.size());
+
+            for (std::size_t i = 0u; i < _queues.size(); ++i) {
+                threads.emplace_back([this, &fn, i] {
+                    try {
+                        this->process(i, fn);
+                    } catch (...) {
+                        this->fail(std::current_exception());
+                    }
+                });
+            }
+
+            this->dispatch();
+        } catch (...) {
+            this->fail(std::current_exception());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _closed = true;
+        }
+
+        this->wake_all();
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        std::exception_ptr error;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            // Events which were not processed are discarded. Their resume tokens are never reported.
+            for (auto const& q : _queues) {
+                q->events.clear();
+            }
+
+            _pending.clear();
+            _stopping = false;
+
+            error = exchange(_error, nullptr);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    static impl const& with(parallel_change_stream const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(parallel_change_stream const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(parallel_change_stream& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(parallel_change_stream* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+parallel_change_stream::~parallel_change_stream() {
+    delete impl::with(this);
+}
+
+parallel_change_stream::parallel_change_stream(parallel_change_stream&& other) noexcept
+    : _impl{exchange(other._impl, nullptr)} {}
+
+parallel_change_stream& parallel_change_stream::operator=(parallel_change_stream&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+parallel_change_stream::parallel_change_stream(v1::change_stream& stream, options const& opts) : _impl{nullptr} {
+    auto const partition_count = opts.partition_count().value_or(default_partition_count());
+    auto const queue_size = opts.queue_size().value_or(default_queue_size);
+
+    if (partition_count == 0u) {
+        throw v1::exception::internal::make(code::invalid_partition_count);
+    }
+
+    if (queue_size == 0u) {
+        throw v1::exception::internal::make(code::invalid_queue_size);
+    }
+
+    _impl = new impl{stream, partition_count, queue_size};
+}
+
+parallel_change_stream::parallel_change_stream(v1::change_stream& stream)
+    : parallel_change_stream{stream, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+parallel_change_stream::operator bool() const {
+    return _impl != nullptr;
+}
+
+std::size_t parallel_change_stream::partition_count() const {
+    return impl::with(this)->_queues.size();
+}
+
+void parallel_change_stream::run(callback_type const& fn) {
+    impl::with(this)->run(fn);
+}
+
+void parallel_change_stream::stop() {
+    impl::with(this)->stop();
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> parallel_change_stream::resume_token() const {
+    auto const& self = impl::with(*this);
+
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._resume_token;
+}
+
+std::error_category const& parallel_change_stream::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::parallel_change_stream";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_partition_count:
+                    return "the partition count must be greater than zero";
+                case code::invalid_queue_size:
+                    return "the queue size must be greater than zero";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_partition_count:
+                    case code::invalid_queue_size:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_partition_count:
+                    case code::invalid_queue_size:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+parallel_change_stream::options::~options() {
+    delete impl::with(_impl);
+}
+
+parallel_change_stream::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+parallel_change_stream::options& parallel_change_stream::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+parallel_change_stream::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+parallel_change_stream::options& parallel_change_stream::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+parallel_change_stream::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+parallel_change_stream::options& parallel_change_stream::options::partition_count(std::size_t v) {
+    impl::with(this)->_partition_count = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> parallel_change_stream::options::partition_count() const {
+    return impl::with(this)->_partition_count;
+}
+
+parallel_change_stream::options& parallel_change_stream::options::queue_size(std::size_t v) {
+    impl::with(this)->_queue_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> parallel_change_stream::options::queue_size() const {
+    return impl::with(this)->_queue_size;
+}
+
+} // namespace v1
+} // namespace mongocxx
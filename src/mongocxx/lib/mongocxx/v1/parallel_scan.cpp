@@ -0,0 +1,922 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/parallel_scan.hh>
+
+//
+
+#include <bsoncxx/v1/array/value.hpp>
+#include <bsoncxx/v1/array/view.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/cursor.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/find_options.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+#include <mongocxx/v1/pool.hpp>
+
+#include <bsoncxx/v1/types/value.hh>
+
+#include <mongocxx/v1/exception.hh>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = parallel_scan::errc;
+
+namespace {
+
+constexpr std::size_t default_buffer_size = 1024u;
+constexpr std::size_t default_samples_per_partition = 32u;
+
+std::size_t default_partition_count() {
+    auto const n = std::thread::hardware_concurrency();
+    return n > 0u ? std::size_t{n} : std::size_t{1};
+}
+
+std::int32_t default_sample_size(std::size_t partition_count) {
+    auto const max = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+
+    return partition_count > max / default_samples_per_partition
+               ? std::numeric_limits<std::int32_t>::max()
+               : static_cast<std::int32_t>(partition_count * default_samples_per_partition);
+}
+
+// Choose `count - 1` split points from the ascending sampled values `samples`. Only values with the same BSON type as
+// the median sample are considered. Duplicate split points are omitted.
+std::vector<bsoncxx::v1::types::value> choose_boundaries(
+    std::vector<bsoncxx::v1::types::value> const& samples,
+    std::size_t count) {
+    std::vector<bsoncxx::v1::types::value> ret;
+
+    if (samples.empty()) {
+        return ret;
+    }
+
+    auto const type = samples[samples.size() / 2u].type_id();
+
+    for (std::size_t i = 1u; i < count; ++i) {
+        auto const& v = samples[i * samples.size() / count];
+
+        if (v.type_id() != type) {
+            continue;
+        }
+
+        if (!ret.empty() && ret.back() == v) {
+            continue;
+        }
+
+        ret.push_back(v);
+    }
+
+    return ret;
+}
+
+// Append `{<key>: {<op>: <v>, ...}}` for each (op, v) in `ops`.
+void append_range(
+    bson_t* doc,
+    bsoncxx::v1::stdx::string_view key,
+    std::initializer_list<std::pair<char const*, bsoncxx::v1::types::value const*>> ops) {
+    bson_t range;
+
+    bson_append_document_begin(doc, key.data(), static_cast<int>(key.size()), &range);
+
+    for (auto const& op : ops) {
+        BSON_APPEND_VALUE(&range, op.first, &bsoncxx::v1::types::value::internal::get_bson_value(*op.second));
+    }
+
+    bson_append_document_end(doc, &range);
+}
+
+// Append `{$not: {$type: "array"}}` to the range condition `cond`.
+void append_not_array(bson_t* cond) {
+    bson_t not_array;
+
+    BSON_APPEND_DOCUMENT_BEGIN(cond, "$not", &not_array);
+    BSON_APPEND_UTF8(&not_array, "$type", "array");
+    bson_append_document_end(cond, &not_array);
+}
+
+// Append `{key: {<op>: <v>, ..., $not: {$type: "array"}}}` for each (op, v) in `ops`.
+void append_scalar_range(
+    bson_t* doc,
+    bsoncxx::v1::stdx::string_view key,
+    std::initializer_list<std::pair<char const*, bsoncxx::v1::types::value const*>> ops) {
+    bson_t range;
+
+    bson_append_document_begin(doc, key.data(), static_cast<int>(key.size()), &range);
+
+    for (auto const& op : ops) {
+        BSON_APPEND_VALUE(&range, op.first, &bsoncxx::v1::types::value::internal::get_bson_value(*op.second));
+    }
+
+    append_not_array(&range);
+
+    bson_append_document_end(doc, &range);
+}
+
+// Invoke `fn` with each proper prefix of the (possibly dotted) path `key`, e.g. "a" and "a.b" for "a.b.c".
+template <typename Fn>
+void for_each_prefix(bsoncxx::v1::stdx::string_view key, Fn fn) {
+    for (auto pos = key.find('.'); pos != bsoncxx::v1::stdx::string_view::npos; pos = key.find('.', pos + 1u)) {
+        if (pos > 0u) {
+            fn(key.substr(0u, pos));
+        }
+    }
+}
+
+// Append `{<path>: {$type: "array"}}` as the embedded document `name`.
+void append_is_array(bson_t* doc, char const* name, bsoncxx::v1::stdx::string_view path) {
+    bson_t is_array;
+    bson_t type;
+
+    bson_append_document_begin(doc, name, -1, &is_array);
+    bson_append_document_begin(&is_array, path.data(), static_cast<int>(path.size()), &type);
+    BSON_APPEND_UTF8(&type, "$type", "array");
+    bson_append_document_end(&is_array, &type);
+    bson_append_document_end(doc, &is_array);
+}
+
+// The partitions are delimited such that every document is matched by exactly one partition:
+//
+//   - first: `{$or: [{key: {$not: {$gte: b[0]}}}, {key: {$type: "array"}}, {p: {$type: "array"}}, ...]}`
+//   - i:     `{key: {$gte: b[i - 1], $lt: b[i], $not: {$type: "array"}}, p: {$not: {$type: "array"}}, ...}`
+//   - last:  `{key: {$gte: b[n - 1], $not: {$type: "array"}}, p: {$not: {$type: "array"}}, ...}`
+//
+// where `p` is each proper prefix of a dotted key (e.g. "a" for "a.b").
+//
+// Comparison query operators only match values in the same BSON type bracket as the operand, so the union of all but
+// the first partition is exactly the complement of the first partition. The first partition also includes values of
+// a different BSON type and missing values.
+//
+// Each comparison of a range may be satisfied by a different element of an array-valued key, or by a different
+// embedded document when the path of the key traverses an array (e.g. "a.b" where "a" is an array), so such a key
+// could match more than one range: these documents are always delivered by the first partition instead.
+bsoncxx::v1::document::value make_range(
+    bsoncxx::v1::stdx::string_view key,
+    std::vector<bsoncxx::v1::types::value> const& boundaries,
+    std::size_t idx) {
+    bson_t* const doc = bson_new();
+
+    if (idx == 0u) {
+        bson_t conds;
+        bson_t below;
+        bson_t cond;
+
+        BSON_APPEND_ARRAY_BEGIN(doc, "$or", &conds);
+
+        BSON_APPEND_DOCUMENT_BEGIN(&conds, "0", &below);
+        bson_append_document_begin(&below, key.data(), static_cast<int>(key.size()), &cond);
+        append_range(&cond, "$not", {{"$gte", &boundaries.front()}});
+        bson_append_document_end(&below, &cond);
+        bson_append_document_end(&conds, &below);
+
+        append_is_array(&conds, "1", key);
+
+        std::size_t count = 2u;
+
+        for_each_prefix(key, [&](bsoncxx::v1::stdx::string_view prefix) {
+            append_is_array(&conds, std::to_string(count++).c_str(), prefix);
+        });
+
+        bson_append_array_end(doc, &conds);
+    } else {
+        if (idx == boundaries.size()) {
+            append_scalar_range(doc, key, {{"$gte", &boundaries.back()}});
+        } else {
+            append_scalar_range(doc, key, {{"$gte", &boundaries[idx - 1u]}, {"$lt", &boundaries[idx]}});
+        }
+
+        for_each_prefix(key, [&](bsoncxx::v1::stdx::string_view prefix) {
+            bson_t cond;
+
+            bson_append_document_begin(doc, prefix.data(), static_cast<int>(prefix.size()), &cond);
+            append_not_array(&cond);
+            bson_append_document_end(doc, &cond);
+        });
+    }
+
+    return scoped_bson{doc}.value();
+}
+
+template <typename T>
+int cmp(T const& lhs, T const& rhs) {
+    return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+}
+
+// Compare two user-provided split points with the same BSON type according to the server's sort order.
+//
+// Throws `invalid_boundaries` for BSON types whose sort order is not supported.
+int compare_boundaries(bsoncxx::v1::types::view lhs, bsoncxx::v1::types::view rhs) {
+    switch (lhs.type_id()) {
+        case bsoncxx::v1::types::id::k_double:
+            return cmp(lhs.get_double().value, rhs.get_double().value);
+
+        case bsoncxx::v1::types::id::k_string:
+            return cmp(lhs.get_string().value, rhs.get_string().value);
+
+        case bsoncxx::v1::types::id::k_oid:
+            return cmp(lhs.get_oid().value, rhs.get_oid().value);
+
+        case bsoncxx::v1::types::id::k_bool:
+            return cmp(lhs.get_bool().value, rhs.get_bool().value);
+
+        case bsoncxx::v1::types::id::k_date:
+            return cmp(lhs.get_date().value, rhs.get_date().value);
+
+        case bsoncxx::v1::types::id::k_int32:
+            return cmp(lhs.get_int32().value, rhs.get_int32().value);
+
+        case bsoncxx::v1::types::id::k_timestamp: {
+            auto const l = lhs.get_timestamp();
+            auto const r = rhs.get_timestamp();
+            auto const res = cmp(l.timestamp, r.timestamp);
+            return res != 0 ? res : cmp(l.increment, r.increment);
+        }
+
+        case bsoncxx::v1::types::id::k_int64:
+            return cmp(lhs.get_int64().value, rhs.get_int64().value);
+
+        default:
+            throw v1::exception::internal::make(code::invalid_boundaries);
+    }
+}
+
+// The documents scanned by all partitions waiting to be delivered to the current thread.
+class merge_queue {
+   private:
+    std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::deque<bsoncxx::v1::document::value> _docs;
+    std::size_t _capacity;
+    std::size_t _producers;
+    bool _aborted = false;
+
+   public:
+    merge_queue(std::size_t capacity, std::size_t producers) : _capacity{capacity}, _producers{producers} {}
+
+    void push(bsoncxx::v1::document::view doc) {
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _not_full.wait(lock, [&] { return _aborted || _docs.size() < _capacity; });
+
+            if (_aborted) {
+                return;
+            }
+
+            _docs.emplace_back(doc);
+        }
+
+        _not_empty.notify_one();
+    }
+
+    // Called by each producer once it has pushed all of its documents.
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            --_producers;
+        }
+
+        _not_empty.notify_all();
+    }
+
+    void abort() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _aborted = true;
+        }
+
+        _not_empty.notify_all();
+        _not_full.notify_all();
+    }
+
+    // Empty when all producers are closed and all documents have been popped, or when aborted.
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> pop() {
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> ret;
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _not_empty.wait(lock, [&] { return _aborted || !_docs.empty() || _producers == 0u; });
+
+            if (_aborted || _docs.empty()) {
+                return ret;
+            }
+
+            ret.emplace(std::move(_docs.front()));
+            _docs.pop_front();
+        }
+
+        _not_full.notify_one();
+
+        return ret;
+    }
+};
+
+// One thread per partition. The first exception thrown by any thread (or the current thread) is recorded and stops
+// all other threads.
+class scan {
+   private:
+    std::atomic<bool> _stopped{false};
+    std::mutex _mutex;
+    std::exception_ptr _error;
+    std::vector<std::thread> _threads;
+    std::function<void()> _on_stop;
+
+   public:
+    ~scan() {
+        this->stop();
+        this->join();
+    }
+
+    scan(scan&& other) noexcept = delete;
+    scan& operator=(scan&& other) noexcept = delete;
+    scan(scan const& other) = delete;
+    scan& operator=(scan const& other) = delete;
+
+    explicit scan(std::function<void()> on_stop) : _on_stop{std::move(on_stop)} {}
+
+    bool stopped() const {
+        return _stopped.load(std::memory_order_relaxed);
+    }
+
+    void stop() {
+        _stopped.store(true, std::memory_order_relaxed);
+
+        if (_on_stop) {
+            _on_stop();
+        }
+    }
+
+    void fail(std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+
+            if (!_error) {
+                _error = std::move(error);
+            }
+        }
+
+        this->stop();
+    }
+
+    void spawn(std::function<void()> fn) {
+        _threads.emplace_back([this, fn] {
+            try {
+                fn();
+            } catch (...) {
+                this->fail(std::current_exception());
+            }
+        });
+    }
+
+    void join() {
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+
+        _threads.clear();
+    }
+
+    void rethrow() {
+        if (_error) {
+            std::rethrow_exception(_error);
+        }
+    }
+};
+
+} // namespace
+
+class parallel_scan::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::array::value> _boundaries;
+    bsoncxx::v1::stdx::optional<std::size_t> _buffer_size;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _filter;
+    bsoncxx::v1::stdx::optional<v1::find_options> _find_options;
+    bsoncxx::v1::stdx::optional<std::string> _key;
+    bsoncxx::v1::stdx::optional<std::size_t> _partition_count;
+    bsoncxx::v1::stdx::optional<std::int32_t> _sample_size;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class parallel_scan::impl {
+   public:
+    v1::pool* _pool;
+    std::string _db_name;
+    std::string _coll_name;
+    std::string _key;
+    bsoncxx::v1::document::value _filter;
+    v1::find_options _find_opts;
+    std::size_t _partition_count;
+    std::int32_t _sample_size;
+    std::size_t _buffer_size;
+    bsoncxx::v1::stdx::optional<std::vector<bsoncxx::v1::types::value>> _boundaries;
+
+    std::vector<bsoncxx::v1::types::value> sample_boundaries() const {
+        auto entry = _pool->acquire();
+        auto coll = entry->database(_db_name)[_coll_name];
+
+        scoped_bson project;
+        {
+            auto const path = '$' + _key;
+
+            BSON_APPEND_INT32(project.inout_ptr(), "_id", 0);
+            BSON_APPEND_UTF8(project.inout_ptr(), "k", path.c_str());
+        }
+
+        v1::pipeline pipeline;
+        pipeline.sample(_sample_size).project(project.view()).sort(scoped_bson{R"({"k": 1})"}.view());
+
+        std::vector<bsoncxx::v1::types::value> samples;
+
+        for (auto const& doc : coll.aggregate(pipeline)) {
+            // Documents without the partition key are delivered by the first partition.
+            if (auto const e = doc["k"]) {
+                samples.push_back(e.type_value());
+            }
+        }
+
+        return choose_boundaries(samples, _partition_count);
+    }
+
+    std::vector<bsoncxx::v1::document::value> partition_filters() const {
+        return parallel_scan::internal::make_filters(
+            _filter.view(), _key, _boundaries ? *_boundaries : this->sample_boundaries());
+    }
+
+    void scan_partition(
+        std::size_t idx,
+        bsoncxx::v1::document::view filter,
+        partition_callback_type const& fn,
+        scan const& s) const {
+        auto entry = _pool->acquire();
+        auto coll = entry->database(_db_name)[_coll_name];
+        auto cursor = coll.find(filter, _find_opts);
+
+        for (auto const& doc : cursor) {
+            if (s.stopped()) {
+                return;
+            }
+
+            fn(idx, doc);
+        }
+    }
+
+    void for_each_partition(partition_callback_type const& fn) const {
+        auto const filters = this->partition_filters();
+
+        scan s{nullptr};
+
+        try {
+            for (std::size_t i = 0u; i < filters.size(); ++i) {
+                s.spawn([this, &filters, &fn, &s, i] { this->scan_partition(i, filters[i].view(), fn, s); });
+            }
+        } catch (...) {
+            s.fail(std::current_exception());
+        }
+
+        s.join();
+        s.rethrow();
+    }
+
+    void for_each(callback_type const& fn) const {
+        auto const filters = this->partition_filters();
+
+        merge_queue queue{_buffer_size, filters.size()};
+        scan s{[&queue] { queue.abort(); }};
+
+        partition_callback_type const push = [&queue](std::size_t, bsoncxx::v1::document::view doc) {
+            queue.push(doc);
+        };
+
+        try {
+            for (std::size_t i = 0u; i < filters.size(); ++i) {
+                s.spawn([this, &filters, &push, &queue, &s, i] {
+                    this->scan_partition(i, filters[i].view(), push, s);
+                    queue.close();
+                });
+            }
+
+            while (auto doc = queue.pop()) {
+                fn(doc->view());
+            }
+        } catch (...) {
+            s.fail(std::current_exception());
+        }
+
+        s.join();
+        s.rethrow();
+    }
+
+    static impl const& with(parallel_scan const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(parallel_scan const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(parallel_scan& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(parallel_scan* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+parallel_scan::~parallel_scan() {
+    delete impl::with(this);
+}
+
+parallel_scan::parallel_scan(parallel_scan&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+parallel_scan& parallel_scan::operator=(parallel_scan&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+parallel_scan::parallel_scan(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    options const& opts)
+    : _impl{nullptr} {
+    auto const partition_count = opts.partition_count().value_or(default_partition_count());
+    auto const key = opts.key().value_or("_id");
+    auto const sample_size = opts.sample_size().value_or(default_sample_size(partition_count));
+    auto const buffer_size = opts.buffer_size().value_or(default_buffer_size);
+
+    if (partition_count == 0u) {
+        throw v1::exception::internal::make(code::invalid_partition_count);
+    }
+
+    if (key.empty()) {
+        throw v1::exception::internal::make(code::invalid_key);
+    }
+
+    if (sample_size <= 0) {
+        throw v1::exception::internal::make(code::invalid_sample_size);
+    }
+
+    if (buffer_size == 0u) {
+        throw v1::exception::internal::make(code::invalid_buffer_size);
+    }
+
+    bsoncxx::v1::stdx::optional<std::vector<bsoncxx::v1::types::value>> boundaries;
+
+    if (auto const opt = opts.boundaries()) {
+        boundaries.emplace();
+
+        for (auto const e : *opt) {
+            if (!boundaries->empty()) {
+                auto const& prev = boundaries->back();
+
+                if (e.type_id() != prev.type_id() || compare_boundaries(prev, e.type_view()) >= 0) {
+                    throw v1::exception::internal::make(code::invalid_boundaries);
+                }
+            }
+
+            boundaries->push_back(e.type_value());
+        }
+
+        // Also validates the BSON type of a single split point.
+        if (boundaries->size() == 1u) {
+            (void)compare_boundaries(boundaries->front(), boundaries->front());
+        }
+    }
+
+    auto find_opts = opts.find_options().value_or(v1::find_options{});
+
+    // Applied to each partition independently rather than to the scan as a whole.
+    if (find_opts.limit() || find_opts.skip() || find_opts.sort()) {
+        throw v1::exception::internal::make(code::invalid_find_options);
+    }
+
+    _impl = new impl{
+        &pool,
+        std::string{db_name},
+        std::string{coll_name},
+        std::string{key},
+        opts.filter() ? bsoncxx::v1::document::value{*opts.filter()} : bsoncxx::v1::document::value{},
+        std::move(find_opts),
+        partition_count,
+        sample_size,
+        buffer_size,
+        std::move(boundaries)};
+}
+
+parallel_scan::parallel_scan(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name)
+    : parallel_scan{pool, db_name, coll_name, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+parallel_scan::operator bool() const {
+    return _impl != nullptr;
+}
+
+std::vector<bsoncxx::v1::document::value> parallel_scan::partition_filters() const {
+    return impl::with(this)->partition_filters();
+}
+
+void parallel_scan::for_each_partition(partition_callback_type const& fn) const {
+    impl::with(this)->for_each_partition(fn);
+}
+
+void parallel_scan::for_each(callback_type const& fn) const {
+    impl::with(this)->for_each(fn);
+}
+
+std::error_category const& parallel_scan::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::parallel_scan";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_partition_count:
+                    return "the partition count must be greater than zero";
+                case code::invalid_key:
+                    return "the partition key must not be empty";
+                case code::invalid_sample_size:
+                    return "the sample size must be greater than zero";
+                case code::invalid_buffer_size:
+                    return "the buffer size must be greater than zero";
+                case code::invalid_boundaries:
+                    return "the split points must be strictly ascending values with the same supported BSON type";
+                case code::invalid_find_options:
+                    return "the find options must not specify a limit, skip, or sort";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_partition_count:
+                    case code::invalid_key:
+                    case code::invalid_sample_size:
+                    case code::invalid_buffer_size:
+                    case code::invalid_boundaries:
+                    case code::invalid_find_options:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_partition_count:
+                    case code::invalid_key:
+                    case code::invalid_sample_size:
+                    case code::invalid_buffer_size:
+                    case code::invalid_boundaries:
+                    case code::invalid_find_options:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+std::vector<bsoncxx::v1::document::value> parallel_scan::internal::make_filters(
+    bsoncxx::v1::document::view filter,
+    bsoncxx::v1::stdx::string_view key,
+    std::vector<bsoncxx::v1::types::value> const& boundaries) {
+    std::vector<bsoncxx::v1::document::value> ret;
+
+    if (boundaries.empty()) {
+        ret.emplace_back(filter);
+        return ret;
+    }
+
+    ret.reserve(boundaries.size() + 1u);
+
+    for (std::size_t i = 0u; i <= boundaries.size(); ++i) {
+        auto range = make_range(key, boundaries, i);
+
+        if (filter.empty()) {
+            ret.push_back(std::move(range));
+            continue;
+        }
+
+        bson_t* const doc = bson_new();
+        bson_t conds;
+
+        BSON_APPEND_ARRAY_BEGIN(doc, "$and", &conds);
+        BSON_APPEND_DOCUMENT(&conds, "0", scoped_bson_view{filter}.bson());
+        BSON_APPEND_DOCUMENT(&conds, "1", scoped_bson_view{range.view()}.bson());
+        bson_append_array_end(doc, &conds);
+
+        ret.push_back(scoped_bson{doc}.value());
+    }
+
+    return ret;
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+parallel_scan::options::~options() {
+    delete impl::with(_impl);
+}
+
+parallel_scan::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+parallel_scan::options& parallel_scan::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+parallel_scan::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+parallel_scan::options& parallel_scan::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+parallel_scan::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+parallel_scan::options& parallel_scan::options::boundaries(bsoncxx::v1::array::value v) {
+    impl::with(this)->_boundaries = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::array::view> parallel_scan::options::boundaries() const {
+    if (auto const& opt = impl::with(this)->_boundaries) {
+        return opt->view();
+    }
+    return {};
+}
+
+parallel_scan::options& parallel_scan::options::buffer_size(std::size_t v) {
+    impl::with(this)->_buffer_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> parallel_scan::options::buffer_size() const {
+    return impl::with(this)->_buffer_size;
+}
+
+parallel_scan::options& parallel_scan::options::filter(bsoncxx::v1::document::value v) {
+    impl::with(this)->_filter = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::document::view> parallel_scan::options::filter() const {
+    if (auto const& opt = impl::with(this)->_filter) {
+        return opt->view();
+    }
+    return {};
+}
+
+parallel_scan::options& parallel_scan::options::find_options(v1::find_options v) {
+    impl::with(this)->_find_options = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<v1::find_options> parallel_scan::options::find_options() const {
+    return impl::with(this)->_find_options;
+}
+
+parallel_scan::options& parallel_scan::options::key(std::string v) {
+    impl::with(this)->_key = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<bsoncxx::v1::stdx::string_view> parallel_scan::options::key() const {
+    if (auto const& opt = impl::with(this)->_key) {
+        return bsoncxx::v1::stdx::string_view{*opt};
+    }
+    return {};
+}
+
+parallel_scan::options& parallel_scan::options::partition_count(std::size_t v) {
+    impl::with(this)->_partition_count = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> parallel_scan::options::partition_count() const {
+    return impl::with(this)->_partition_count;
+}
+
+parallel_scan::options& parallel_scan::options::sample_size(std::int32_t v) {
+    impl::with(this)->_sample_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::int32_t> parallel_scan::options::sample_size() const {
+    return impl::with(this)->_sample_size;
+}
+
+} // namespace v1
+} // namespace mongocxx
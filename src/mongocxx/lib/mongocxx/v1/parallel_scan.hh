@@ -0,0 +1,44 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/parallel_scan.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+
+#include <vector>
+
+#include <mongocxx/private/export.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class parallel_scan::internal {
+   public:
+    // Return the filter of each partition delimited by the ascending split points `boundaries` (which must all have
+    // the same BSON type) combined with `filter`.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(std::vector<bsoncxx::v1::document::value>) make_filters(
+        bsoncxx::v1::document::view filter,
+        bsoncxx::v1::stdx::string_view key,
+        std::vector<bsoncxx::v1::types::value> const& boundaries);
+};
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,587 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/pipelined_insert.hh>
+
+//
+
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/bulk_write.hpp>
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/collection.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/insert_many_options.hpp>
+#include <mongocxx/v1/pool.hpp>
+
+#include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/exception.hh>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = pipelined_insert::errc;
+
+namespace {
+
+constexpr std::size_t default_max_batch_count = 1000u;
+constexpr std::size_t default_max_batch_size = 16u * 1024u * 1024u;
+constexpr std::size_t default_max_in_flight = 4u;
+
+// The appended documents, stored contiguously.
+struct batch {
+    std::size_t index = 0u;
+    std::size_t offset = 0u;
+    std::vector<std::uint8_t> bytes;
+    std::vector<std::size_t> starts; // The offset of each document in `bytes`.
+
+    std::vector<bsoncxx::v1::document::view> views() const {
+        std::vector<bsoncxx::v1::document::view> ret;
+
+        ret.reserve(starts.size());
+
+        for (auto const start : starts) {
+            ret.emplace_back(bytes.data() + start);
+        }
+
+        return ret;
+    }
+};
+
+} // namespace
+
+class pipelined_insert::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<v1::insert_many_options> _insert_many_options;
+    bsoncxx::v1::stdx::optional<std::size_t> _max_batch_count;
+    bsoncxx::v1::stdx::optional<std::size_t> _max_batch_size;
+    bsoncxx::v1::stdx::optional<std::size_t> _max_in_flight;
+    batch_handler _on_batch;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class pipelined_insert::impl {
+   public:
+    v1::pool* _pool;
+    std::string _db_name;
+    std::string _coll_name;
+    v1::insert_many_options _opts;
+    bool _ordered;
+    std::size_t _max_batch_count;
+    std::size_t _max_batch_size;
+    std::size_t _max_in_flight; // One when ordered.
+    batch_handler _on_batch;
+    internal::send_type _send;
+
+    // Only accessed by the thread appending documents.
+    batch _current;
+    std::size_t _cut = 0u;      // The number of batches cut so far.
+    std::size_t _appended = 0u; // The number of documents appended so far.
+    summary _summary;
+
+    std::mutex _mutex;
+    std::condition_variable _queued;    // Notified when a batch is queued or when stopping.
+    std::condition_variable _completed; // Notified when a batch is completed.
+    bool _stopping = false;
+    std::deque<batch> _queue;
+    std::size_t _in_flight = 0u; // Queued or being inserted.
+    std::deque<batch_result> _results;
+    std::exception_ptr _error; // The error of the first failed batch.
+    std::vector<std::thread> _workers;
+
+    ~impl() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stopping = true;
+        }
+
+        _queued.notify_all();
+
+        for (auto& worker : _workers) {
+            worker.join();
+        }
+    }
+
+    impl(impl&& other) noexcept = delete;
+    impl& operator=(impl&& other) noexcept = delete;
+    impl(impl const& other) = delete;
+    impl& operator=(impl const& other) = delete;
+
+    impl(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        v1::insert_many_options opts,
+        std::size_t max_batch_count,
+        std::size_t max_batch_size,
+        std::size_t max_in_flight,
+        batch_handler on_batch)
+        : _pool{&pool},
+          _db_name{db_name},
+          _coll_name{coll_name},
+          _opts{std::move(opts)},
+          _ordered{_opts.ordered().value_or(true)},
+          _max_batch_count{max_batch_count},
+          _max_batch_size{max_batch_size},
+          _max_in_flight{_ordered ? 1u : max_in_flight},
+          _on_batch{std::move(on_batch)} {}
+
+    std::int64_t send(std::vector<bsoncxx::v1::document::view> const& docs) {
+        if (_send) {
+            return _send(docs);
+        }
+
+        auto entry = _pool->acquire();
+        auto coll = entry->database(_db_name)[_coll_name];
+        auto bulk = v1::collection::internal::create_insert_many(coll, _opts);
+
+        for (auto const& doc : docs) {
+            bulk.append(v1::bulk_write::insert_one_view{doc});
+        }
+
+        auto const res = bulk.execute();
+
+        return res ? res->inserted_count() : 0;
+    }
+
+    void work() noexcept {
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        for (;;) {
+            _queued.wait(lock, [&] { return _stopping || !_queue.empty(); });
+
+            // Queued batches are inserted even when stopping.
+            if (_queue.empty()) {
+                return;
+            }
+
+            auto const b = std::move(_queue.front());
+            _queue.pop_front();
+
+            lock.unlock();
+
+            batch_result result;
+
+            result.index = b.index;
+            result.offset = b.offset;
+            result.count = b.starts.size();
+            result.size = b.bytes.size();
+
+            try {
+                result.inserted_count = this->send(b.views());
+            } catch (...) {
+                result.error = std::current_exception();
+            }
+
+            lock.lock();
+
+            if (result.error && !_error) {
+                _error = result.error;
+            }
+
+            try {
+                _results.push_back(std::move(result));
+            } catch (...) {
+                // Only the result is lost.
+            }
+
+            --_in_flight;
+            _completed.notify_all();
+        }
+    }
+
+    // Report the result of every completed batch.
+    //
+    // Results are taken one at a time so that, when the "on_batch" handler throws, the results which have not yet been
+    // reported (or counted) remain for the next call.
+    void report() {
+        for (;;) {
+            batch_result result;
+
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+
+                if (_results.empty()) {
+                    return;
+                }
+
+                result = std::move(_results.front());
+                _results.pop_front();
+            }
+
+            ++_summary.batches;
+            _summary.documents += result.count;
+            _summary.inserted_count += result.inserted_count;
+
+            if (_on_batch) {
+                _on_batch(result);
+            }
+        }
+    }
+
+    void throw_if_failed() {
+        std::exception_ptr error;
+
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            error = _error;
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // Hand the current batch (if any) to a background thread.
+    void cut() {
+        if (_current.starts.empty()) {
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+
+            _completed.wait(lock, [&] { return _in_flight < _max_in_flight || (_ordered && _error); });
+
+            // No further batch is inserted after an error when ordered.
+            if (_ordered && _error) {
+                _current = batch{};
+                return;
+            }
+
+            _queue.push_back(std::move(_current));
+            ++_in_flight;
+
+            if (_workers.size() < _in_flight) {
+                _workers.emplace_back([this] { this->work(); });
+            }
+        }
+
+        _queued.notify_one();
+
+        _current = batch{};
+        ++_cut;
+    }
+
+    void append(bsoncxx::v1::document::view doc) {
+        this->report();
+
+        if (_ordered) {
+            this->throw_if_failed();
+        }
+
+        auto const length = doc.length();
+
+        if (!_current.starts.empty() && _current.bytes.size() + length > _max_batch_size) {
+            this->cut();
+            this->report();
+
+            if (_ordered) {
+                this->throw_if_failed();
+            }
+        }
+
+        if (_current.starts.empty()) {
+            _current.index = _cut;
+            _current.offset = _appended;
+        }
+
+        _current.starts.push_back(_current.bytes.size());
+        _current.bytes.insert(_current.bytes.end(), doc.data(), doc.data() + length);
+        ++_appended;
+
+        if (_current.starts.size() >= _max_batch_count) {
+            this->cut();
+        }
+    }
+
+    summary finish() {
+        this->cut();
+
+        {
+            std::unique_lock<std::mutex> lock{_mutex};
+            _completed.wait(lock, [&] { return _in_flight == 0u; });
+        }
+
+        this->report();
+        this->throw_if_failed();
+
+        return _summary;
+    }
+
+    static impl& with(pipelined_insert& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(pipelined_insert* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+pipelined_insert::~pipelined_insert() {
+    delete impl::with(_impl);
+}
+
+pipelined_insert::pipelined_insert(pipelined_insert&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+pipelined_insert& pipelined_insert::operator=(pipelined_insert&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+pipelined_insert::pipelined_insert(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    options const& opts)
+    : _impl{nullptr} {
+    auto const max_batch_count = opts.max_batch_count().value_or(default_max_batch_count);
+    auto const max_batch_size = opts.max_batch_size().value_or(default_max_batch_size);
+    auto const max_in_flight = opts.max_in_flight().value_or(default_max_in_flight);
+
+    if (max_batch_count == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_batch_count);
+    }
+
+    if (max_batch_size == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_batch_size);
+    }
+
+    if (max_in_flight == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_in_flight);
+    }
+
+    _impl = new impl{
+        pool,
+        db_name,
+        coll_name,
+        opts.insert_many_options().value_or(v1::insert_many_options{}),
+        max_batch_count,
+        max_batch_size,
+        max_in_flight,
+        opts.on_batch()};
+}
+
+pipelined_insert::pipelined_insert(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name)
+    : pipelined_insert{pool, db_name, coll_name, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+pipelined_insert::operator bool() const {
+    return _impl != nullptr;
+}
+
+void pipelined_insert::append(bsoncxx::v1::document::view doc) {
+    impl::with(this)->append(doc);
+}
+
+pipelined_insert::summary pipelined_insert::finish() {
+    return impl::with(this)->finish();
+}
+
+std::error_category const& pipelined_insert::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::pipelined_insert";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_max_batch_count:
+                    return "the maximum batch count must be greater than zero";
+                case code::invalid_max_batch_size:
+                    return "the maximum batch size must be greater than zero";
+                case code::invalid_max_in_flight:
+                    return "the maximum number of batches in flight must be greater than zero";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_batch_count:
+                    case code::invalid_max_batch_size:
+                    case code::invalid_max_in_flight:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_batch_count:
+                    case code::invalid_max_batch_size:
+                    case code::invalid_max_in_flight:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+void pipelined_insert::internal::set_send(pipelined_insert& self, send_type fn) {
+    impl::with(self)._send = std::move(fn);
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+pipelined_insert::options::~options() {
+    delete impl::with(_impl);
+}
+
+pipelined_insert::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+pipelined_insert::options& pipelined_insert::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+pipelined_insert::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+pipelined_insert::options& pipelined_insert::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+pipelined_insert::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+pipelined_insert::options& pipelined_insert::options::insert_many_options(v1::insert_many_options v) {
+    impl::with(this)->_insert_many_options = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<v1::insert_many_options> pipelined_insert::options::insert_many_options() const {
+    return impl::with(this)->_insert_many_options;
+}
+
+pipelined_insert::options& pipelined_insert::options::max_batch_count(std::size_t v) {
+    impl::with(this)->_max_batch_count = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> pipelined_insert::options::max_batch_count() const {
+    return impl::with(this)->_max_batch_count;
+}
+
+pipelined_insert::options& pipelined_insert::options::max_batch_size(std::size_t v) {
+    impl::with(this)->_max_batch_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> pipelined_insert::options::max_batch_size() const {
+    return impl::with(this)->_max_batch_size;
+}
+
+pipelined_insert::options& pipelined_insert::options::max_in_flight(std::size_t v) {
+    impl::with(this)->_max_in_flight = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> pipelined_insert::options::max_in_flight() const {
+    return impl::with(this)->_max_in_flight;
+}
+
+pipelined_insert::options& pipelined_insert::options::on_batch(batch_handler v) {
+    impl::with(this)->_on_batch = std::move(v);
+    return *this;
+}
+
+pipelined_insert::batch_handler pipelined_insert::options::on_batch() const {
+    return impl::with(this)->_on_batch;
+}
+
+} // namespace v1
+} // namespace mongocxx
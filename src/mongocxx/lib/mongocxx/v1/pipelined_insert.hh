@@ -0,0 +1,42 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/pipelined_insert.hpp> // IWYU pragma: export
+
+//
+
+#include <bsoncxx/v1/document/view.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <mongocxx/private/export.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class pipelined_insert::internal {
+   public:
+    using send_type = std::function<std::int64_t(std::vector<bsoncxx::v1::document::view> const& docs)>;
+
+    // Replace the insertion of each batch, which is otherwise performed with a client object acquired from the
+    // associated pool. Must be called before the first batch is cut.
+    static MONGOCXX_ABI_EXPORT_CDECL_TESTING(void) set_send(pipelined_insert& self, send_type fn);
+};
+
+} // namespace v1
+} // namespace mongocxx
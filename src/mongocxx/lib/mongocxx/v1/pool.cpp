@@ -30,15 +30,24 @@
 #include <mongocxx/v1/tls.hh>
 #include <mongocxx/v1/uri.hh>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <bsoncxx/private/bson.hh>
 #include <bsoncxx/private/immortal.hh>
 
 #include <mongocxx/private/mongoc.hh>
+#include <mongocxx/private/scoped_bson.hh>
 #include <mongocxx/private/ssl.hh>
 #include <mongocxx/private/utility.hh>
 
@@ -53,6 +62,15 @@ class pool::impl {
     v1::apm _apm;
     v1::oidc_callback _oidc_callback;
 
+    std::atomic<std::int64_t> _acquired{0};
+    std::atomic<std::int64_t> _timeouts{0};
+    std::atomic<std::int64_t> _misses{0};
+    std::atomic<std::int64_t> _in_use{0};
+    std::atomic<std::int64_t> _peak_in_use{0};
+    std::atomic<std::int64_t> _wait_time{0}; // Nanoseconds.
+    std::array<std::atomic<std::int64_t>, std::tuple_size<decltype(acquire_stats::wait_histogram)>::value>
+        _wait_histogram = {};
+
     ~impl() {
         libmongoc::client_pool_destroy(_pool);
     }
@@ -75,6 +93,42 @@ class pool::impl {
 
     explicit impl(mongoc_client_pool_t* pool) : _pool{pool} {}
 
+    void on_acquire(std::chrono::steady_clock::duration wait) {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        using std::chrono::nanoseconds;
+
+        constexpr auto relaxed = std::memory_order_relaxed;
+
+        _acquired.fetch_add(1, relaxed);
+        _wait_time.fetch_add(static_cast<std::int64_t>(duration_cast<nanoseconds>(wait).count()), relaxed);
+
+        {
+            // Element i > 0 counts waits in [2^(i-1), 2^i) microseconds.
+            auto us = static_cast<std::uint64_t>(duration_cast<microseconds>(wait).count());
+            std::size_t idx = 0u;
+
+            while (us != 0u && idx + 1u < _wait_histogram.size()) {
+                us >>= 1u;
+                ++idx;
+            }
+
+            _wait_histogram[idx].fetch_add(1, relaxed);
+        }
+
+        {
+            auto const in_use = _in_use.fetch_add(1, relaxed) + 1;
+            auto peak = _peak_in_use.load(relaxed);
+
+            while (in_use > peak && !_peak_in_use.compare_exchange_weak(peak, in_use, relaxed)) {
+            }
+        }
+    }
+
+    void on_release() {
+        _in_use.fetch_sub(1, std::memory_order_relaxed);
+    }
+
     static impl const& with(pool const& self) {
         return *static_cast<impl const*>(self._impl);
     }
@@ -173,25 +227,125 @@ pool::operator bool() const {
 }
 
 pool::entry pool::acquire() {
-    auto const _pool = impl::with(this)->_pool;
+    auto& _impl = impl::with(*this);
+
+    auto const start = std::chrono::steady_clock::now();
 
-    if (auto const ptr = libmongoc::client_pool_pop(_pool)) {
-        return entry::internal::make(_pool, ptr);
+    if (auto const ptr = libmongoc::client_pool_pop(_impl._pool)) {
+        _impl.on_acquire(std::chrono::steady_clock::now() - start);
+        return entry::internal::make(*this, ptr);
     }
 
+    _impl._timeouts.fetch_add(1, std::memory_order_relaxed);
+
     throw v1::exception::internal::make(code::wait_queue_timeout);
 }
 
 bsoncxx::v1::stdx::optional<pool::entry> pool::try_acquire() {
-    auto const _pool = impl::with(this)->_pool;
+    auto& _impl = impl::with(*this);
 
-    if (auto const ptr = libmongoc::client_pool_try_pop(_pool)) {
-        return entry::internal::make(_pool, ptr);
+    auto const start = std::chrono::steady_clock::now();
+
+    if (auto const ptr = libmongoc::client_pool_try_pop(_impl._pool)) {
+        _impl.on_acquire(std::chrono::steady_clock::now() - start);
+        return entry::internal::make(*this, ptr);
     }
 
+    _impl._misses.fetch_add(1, std::memory_order_relaxed);
+
     return {};
 }
 
+std::size_t pool::warm_up(std::size_t n, std::chrono::steady_clock::time_point deadline) {
+    using clock = std::chrono::steady_clock;
+
+    // Bound the number of commands executed concurrently regardless of `n`.
+    static constexpr std::size_t max_warm_up_threads = 8u;
+
+    // Hold every acquired client object until all commands complete so that each one is distinct.
+    std::vector<entry> entries;
+
+    while (entries.size() < n && clock::now() < deadline) {
+        auto entry_opt = this->try_acquire();
+
+        if (!entry_opt) {
+            break; // "maxPoolSize" has been reached.
+        }
+
+        entries.push_back(std::move(*entry_opt));
+    }
+
+    scoped_bson const command{R"({"ping": 1})"};
+    std::atomic<std::size_t> count{0u};
+
+    auto const ping = [&](entry& e) {
+        if (clock::now() >= deadline) {
+            return;
+        }
+
+        try {
+            (void)e.database("admin").run_command(command.view());
+            count.fetch_add(1u, std::memory_order_relaxed);
+        } catch (v1::exception const&) {
+            // Errors are reported by the first operation which uses the client object instead.
+        }
+    };
+
+    // Each worker pings the next client object which has not yet been pinged until none remain.
+    std::atomic<std::size_t> next{0u};
+
+    auto const work = [&] {
+        for (auto idx = next.fetch_add(1u, std::memory_order_relaxed); idx < entries.size();
+             idx = next.fetch_add(1u, std::memory_order_relaxed)) {
+            ping(entries[idx]);
+        }
+    };
+
+    // The current thread is also a worker.
+    auto const worker_count = (std::min)(entries.size(), max_warm_up_threads);
+
+    std::vector<std::thread> threads;
+    threads.reserve(worker_count > 0u ? worker_count - 1u : 0u);
+
+    for (std::size_t i = 1u; i < worker_count; ++i) {
+        try {
+            threads.emplace_back(work);
+        } catch (std::system_error const&) {
+            break; // Could not start a new thread: the remaining workers ping the remaining client objects.
+        }
+    }
+
+    work();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return count.load(std::memory_order_relaxed);
+}
+
+pool::acquire_stats pool::stats() const {
+    auto const& _impl = impl::with(*this);
+
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    acquire_stats ret;
+
+    ret.acquired = _impl._acquired.load(relaxed);
+    ret.timeouts = _impl._timeouts.load(relaxed);
+    ret.misses = _impl._misses.load(relaxed);
+    ret.in_use = _impl._in_use.load(relaxed);
+    ret.peak_in_use = _impl._peak_in_use.load(relaxed);
+    ret.idle = ret.peak_in_use > ret.in_use ? ret.peak_in_use - ret.in_use : 0;
+    ret.wait_time = std::chrono::nanoseconds{_impl._wait_time.load(relaxed)};
+
+    for (std::size_t i = 0u; i < ret.wait_histogram.size(); ++i) {
+        ret.wait_histogram[i] = _impl._wait_histogram[i].load(relaxed);
+    }
+
+    return ret;
+}
+
 void pool::append_metadata(
     bsoncxx::v1::stdx::string_view name,
     bsoncxx::v1::stdx::optional<bsoncxx::v1::stdx::string_view> version,
@@ -337,8 +491,13 @@ class pool::entry::impl {
    public:
     mongoc_client_pool_t* _pool;
     v1::client _client;
+    pool::impl* _owner = nullptr;
 
     ~impl() {
+        if (_owner) {
+            _owner->on_release();
+        }
+
         libmongoc::client_pool_push(_pool, v1::client::internal::release(_client));
     }
 
@@ -349,6 +508,8 @@ class pool::entry::impl {
 
     impl(mongoc_client_pool_t* pool, v1::client client) : _pool{pool}, _client{std::move(client)} {}
 
+    impl(pool::impl& owner, v1::client client) : _pool{owner._pool}, _client{std::move(client)}, _owner{&owner} {}
+
     static impl const& with(entry const& other) {
         return *static_cast<impl const*>(other._impl);
     }
@@ -445,5 +606,9 @@ pool::entry pool::entry::internal::make(mongoc_client_pool_t* pool, mongoc_clien
     return {new impl{pool, v1::client::internal::make(client)}};
 }
 
+pool::entry pool::entry::internal::make(pool& owner, mongoc_client_t* client) {
+    return {new impl{pool::impl::with(owner), v1::client::internal::make(client)}};
+}
+
 } // namespace v1
 } // namespace mongocxx
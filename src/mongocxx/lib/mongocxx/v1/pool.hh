@@ -44,6 +44,9 @@ class pool::options::internal {
 class pool::entry::internal {
    public:
     static MONGOCXX_ABI_EXPORT_CDECL_TESTING(entry) make(mongoc_client_pool_t* pool, mongoc_client_t* client);
+
+    // Acquisition is counted by `owner.stats()` until the entry is released.
+    static entry make(pool& owner, mongoc_client_t* client);
 };
 
 } // namespace v1
@@ -0,0 +1,190 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/prepared_aggregate.hpp>
+
+//
+
+#include <bsoncxx/v1/array/view.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/aggregate_options.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+
+#include <mongocxx/v1/aggregate_options.hh>
+#include <mongocxx/v1/client_session.hh>
+#include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/cursor.hh>
+#include <mongocxx/v1/read_preference.hh>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include <bsoncxx/private/bson.hh>
+
+#include <mongocxx/private/mongoc.hh>
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class prepared_aggregate::impl {
+   public:
+    bsoncxx::v1::document::value _pipeline;
+    bsoncxx::v1::document::value _stages; // `_pipeline` with every index incremented by one.
+    bsoncxx::v1::document::value _opts;
+    bsoncxx::v1::stdx::optional<v1::read_preference> _read_preference;
+
+    impl(v1::pipeline const& pipeline, v1::aggregate_options const& opts)
+        : _pipeline{bsoncxx::v1::document::view{pipeline.view_array()}},
+          _read_preference{v1::aggregate_options::internal::read_preference(opts)} {
+        {
+            scoped_bson stages;
+            std::uint32_t idx = 1u;
+
+            for (auto const& e : pipeline.view_array()) {
+                auto const key = std::to_string(idx++);
+
+                stages += scoped_bson{BCON_NEW(key.c_str(), BCON_DOCUMENT(scoped_bson_view{e.get_document().value}))};
+            }
+
+            _stages = std::move(stages).value();
+        }
+
+        {
+            scoped_bson doc;
+            v1::aggregate_options::internal::append_to(opts, doc);
+            _opts = std::move(doc).value();
+        }
+    }
+
+    v1::cursor execute(v1::collection& coll, bson_t const* pipeline, bson_t const* opts) const {
+        return v1::cursor::internal::make(
+            libmongoc::collection_aggregate(
+                v1::collection::internal::as_mongoc(coll),
+                MONGOC_QUERY_NONE,
+                pipeline,
+                opts,
+                _read_preference ? v1::read_preference::internal::as_mongoc(*_read_preference) : nullptr));
+    }
+
+    // Bind `filter` as a leading "$match" stage followed by the prepared stages.
+    scoped_bson bind(bsoncxx::v1::document::view filter) const {
+        scoped_bson ret{BCON_NEW("0", "{", "$match", BCON_DOCUMENT(scoped_bson_view{filter}.bson()), "}")};
+
+        if (!_stages.view().empty()) {
+            ret += scoped_bson_view{_stages};
+        }
+
+        return ret;
+    }
+
+    static impl const& with(prepared_aggregate const& other) {
+        return *static_cast<impl const*>(other._impl);
+    }
+
+    static impl const* with(prepared_aggregate const* other) {
+        return static_cast<impl const*>(other->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+prepared_aggregate::~prepared_aggregate() {
+    delete impl::with(_impl);
+}
+
+prepared_aggregate::prepared_aggregate(prepared_aggregate&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+prepared_aggregate& prepared_aggregate::operator=(prepared_aggregate&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+prepared_aggregate::prepared_aggregate(prepared_aggregate const& other) : _impl{new impl{impl::with(other)}} {}
+
+prepared_aggregate& prepared_aggregate::operator=(prepared_aggregate const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+prepared_aggregate::prepared_aggregate(v1::pipeline const& pipeline, v1::aggregate_options const& opts)
+    : _impl{new impl{pipeline, opts}} {}
+
+prepared_aggregate::prepared_aggregate(v1::pipeline const& pipeline)
+    : prepared_aggregate{pipeline, v1::aggregate_options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+prepared_aggregate::operator bool() const {
+    return _impl != nullptr;
+}
+
+v1::cursor prepared_aggregate::execute(v1::collection& coll) const {
+    auto const& self = impl::with(*this);
+
+    return self.execute(coll, scoped_bson_view{self._pipeline}.bson(), scoped_bson_view{self._opts}.bson());
+}
+
+v1::cursor prepared_aggregate::execute(v1::collection& coll, v1::client_session const& session) const {
+    auto const& self = impl::with(*this);
+
+    scoped_bson doc{self._opts};
+    v1::client_session::internal::append_to(session, doc);
+
+    return self.execute(coll, scoped_bson_view{self._pipeline}.bson(), doc.bson());
+}
+
+v1::cursor prepared_aggregate::execute(v1::collection& coll, bsoncxx::v1::document::view filter) const {
+    auto const& self = impl::with(*this);
+
+    if (filter.empty()) {
+        return self.execute(coll, scoped_bson_view{self._pipeline}.bson(), scoped_bson_view{self._opts}.bson());
+    }
+
+    return self.execute(coll, self.bind(filter).bson(), scoped_bson_view{self._opts}.bson());
+}
+
+v1::cursor prepared_aggregate::execute(
+    v1::collection& coll,
+    v1::client_session const& session,
+    bsoncxx::v1::document::view filter) const {
+    auto const& self = impl::with(*this);
+
+    scoped_bson doc{self._opts};
+    v1::client_session::internal::append_to(session, doc);
+
+    if (filter.empty()) {
+        return self.execute(coll, scoped_bson_view{self._pipeline}.bson(), doc.bson());
+    }
+
+    return self.execute(coll, self.bind(filter).bson(), doc.bson());
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,131 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/prepared_find.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/find_options.hpp>
+
+#include <mongocxx/v1/client_session.hh>
+#include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/cursor.hh>
+#include <mongocxx/v1/find_options.hh>
+#include <mongocxx/v1/read_preference.hh>
+
+#include <utility>
+
+#include <mongocxx/private/mongoc.hh>
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+class prepared_find::impl {
+   public:
+    bsoncxx::v1::document::value _opts;
+    bsoncxx::v1::stdx::optional<v1::read_preference> _read_preference;
+    bsoncxx::v1::stdx::optional<v1::cursor::type> _cursor_type;
+
+    explicit impl(v1::find_options const& opts)
+        : _read_preference{v1::find_options::internal::read_preference(opts)}, _cursor_type{opts.cursor_type()} {
+        scoped_bson doc;
+        v1::find_options::internal::append_to(opts, doc);
+        _opts = std::move(doc).value();
+    }
+
+    v1::cursor execute(v1::collection& coll, bsoncxx::v1::document::view filter, bson_t const* opts) const {
+        return v1::cursor::internal::make(
+            libmongoc::collection_find_with_opts(
+                v1::collection::internal::as_mongoc(coll),
+                scoped_bson_view{filter}.bson(),
+                opts,
+                _read_preference ? v1::read_preference::internal::as_mongoc(*_read_preference) : nullptr),
+            _cursor_type);
+    }
+
+    static impl const& with(prepared_find const& other) {
+        return *static_cast<impl const*>(other._impl);
+    }
+
+    static impl const* with(prepared_find const* other) {
+        return static_cast<impl const*>(other->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+prepared_find::~prepared_find() {
+    delete impl::with(_impl);
+}
+
+prepared_find::prepared_find(prepared_find&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+prepared_find& prepared_find::operator=(prepared_find&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+prepared_find::prepared_find(prepared_find const& other) : _impl{new impl{impl::with(other)}} {}
+
+prepared_find& prepared_find::operator=(prepared_find const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+prepared_find::prepared_find(v1::find_options const& opts) : _impl{new impl{opts}} {}
+
+prepared_find::prepared_find() : prepared_find{v1::find_options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+prepared_find::operator bool() const {
+    return _impl != nullptr;
+}
+
+v1::cursor prepared_find::execute(v1::collection& coll, bsoncxx::v1::document::view filter) const {
+    auto const& self = impl::with(*this);
+
+    return self.execute(coll, filter, scoped_bson_view{self._opts}.bson());
+}
+
+v1::cursor prepared_find::execute(
+    v1::collection& coll,
+    v1::client_session const& session,
+    bsoncxx::v1::document::view filter) const {
+    auto const& self = impl::with(*this);
+
+    scoped_bson doc{self._opts};
+    v1::client_session::internal::append_to(session, doc);
+
+    return self.execute(coll, filter, doc.bson());
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,529 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/thread_affine_pool.hh>
+
+//
+
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/pool.hpp>
+
+#include <mongocxx/v1/exception.hh>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = thread_affine_pool::errc;
+
+namespace {
+
+using clock = std::chrono::steady_clock;
+
+constexpr std::chrono::milliseconds default_idle_timeout{10000};
+
+// Distinguishes `thread_affine_pool` objects in thread-local storage even when an address is reused.
+std::atomic<std::uint64_t> next_id{1u};
+
+// The client object pinned to a thread by a `thread_affine_pool` object.
+class slot {
+   public:
+    enum : int {
+        k_empty,  // No client object is pinned.
+        k_idle,   // A client object is pinned but not leased.
+        k_in_use, // A client object is pinned and leased.
+        k_dead,   // The thread or the `thread_affine_pool` object is gone.
+    };
+
+    std::atomic<int> _state{k_empty};
+    std::atomic<clock::rep> _last_used{0};
+
+    // Guards transitions to and from `k_empty` and `k_dead`, which create or destroy `_entry`.
+    std::mutex _mutex;
+    bsoncxx::v1::stdx::optional<v1::pool::entry> _entry;
+
+    // A slot which is owned by a single lease rather than pinned to a thread.
+    bool _transient = false;
+
+    bool try_lease() {
+        auto expected = static_cast<int>(k_idle);
+        return _state.compare_exchange_strong(expected, k_in_use, std::memory_order_acquire);
+    }
+
+    void end_lease() {
+        _last_used.store(clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+        _state.store(k_idle, std::memory_order_release);
+    }
+
+    // Release the pinned client object if it has not been leased since `threshold`.
+    void reap(clock::time_point threshold) {
+        if (_state.load(std::memory_order_relaxed) != k_idle ||
+            _last_used.load(std::memory_order_relaxed) > threshold.time_since_epoch().count()) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        auto expected = static_cast<int>(k_idle);
+
+        if (_state.compare_exchange_strong(expected, k_empty, std::memory_order_acquire)) {
+            _entry.reset();
+        }
+    }
+
+    // Release the pinned client object (if any) permanently.
+    void retire() {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        if (_state.exchange(k_dead, std::memory_order_acquire) != k_dead) {
+            _entry.reset();
+        }
+    }
+
+    bool dead() const {
+        return _state.load(std::memory_order_relaxed) == k_dead;
+    }
+};
+
+// The slots of the current thread, keyed by the ID of their `thread_affine_pool` object.
+class thread_slots {
+   public:
+    std::unordered_map<std::uint64_t, std::shared_ptr<slot>> _slots;
+
+    // The most recently used slot.
+    std::uint64_t _last_id = 0u;
+    slot* _last = nullptr;
+
+    ~thread_slots() {
+        for (auto& kv : _slots) {
+            kv.second->retire();
+        }
+    }
+
+    thread_slots(thread_slots&& other) noexcept = delete;
+    thread_slots& operator=(thread_slots&& other) noexcept = delete;
+    thread_slots(thread_slots const& other) = delete;
+    thread_slots& operator=(thread_slots const& other) = delete;
+
+    thread_slots() = default;
+
+    static thread_slots& current() {
+        static thread_local thread_slots instance;
+        return instance;
+    }
+};
+
+} // namespace
+
+class thread_affine_pool::impl {
+   public:
+    v1::pool* _pool;
+    std::uint64_t _id;
+    clock::duration _idle_timeout;
+
+    mutable std::mutex _mutex; // Guards the members below.
+    std::condition_variable _cv;
+    std::vector<std::shared_ptr<slot>> _slots;
+    bool _stop = false;
+
+    std::thread _reaper;
+
+    ~impl() {
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            _stop = true;
+        }
+
+        _cv.notify_all();
+        _reaper.join();
+
+        for (auto& s : _slots) {
+            s->retire();
+        }
+    }
+
+    impl(impl&& other) noexcept = delete;
+    impl& operator=(impl&& other) noexcept = delete;
+    impl(impl const& other) = delete;
+    impl& operator=(impl const& other) = delete;
+
+    impl(v1::pool& pool, clock::duration idle_timeout)
+        : _pool{&pool}, _id{next_id.fetch_add(1u, std::memory_order_relaxed)}, _idle_timeout{idle_timeout} {
+        _reaper = std::thread{[this] { this->reaper(); }};
+    }
+
+    lease acquire() {
+        auto& ts = thread_slots::current();
+
+        // Fast path: the client object pinned to the current thread is idle.
+        auto const s = ts._last_id == _id ? ts._last : this->find(ts);
+
+        if (s->try_lease()) {
+            return lease::internal::make(s);
+        }
+
+        return this->acquire_slow(*s);
+    }
+
+    lease acquire_slow(slot& s) {
+        {
+            std::lock_guard<std::mutex> lock{s._mutex};
+
+            if (s.try_lease()) {
+                return lease::internal::make(&s);
+            }
+
+            if (s._state.load(std::memory_order_relaxed) == slot::k_empty) {
+                s._entry = _pool->acquire();
+                s._state.store(slot::k_in_use, std::memory_order_relaxed);
+                return lease::internal::make(&s);
+            }
+        }
+
+        // The pinned client object is already leased by the current thread.
+        std::unique_ptr<slot> ptr{new slot};
+
+        ptr->_transient = true;
+        ptr->_entry = _pool->acquire();
+        ptr->_state.store(slot::k_in_use, std::memory_order_relaxed);
+
+        return lease::internal::make(ptr.release());
+    }
+
+    // Obtain the slot for the current thread, creating one if necessary.
+    slot* find(thread_slots& ts) {
+        auto iter = ts._slots.find(_id);
+
+        if (iter == ts._slots.end()) {
+            // Discard slots of `thread_affine_pool` objects which no longer exist.
+            for (auto it = ts._slots.begin(); it != ts._slots.end();) {
+                it = it->second->dead() ? ts._slots.erase(it) : std::next(it);
+            }
+
+            auto s = std::make_shared<slot>();
+
+            {
+                std::lock_guard<std::mutex> lock{_mutex};
+                _slots.push_back(s);
+            }
+
+            iter = ts._slots.emplace(_id, std::move(s)).first;
+        }
+
+        ts._last_id = _id;
+        ts._last = iter->second.get();
+
+        return ts._last;
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock{_mutex};
+
+        return static_cast<std::size_t>(std::count_if(_slots.begin(), _slots.end(), [](std::shared_ptr<slot> const& s) {
+            auto const state = s->_state.load(std::memory_order_relaxed);
+            return state == slot::k_idle || state == slot::k_in_use;
+        }));
+    }
+
+    void reaper() {
+        auto const period = std::max<clock::duration>(_idle_timeout / 2, std::chrono::milliseconds{1});
+
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        while (!_cv.wait_for(lock, period, [&] { return _stop; })) {
+            // Discard slots of threads which have exited.
+            _slots.erase(
+                std::remove_if(_slots.begin(), _slots.end(), [](std::shared_ptr<slot> const& s) { return s->dead(); }),
+                _slots.end());
+
+            auto const threshold = clock::now() - _idle_timeout;
+
+            for (auto& s : _slots) {
+                s->reap(threshold);
+            }
+        }
+    }
+
+    static impl const& with(thread_affine_pool const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(thread_affine_pool const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(thread_affine_pool& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(thread_affine_pool* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+thread_affine_pool::~thread_affine_pool() {
+    delete impl::with(this);
+}
+
+thread_affine_pool::thread_affine_pool(thread_affine_pool&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+thread_affine_pool& thread_affine_pool::operator=(thread_affine_pool&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+thread_affine_pool::thread_affine_pool(v1::pool& pool, options const& opts) : _impl{nullptr} {
+    auto const idle_timeout = opts.idle_timeout().value_or(default_idle_timeout);
+
+    if (idle_timeout <= std::chrono::milliseconds{0}) {
+        throw v1::exception::internal::make(code::invalid_idle_timeout);
+    }
+
+    _impl = new impl{pool, idle_timeout};
+}
+
+thread_affine_pool::thread_affine_pool(v1::pool& pool) : thread_affine_pool{pool, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+thread_affine_pool::operator bool() const {
+    return _impl != nullptr;
+}
+
+thread_affine_pool::lease thread_affine_pool::acquire() {
+    return impl::with(this)->acquire();
+}
+
+std::size_t thread_affine_pool::size() const {
+    return impl::with(this)->size();
+}
+
+std::error_category const& thread_affine_pool::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::thread_affine_pool";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_idle_timeout:
+                    return "the idle timeout must be positive";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_idle_timeout:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_idle_timeout:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+class thread_affine_pool::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<std::chrono::milliseconds> _idle_timeout;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+thread_affine_pool::options::~options() {
+    delete impl::with(_impl);
+}
+
+thread_affine_pool::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+thread_affine_pool::options& thread_affine_pool::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+thread_affine_pool::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+thread_affine_pool::options& thread_affine_pool::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+thread_affine_pool::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+thread_affine_pool::options& thread_affine_pool::options::idle_timeout(std::chrono::milliseconds v) {
+    impl::with(this)->_idle_timeout = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::chrono::milliseconds> thread_affine_pool::options::idle_timeout() const {
+    return impl::with(this)->_idle_timeout;
+}
+
+namespace {
+
+slot* to_slot(void* ptr) {
+    return static_cast<slot*>(ptr);
+}
+
+void end_lease(void* ptr) {
+    if (auto const s = to_slot(ptr)) {
+        if (s->_transient) {
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+            delete s;
+        } else {
+            s->end_lease();
+        }
+    }
+}
+
+} // namespace
+
+thread_affine_pool::lease::~lease() {
+    end_lease(_impl);
+}
+
+thread_affine_pool::lease::lease(lease&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+thread_affine_pool::lease& thread_affine_pool::lease::operator=(lease&& other) noexcept {
+    if (this != &other) {
+        end_lease(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+thread_affine_pool::lease::lease(void* impl) : _impl{impl} {}
+
+v1::client* thread_affine_pool::lease::operator->() {
+    return &**to_slot(_impl)->_entry;
+}
+
+v1::client& thread_affine_pool::lease::operator*() {
+    return **to_slot(_impl)->_entry;
+}
+
+thread_affine_pool::lease& thread_affine_pool::lease::operator=(std::nullptr_t) {
+    end_lease(exchange(_impl, nullptr));
+    return *this;
+}
+
+thread_affine_pool::lease::operator bool() const {
+    return _impl != nullptr;
+}
+
+v1::database thread_affine_pool::lease::database(bsoncxx::v1::stdx::string_view name) {
+    return to_slot(_impl)->_entry->database(name);
+}
+
+v1::database thread_affine_pool::lease::operator[](bsoncxx::v1::stdx::string_view name) {
+    return this->database(name);
+}
+
+thread_affine_pool::lease thread_affine_pool::lease::internal::make(void* slot) {
+    return {slot};
+}
+
+} // namespace v1
+} // namespace mongocxx
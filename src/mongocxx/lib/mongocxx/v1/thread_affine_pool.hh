@@ -0,0 +1,31 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <mongocxx/v1/thread_affine_pool.hpp> // IWYU pragma: export
+
+//
+
+namespace mongocxx {
+namespace v1 {
+
+class thread_affine_pool::lease::internal {
+   public:
+    // `slot` is the lease state owned by the `thread_affine_pool` object.
+    static lease make(void* slot);
+};
+
+} // namespace v1
+} // namespace mongocxx
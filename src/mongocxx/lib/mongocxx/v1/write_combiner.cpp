@@ -0,0 +1,575 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/write_combiner.hpp>
+
+//
+
+#include <bsoncxx/v1/array/view.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/element/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/stdx/string_view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/database.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/write_concern.hpp>
+
+#include <mongocxx/v1/bulk_write.hh>
+#include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/exception.hh>
+#include <mongocxx/v1/insert_one_result.hh>
+#include <mongocxx/v1/server_error.hh>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/bson.hh>
+#include <bsoncxx/private/immortal.hh>
+
+#include <mongocxx/private/scoped_bson.hh>
+#include <mongocxx/private/utility.hh>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = write_combiner::errc;
+
+namespace {
+
+constexpr std::size_t default_max_batch_size = 1000u;
+constexpr std::chrono::microseconds default_max_delay{1000};
+
+// The reply document of a bulk write operation containing a single insert operation.
+bsoncxx::v1::document::value make_single_reply(bsoncxx::v1::document::view const* write_error) {
+    bson_t* const reply = bson_new();
+
+    BSON_APPEND_INT32(reply, "nInserted", write_error ? 0 : 1);
+    BSON_APPEND_INT32(reply, "nMatched", 0);
+    BSON_APPEND_INT32(reply, "nModified", 0);
+    BSON_APPEND_INT32(reply, "nRemoved", 0);
+    BSON_APPEND_INT32(reply, "nUpserted", 0);
+
+    bson_t errors;
+    BSON_APPEND_ARRAY_BEGIN(reply, "writeErrors", &errors);
+
+    if (write_error) {
+        bson_t entry;
+        BSON_APPEND_DOCUMENT_BEGIN(&errors, "0", &entry);
+
+        // The index of the single insert operation.
+        BSON_APPEND_INT32(&entry, "index", 0);
+
+        bson_iter_t iter;
+        if (bson_iter_init_from_data(&iter, write_error->data(), write_error->length())) {
+            while (bson_iter_next(&iter)) {
+                if (std::strcmp(bson_iter_key(&iter), "index") != 0) {
+                    bson_append_iter(&entry, nullptr, 0, &iter);
+                }
+            }
+        }
+
+        bson_append_document_end(&errors, &entry);
+    }
+
+    bson_append_array_end(reply, &errors);
+
+    return scoped_bson{reply}.value();
+}
+
+// True when the reply of a failed bulk write operation only reports per-document write errors.
+bool has_only_write_errors(bsoncxx::v1::document::view reply) {
+    auto const write_errors = reply["writeErrors"];
+
+    if (!write_errors || write_errors.type_id() != bsoncxx::v1::types::id::k_array ||
+        write_errors.get_array().value.empty()) {
+        return false;
+    }
+
+    auto const write_concern_errors = reply["writeConcernErrors"];
+
+    if (write_concern_errors && write_concern_errors.type_id() == bsoncxx::v1::types::id::k_array &&
+        !write_concern_errors.get_array().value.empty()) {
+        return false;
+    }
+
+    return true;
+}
+
+bool has_index(bsoncxx::v1::document::view write_error, std::size_t idx) {
+    auto const e = write_error["index"];
+
+    if (!e) {
+        return false;
+    }
+
+    switch (e.type_id()) {
+        case bsoncxx::v1::types::id::k_int32:
+            return static_cast<std::int64_t>(e.get_int32().value) == static_cast<std::int64_t>(idx);
+        case bsoncxx::v1::types::id::k_int64:
+            return e.get_int64().value == static_cast<std::int64_t>(idx);
+        default:
+            return false;
+    }
+}
+
+[[noreturn]] void throw_write_error(bsoncxx::v1::document::view write_error) {
+    int error_code = 0;
+    std::string message;
+
+    if (auto const e = write_error["code"]) {
+        if (e.type_id() == bsoncxx::v1::types::id::k_int32) {
+            error_code = e.get_int32().value;
+        }
+    }
+
+    if (auto const e = write_error["errmsg"]) {
+        if (e.type_id() == bsoncxx::v1::types::id::k_string) {
+            message = std::string{e.get_string().value};
+        }
+    }
+
+    auto ex = v1::exception::internal::make(error_code, v1::server_error::internal::category(), message.c_str());
+    v1::exception::internal::set_reply(ex, make_single_reply(&write_error));
+    throw std::move(ex);
+}
+
+} // namespace
+
+class write_combiner::options::impl {
+   public:
+    bsoncxx::v1::stdx::optional<bool> _bypass_document_validation;
+    bsoncxx::v1::stdx::optional<std::size_t> _max_batch_size;
+    bsoncxx::v1::stdx::optional<std::chrono::microseconds> _max_delay;
+    bsoncxx::v1::stdx::optional<v1::write_concern> _write_concern;
+
+    static impl const& with(options const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(options const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(options& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(options* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+class write_combiner::impl {
+   public:
+    class batch {
+       public:
+        std::vector<bsoncxx::v1::document::value> _docs;
+        std::vector<bsoncxx::v1::types::value> _ids;
+
+        // Guarded by `impl::_mutex`.
+        bool _closed = false;
+        bool _done = false;
+        std::condition_variable _cv;
+
+        // Written by the leader before `_done` is set.
+        bool _acknowledged = false;
+        bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> _reply; // Only when there are write errors.
+        std::exception_ptr _error;
+
+        bsoncxx::v1::stdx::optional<v1::insert_one_result> result(std::size_t idx) const {
+            if (_error) {
+                std::rethrow_exception(_error);
+            }
+
+            if (!_acknowledged) {
+                return {};
+            }
+
+            if (_reply) {
+                for (auto const e : (*_reply)["writeErrors"].get_array().value) {
+                    if (e.type_id() != bsoncxx::v1::types::id::k_document) {
+                        continue;
+                    }
+
+                    auto const write_error = e.get_document().value;
+
+                    if (has_index(write_error, idx)) {
+                        throw_write_error(write_error);
+                    }
+                }
+            }
+
+            return v1::insert_one_result::internal::make(
+                v1::bulk_write::result::internal::make(make_single_reply(nullptr)), _ids[idx]);
+        }
+    };
+
+    v1::pool* _pool;
+    std::string _db_name;
+    std::string _coll_name;
+    v1::bulk_write::options _bulk_opts;
+    std::size_t _max_batch_size;
+    std::chrono::microseconds _max_delay;
+
+    mutable std::mutex _mutex;
+    std::shared_ptr<batch> _open;
+    std::size_t _executing = 0u; // The number of batches currently being executed.
+    std::size_t _batch_count = 0u;
+    std::size_t _document_count = 0u;
+
+    impl(
+        v1::pool& pool,
+        bsoncxx::v1::stdx::string_view db_name,
+        bsoncxx::v1::stdx::string_view coll_name,
+        v1::bulk_write::options bulk_opts,
+        std::size_t max_batch_size,
+        std::chrono::microseconds max_delay)
+        : _pool{&pool},
+          _db_name{db_name},
+          _coll_name{coll_name},
+          _bulk_opts{std::move(bulk_opts)},
+          _max_batch_size{max_batch_size},
+          _max_delay{max_delay} {}
+
+    bsoncxx::v1::stdx::optional<v1::insert_one_result> insert_one(bsoncxx::v1::document::view document) {
+        auto doc = v1::collection::internal::with_id(document);
+        auto id = doc["_id"].type_value();
+
+        std::unique_lock<std::mutex> lock{_mutex};
+
+        // The first caller to join a batch is responsible for executing it.
+        auto const is_leader = !_open;
+
+        if (is_leader) {
+            _open = std::make_shared<batch>();
+        }
+
+        auto const b = _open;
+        auto const idx = b->_docs.size();
+
+        b->_docs.push_back(std::move(doc));
+        b->_ids.push_back(std::move(id));
+        ++_document_count;
+
+        if (b->_docs.size() >= _max_batch_size) {
+            this->close(*b);
+            b->_cv.notify_all();
+        }
+
+        if (is_leader) {
+            // Only wait for other inserts to join this batch while another batch is being executed: an uncontended
+            // insert is executed immediately.
+            b->_cv.wait_for(lock, _max_delay, [&] { return b->_closed || _executing == 0u; });
+            this->close(*b);
+            ++_batch_count;
+            ++_executing;
+
+            // No other thread may modify a closed batch.
+            lock.unlock();
+            this->execute(*b);
+            lock.lock();
+
+            --_executing;
+
+            b->_done = true;
+            b->_cv.notify_all();
+
+            // The leader of the open batch (if any) may stop waiting.
+            if (_open) {
+                _open->_cv.notify_all();
+            }
+        } else {
+            b->_cv.wait(lock, [&] { return b->_done; });
+        }
+
+        lock.unlock();
+
+        return b->result(idx);
+    }
+
+    void close(batch& b) {
+        if (_open.get() == &b) {
+            _open.reset();
+        }
+
+        b._closed = true;
+    }
+
+    void execute(batch& b) noexcept {
+        try {
+            auto entry = _pool->acquire();
+            auto coll = entry->database(_db_name)[_coll_name];
+            auto bulk = coll.create_bulk_write(_bulk_opts);
+
+            for (auto& doc : b._docs) {
+                bulk.append(v1::bulk_write::insert_one{std::move(doc)});
+            }
+
+            b._acknowledged = bulk.execute().has_value();
+        } catch (v1::exception const& ex) {
+            auto const& reply = v1::exception::internal::get_reply(ex);
+
+            if (reply && has_only_write_errors(*reply)) {
+                b._acknowledged = true;
+                b._reply = *reply;
+            } else {
+                b._error = std::current_exception();
+            }
+        } catch (...) {
+            b._error = std::current_exception();
+        }
+    }
+
+    static impl const& with(write_combiner const& self) {
+        return *static_cast<impl const*>(self._impl);
+    }
+
+    static impl const* with(write_combiner const* self) {
+        return static_cast<impl const*>(self->_impl);
+    }
+
+    static impl& with(write_combiner& self) {
+        return *static_cast<impl*>(self._impl);
+    }
+
+    static impl* with(write_combiner* self) {
+        return static_cast<impl*>(self->_impl);
+    }
+
+    static impl* with(void* ptr) {
+        return static_cast<impl*>(ptr);
+    }
+};
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+write_combiner::~write_combiner() {
+    delete impl::with(this);
+}
+
+write_combiner::write_combiner(write_combiner&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+write_combiner& write_combiner::operator=(write_combiner&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+write_combiner::write_combiner(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name,
+    options const& opts)
+    : _impl{nullptr} {
+    auto const max_batch_size = opts.max_batch_size().value_or(default_max_batch_size);
+
+    if (max_batch_size == 0u) {
+        throw v1::exception::internal::make(code::invalid_max_batch_size);
+    }
+
+    v1::bulk_write::options bulk_opts;
+
+    bulk_opts.ordered(false);
+
+    if (auto const opt = opts.bypass_document_validation()) {
+        bulk_opts.bypass_document_validation(*opt);
+    }
+
+    if (auto opt = opts.write_concern()) {
+        bulk_opts.write_concern(std::move(*opt));
+    }
+
+    _impl = new impl{
+        pool,
+        db_name,
+        coll_name,
+        std::move(bulk_opts),
+        max_batch_size,
+        opts.max_delay().value_or(default_max_delay)};
+}
+
+write_combiner::write_combiner(
+    v1::pool& pool,
+    bsoncxx::v1::stdx::string_view db_name,
+    bsoncxx::v1::stdx::string_view coll_name)
+    : write_combiner{pool, db_name, coll_name, options{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+write_combiner::operator bool() const {
+    return _impl != nullptr;
+}
+
+bsoncxx::v1::stdx::optional<v1::insert_one_result> write_combiner::insert_one(bsoncxx::v1::document::view document) {
+    return impl::with(this)->insert_one(document);
+}
+
+std::size_t write_combiner::batch_count() const {
+    auto const& self = impl::with(*this);
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._batch_count;
+}
+
+std::size_t write_combiner::document_count() const {
+    auto const& self = impl::with(*this);
+    std::lock_guard<std::mutex> lock{self._mutex};
+    return self._document_count;
+}
+
+std::error_category const& write_combiner::error_category() {
+    class type final : public std::error_category {
+        char const* name() const noexcept override {
+            return "mongocxx::v1::write_combiner";
+        }
+
+        std::string message(int v) const noexcept override {
+            switch (static_cast<code>(v)) {
+                case code::zero:
+                    return "zero";
+                case code::invalid_max_batch_size:
+                    return "the maximum batch size must be greater than zero";
+                default:
+                    return std::string(this->name()) + ':' + std::to_string(v);
+            }
+        }
+
+        bool equivalent(int v, std::error_condition const& ec) const noexcept override {
+            if (ec.category() == v1::source_error_category()) {
+                using condition = v1::source_errc;
+
+                auto const source = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_batch_size:
+                        return source == condition::mongocxx;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            if (ec.category() == v1::type_error_category()) {
+                using condition = v1::type_errc;
+
+                auto const type = static_cast<condition>(ec.value());
+
+                switch (static_cast<code>(v)) {
+                    case code::invalid_max_batch_size:
+                        return type == condition::invalid_argument;
+
+                    case code::zero:
+                    default:
+                        return false;
+                }
+            }
+
+            return false;
+        }
+    };
+
+    static bsoncxx::immortal<type> const instance;
+
+    return instance.value();
+}
+
+// NOLINTBEGIN(cppcoreguidelines-owning-memory): owning void* for ABI stability.
+
+write_combiner::options::~options() {
+    delete impl::with(_impl);
+}
+
+write_combiner::options::options(options&& other) noexcept : _impl{exchange(other._impl, nullptr)} {}
+
+write_combiner::options& write_combiner::options::operator=(options&& other) noexcept {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, exchange(other._impl, nullptr)));
+    }
+
+    return *this;
+}
+
+write_combiner::options::options(options const& other) : _impl{new impl{impl::with(other)}} {}
+
+write_combiner::options& write_combiner::options::operator=(options const& other) {
+    if (this != &other) {
+        delete impl::with(exchange(_impl, new impl{impl::with(other)}));
+    }
+
+    return *this;
+}
+
+write_combiner::options::options() : _impl{new impl{}} {}
+
+// NOLINTEND(cppcoreguidelines-owning-memory)
+
+write_combiner::options& write_combiner::options::bypass_document_validation(bool v) {
+    impl::with(this)->_bypass_document_validation = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<bool> write_combiner::options::bypass_document_validation() const {
+    return impl::with(this)->_bypass_document_validation;
+}
+
+write_combiner::options& write_combiner::options::max_batch_size(std::size_t v) {
+    impl::with(this)->_max_batch_size = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::size_t> write_combiner::options::max_batch_size() const {
+    return impl::with(this)->_max_batch_size;
+}
+
+write_combiner::options& write_combiner::options::max_delay(std::chrono::microseconds v) {
+    impl::with(this)->_max_delay = v;
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<std::chrono::microseconds> write_combiner::options::max_delay() const {
+    return impl::with(this)->_max_delay;
+}
+
+write_combiner::options& write_combiner::options::write_concern(v1::write_concern v) {
+    impl::with(this)->_write_concern = std::move(v);
+    return *this;
+}
+
+bsoncxx::v1::stdx::optional<v1::write_concern> write_combiner::options::write_concern() const {
+    return impl::with(this)->_write_concern;
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -145,6 +145,7 @@ client::client(v_noabi::uri const& uri, options::client const& options) {
 void client::read_concern_deprecated(v_noabi::read_concern rc) {
     libmongoc::client_set_read_concern(
         v1::client::internal::as_mongoc(check_moved_from(_client)), v_noabi::read_concern::internal::as_mongoc(rc));
+    v1::client::internal::clear_handles(_client);
 }
 
 void client::read_concern(v_noabi::read_concern rc) {
@@ -160,6 +161,7 @@ v_noabi::read_concern client::read_concern() const {
 void client::read_preference_deprecated(v_noabi::read_preference rp) {
     libmongoc::client_set_read_prefs(
         v1::client::internal::as_mongoc(check_moved_from(_client)), v_noabi::read_preference::internal::as_mongoc(rp));
+    v1::client::internal::clear_handles(_client);
 }
 
 void client::read_preference(v_noabi::read_preference rp) {
@@ -179,6 +181,7 @@ v_noabi::uri client::uri() const {
 void client::write_concern_deprecated(v_noabi::write_concern wc) {
     libmongoc::client_set_write_concern(
         v1::client::internal::as_mongoc(check_moved_from(_client)), v_noabi::write_concern::internal::as_mongoc(wc));
+    v1::client::internal::clear_handles(_client);
 }
 
 void client::write_concern(v_noabi::write_concern wc) {
@@ -1440,7 +1440,7 @@ void collection::rename(
     }
 
     return rename_impl(
-        v1::collection::internal::as_mongoc(check_moved_from(_coll)),
+        v1::collection::internal::detach_for_rename(check_moved_from(_coll)),
         new_name.terminated().data(),
         drop_target_before_rename,
         doc.bson());
@@ -1460,15 +1460,14 @@ void collection::rename(
     v_noabi::client_session::internal::append_to(session, doc);
 
     return rename_impl(
-        v1::collection::internal::as_mongoc(check_moved_from(_coll)),
+        v1::collection::internal::detach_for_rename(check_moved_from(_coll)),
         new_name.terminated().data(),
         drop_target_before_rename,
         doc.bson());
 }
 
 void collection::read_concern(v_noabi::read_concern rc) {
-    libmongoc::collection_set_read_concern(
-        v1::collection::internal::as_mongoc(check_moved_from(_coll)), v_noabi::read_concern::internal::as_mongoc(rc));
+    return check_moved_from(_coll).read_concern(v_noabi::to_v1(std::move(rc)));
 }
 
 v_noabi::read_concern collection::read_concern() const {
@@ -1478,9 +1477,7 @@ v_noabi::read_concern collection::read_concern() const {
 }
 
 void collection::read_preference(v_noabi::read_preference rp) {
-    libmongoc::collection_set_read_prefs(
-        v1::collection::internal::as_mongoc(check_moved_from(_coll)),
-        v_noabi::read_preference::internal::as_mongoc(rp));
+    return check_moved_from(_coll).read_preference(v_noabi::to_v1(std::move(rp)));
 }
 
 v_noabi::read_preference collection::read_preference() const {
@@ -1803,8 +1800,7 @@ v_noabi::change_stream collection::watch(
 }
 
 void collection::write_concern(v_noabi::write_concern wc) {
-    libmongoc::collection_set_write_concern(
-        v1::collection::internal::as_mongoc(check_moved_from(_coll)), v_noabi::write_concern::internal::as_mongoc(wc));
+    return check_moved_from(_coll).write_concern(v_noabi::to_v1(std::move(wc)));
 }
 
 v_noabi::write_concern collection::write_concern() const {
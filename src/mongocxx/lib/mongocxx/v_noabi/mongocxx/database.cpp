@@ -443,7 +443,8 @@ v_noabi::gridfs::bucket database::gridfs_bucket(v_noabi::options::gridfs::bucket
         v_noabi::to_v1(std::move(files)),
         v_noabi::to_v1(std::move(chunks)),
         std::move(bucket_name),
-        default_chunk_size);
+        default_chunk_size,
+        std::string{d.name()});
 }
 
 namespace {
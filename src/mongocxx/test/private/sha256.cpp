@@ -0,0 +1,136 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/private/sha256.hh>
+
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+namespace mongocxx {
+
+namespace {
+
+using implementation = sha256::implementation;
+
+// Return a digest object which uses `impl`, or skip the current test case if `impl` is not supported by the CPU.
+sha256 make_digest(implementation impl) {
+    sha256 ret;
+
+    if (!ret.force(impl)) {
+        SKIP("The x86 SHA extensions are not supported by the current CPU");
+    }
+
+    return ret;
+}
+
+std::string digest_of(implementation impl, std::string const& input) {
+    auto digest = make_digest(impl);
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): stdlib vs. mongocxx compatibility.
+    digest.update(reinterpret_cast<std::uint8_t const*>(input.data()), input.size());
+
+    return sha256::to_hex(digest.finish());
+}
+
+} // namespace
+
+TEST_CASE("vectors", "[mongocxx][private][sha256]") {
+    INFO("accelerated: " << sha256::is_accelerated());
+
+    auto const impl = GENERATE(implementation::k_portable, implementation::k_shani);
+    CAPTURE(static_cast<int>(impl));
+
+    // FIPS 180-4 examples.
+    CHECK(digest_of(impl, "") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    CHECK(digest_of(impl, "abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    CHECK(
+        digest_of(impl, "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+        "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    CHECK(
+        digest_of(impl, std::string(1000000u, 'a')) ==
+        "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_CASE("padding", "[mongocxx][private][sha256]") {
+    auto const impl = GENERATE(implementation::k_portable, implementation::k_shani);
+    CAPTURE(static_cast<int>(impl));
+
+    // Message lengths around the block size and the padding boundary (55 and 56 bytes).
+    CHECK(digest_of(impl, std::string(55u, 'a')) == "9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318");
+    CHECK(digest_of(impl, std::string(56u, 'a')) == "b35439a4ac6f0948b6d6f9e3c6af0f5f590ce20f1bde7090ef7970686ec6738a");
+    CHECK(digest_of(impl, std::string(64u, 'a')) == "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb");
+}
+
+TEST_CASE("incremental", "[mongocxx][private][sha256]") {
+    std::vector<std::uint8_t> input(300u);
+
+    for (std::size_t i = 0u; i < input.size(); ++i) {
+        input[i] = static_cast<std::uint8_t>(i * 7u);
+    }
+
+    auto oneshot = make_digest(implementation::k_portable);
+    oneshot.update(input.data(), input.size());
+    auto const expected = oneshot.finish();
+
+    auto const impl = GENERATE(implementation::k_portable, implementation::k_shani);
+    auto const split = GENERATE(range(std::size_t{0}, std::size_t{300}, std::size_t{13}));
+
+    CAPTURE(static_cast<int>(impl));
+
+    auto digest = make_digest(impl);
+    digest.update(input.data(), split);
+    digest.update(input.data() + split, 0u);
+    digest.update(input.data() + split, input.size() - split);
+
+    CHECK(digest.finish() == expected);
+}
+
+TEST_CASE("finish", "[mongocxx][private][sha256]") {
+    sha256 digest;
+
+    auto const input = std::uint8_t{'x'};
+
+    digest.update(&input, 1u);
+    (void)digest.finish();
+
+    // The state is reset by `finish()`.
+    CHECK(sha256::to_hex(digest.finish()) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+}
+
+TEST_CASE("force", "[mongocxx][private][sha256]") {
+    sha256 digest;
+
+    CHECK(digest.force(implementation::k_portable));
+    CHECK(digest.force(implementation::k_shani) == sha256::is_accelerated());
+    CHECK_FALSE(digest.force(static_cast<implementation>(-1)));
+
+    // The forced implementation is preserved by `finish()`.
+    auto const input = std::uint8_t{'x'};
+
+    CHECK(digest.force(implementation::k_portable));
+    digest.update(&input, 1u);
+    (void)digest.finish();
+    digest.update(&input, 1u);
+
+    CHECK(sha256::to_hex(digest.finish()) == "2d711642b726b04401627ca9fbac32f5c8530fb1903cc4db02258717921a4881");
+}
+
+} // namespace mongocxx
@@ -0,0 +1,344 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/async_pool.hpp>
+
+//
+
+#include <mongocxx/v1/client.hpp>
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+// Note: libmongoc mocks are thread-local and are not visible to worker threads. These tests use an unmocked pool: no
+// connection to a server is required to acquire a client object, and no commands are executed.
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::async_pool::errc;
+
+TEST_CASE("error code", "[mongocxx][v1][async_pool][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::async_pool::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::async_pool"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::shutdown;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_worker_count) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_queue_capacity) == source_errc::mongocxx);
+        CHECK(make_error_code(code::shutdown) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_worker_count) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_queue_capacity) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::shutdown) == type_errc::runtime_error);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][async_pool][options]") {
+    async_pool::options const opts;
+
+    CHECK_FALSE(opts.worker_count().has_value());
+    CHECK_FALSE(opts.queue_capacity().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][async_pool][options]") {
+    async_pool::options opts;
+
+    opts.worker_count(3u).queue_capacity(5u);
+
+    auto const copy = opts;
+
+    CHECK(copy.worker_count() == std::size_t{3});
+    CHECK(copy.queue_capacity() == std::size_t{5});
+
+    auto const move = std::move(opts);
+
+    CHECK(move.worker_count() == std::size_t{3});
+    CHECK(move.queue_capacity() == std::size_t{5});
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][async_pool]") {
+    v1::pool pool;
+
+    SECTION("invalid_worker_count") {
+        CHECK_THROWS_WITH_CODE(
+            (async_pool{pool, async_pool::options{}.worker_count(0u)}), code::invalid_worker_count);
+    }
+
+    SECTION("invalid_queue_capacity") {
+        CHECK_THROWS_WITH_CODE(
+            (async_pool{pool, async_pool::options{}.queue_capacity(0u)}), code::invalid_queue_capacity);
+    }
+
+    SECTION("shutdown") {
+        async_pool ap{pool, async_pool::options{}.worker_count(1u)};
+
+        ap.shutdown();
+
+        CHECK(ap.pending() == 0u);
+        CHECK_THROWS_WITH_CODE(ap.post([](v1::client*, std::exception_ptr) {}), code::shutdown);
+        CHECK_THROWS_WITH_CODE(ap.try_post([](v1::client*, std::exception_ptr) {}), code::shutdown);
+        CHECK_THROWS_WITH_CODE(ap.submit([](v1::client&) {}), code::shutdown);
+    }
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][async_pool]") {
+    v1::pool pool;
+
+    async_pool source{pool, async_pool::options{}.worker_count(2u)};
+    async_pool target{pool, async_pool::options{}.worker_count(1u)};
+
+    REQUIRE(source.worker_count() == 2u);
+    REQUIRE(target.worker_count() == 1u);
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.worker_count() == 2u);
+        CHECK(move.submit([](v1::client&) { return 1; }).get() == 1);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.worker_count() == 2u);
+        CHECK(target.submit([](v1::client&) { return 1; }).get() == 1);
+    }
+}
+
+TEST_CASE("submit", "[mongocxx][v1][async_pool]") {
+    v1::pool pool;
+    async_pool ap{pool, async_pool::options{}.worker_count(4u)};
+
+    SECTION("value") {
+        auto res = ap.submit([](v1::client& client) -> bool { return static_cast<bool>(client); });
+
+        CHECK(res.get());
+    }
+
+    SECTION("void") {
+        std::atomic<int> count{0};
+
+        auto res = ap.submit([&](v1::client&) { ++count; });
+
+        res.get();
+        CHECK(count == 1);
+    }
+
+    SECTION("exception") {
+        auto res = ap.submit([](v1::client&) -> int { throw std::runtime_error{"task"}; });
+
+        CHECK_THROWS_AS(res.get(), std::runtime_error);
+    }
+
+    SECTION("many") {
+        std::atomic<int> count{0};
+        std::vector<std::future<int>> results;
+
+        for (int i = 0; i < 100; ++i) {
+            results.push_back(ap.submit([&count, i](v1::client&) {
+                ++count;
+                return i;
+            }));
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            CHECK(results[static_cast<std::size_t>(i)].get() == i);
+        }
+
+        CHECK(count == 100);
+    }
+}
+
+TEST_CASE("callback", "[mongocxx][v1][async_pool]") {
+    v1::pool pool;
+    async_pool ap{pool, async_pool::options{}.worker_count(2u)};
+
+    std::promise<int> promise;
+    auto res = promise.get_future();
+
+    ap.submit([](v1::client&) { return 123; }, [&](std::future<int> f) { promise.set_value(f.get()); });
+
+    CHECK(res.get() == 123);
+}
+
+TEST_CASE("continuation", "[mongocxx][v1][async_pool]") {
+    v1::pool pool{v1::uri{"mongodb://localhost:27017/?maxPoolSize=1"}};
+    async_pool ap{pool, async_pool::options{}.worker_count(1u)};
+
+    std::promise<bool> promise;
+    auto res = promise.get_future();
+
+    SECTION("post") {
+        ap.post(
+            [](v1::client* client, std::exception_ptr error) {
+                CHECK(client);
+                CHECK_FALSE(error);
+            },
+            [&] { promise.set_value(pool.try_acquire().has_value()); });
+    }
+
+    SECTION("submit") {
+        ap.submit([](v1::client&) {}, [&](std::future<void>) { promise.set_value(pool.try_acquire().has_value()); });
+    }
+
+    CHECK(res.get()); // The client object was released before the continuation.
+}
+
+TEST_CASE("post from worker", "[mongocxx][v1][async_pool]") {
+    v1::pool pool;
+    async_pool ap{pool, async_pool::options{}.worker_count(1u).queue_capacity(1u)};
+
+    std::atomic<int> count{0};
+
+    auto const task = [&count](v1::client*, std::exception_ptr) { ++count; };
+
+    // The only worker thread must not wait for itself to free a queue slot.
+    auto res = ap.submit([&](v1::client&) {
+        for (int i = 0; i < 3; ++i) {
+            ap.post(task);
+        }
+    });
+
+    res.get();
+
+    ap.shutdown(); // Drains the queue.
+
+    CHECK(count == 3);
+}
+
+TEST_CASE("wait_queue_timeout", "[mongocxx][v1][async_pool]") {
+    v1::pool pool{v1::uri{"mongodb://localhost:27017/?maxPoolSize=1&waitQueueTimeoutMS=1"}};
+    async_pool ap{pool, async_pool::options{}.worker_count(2u)};
+
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    // Hold the only client object until the second operation has failed to acquire one.
+    auto first = ap.submit([&started, released](v1::client&) {
+        started.set_value();
+        released.wait();
+    });
+
+    started.get_future().wait();
+
+    std::promise<std::future<void>> second_promise;
+    auto second = second_promise.get_future();
+
+    ap.submit([](v1::client&) {}, [&](std::future<void> f) {
+        second_promise.set_value(std::move(f));
+        release.set_value();
+    });
+
+    first.get();
+    CHECK_THROWS_WITH_CODE(second.get().get(), v1::pool::errc::wait_queue_timeout);
+}
+
+TEST_CASE("try_post", "[mongocxx][v1][async_pool]") {
+    v1::pool pool;
+    async_pool ap{pool, async_pool::options{}.worker_count(1u).queue_capacity(1u)};
+
+    std::promise<void> started;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    // Occupy the only worker thread.
+    auto first = ap.submit([&started, released](v1::client&) {
+        started.set_value();
+        released.wait();
+    });
+
+    started.get_future().wait();
+
+    std::atomic<int> count{0};
+    auto const task = [&count](v1::client* client, std::exception_ptr error) {
+        if (client && !error) {
+            ++count;
+        }
+    };
+
+    CHECK(ap.try_post(task));       // Occupy the only queue slot.
+    CHECK_FALSE(ap.try_post(task)); // Queue is full.
+    CHECK(ap.pending() == 2u);
+
+    release.set_value();
+    first.get();
+    ap.shutdown(); // Drains the queue.
+
+    CHECK(count == 1);
+    CHECK(ap.pending() == 0u);
+}
+
+} // namespace v1
+} // namespace mongocxx
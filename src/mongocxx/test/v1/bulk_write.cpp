@@ -35,6 +35,9 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string>
 #include <tuple>
 #include <utility>
 
@@ -1269,6 +1272,264 @@ TEST_CASE("append", "[mongocxx][v1][bulk_write]") {
     }
 }
 
+// A temporary `v1::hint` would not outlive a view-based operation.
+template <typename Op, typename Hint>
+using set_hint_expr = decltype(std::declval<Op&>().hint(std::declval<Hint>()));
+
+template <typename Op, typename Hint>
+struct has_hint_setter : bsoncxx::detail::is_detected<set_hint_expr, Op, Hint> {};
+
+static_assert(has_hint_setter<bulk_write::update_one_view, v1::hint const&>::value, "");
+static_assert(has_hint_setter<bulk_write::update_many_view, v1::hint const&>::value, "");
+static_assert(has_hint_setter<bulk_write::replace_one_view, v1::hint const&>::value, "");
+static_assert(has_hint_setter<bulk_write::delete_one_view, v1::hint const&>::value, "");
+static_assert(has_hint_setter<bulk_write::delete_many_view, v1::hint const&>::value, "");
+
+static_assert(!has_hint_setter<bulk_write::update_one_view, v1::hint>::value, "");
+static_assert(!has_hint_setter<bulk_write::update_many_view, v1::hint>::value, "");
+static_assert(!has_hint_setter<bulk_write::replace_one_view, v1::hint>::value, "");
+static_assert(!has_hint_setter<bulk_write::delete_one_view, v1::hint>::value, "");
+static_assert(!has_hint_setter<bulk_write::delete_many_view, v1::hint>::value, "");
+
+TEST_CASE("append views", "[mongocxx][v1][bulk_write]") {
+    identity_type id;
+    auto const identity = reinterpret_cast<mongoc_bulk_operation_t*>(&id);
+
+    auto destroy = libmongoc::bulk_operation_destroy.create_instance();
+    destroy
+        ->interpose([&](mongoc_bulk_operation_t* bulk) -> void {
+            if (bulk != identity) {
+                FAIL("unexpected mongoc_bulk_operation_t");
+            }
+        })
+        .forever();
+
+    auto bulk = v1::bulk_write::internal::make(identity);
+
+    scoped_bson const one{R"({"x": 1})"};
+    scoped_bson const two{R"({"y": 2})"};
+    scoped_bson const collation{R"({"locale": "en"})"};
+    scoped_bson const sort{R"({"z": -1})"};
+    scoped_bson const array_filters{R"([{"a": 1}])"};
+
+    // An index specification or an index name.
+    auto const is_index_name = GENERATE(false, true);
+    CAPTURE(is_index_name);
+
+    v1::hint const hint = is_index_name ? v1::hint{std::string{"x_1"}} : v1::hint{scoped_bson{R"({"x": 1})"}.value()};
+
+    // The referenced documents are passed to mongoc as-is.
+    auto const check_opts = [&](bson_t const* opts, std::initializer_list<char const*> fields) {
+        auto const doc = scoped_bson_view{opts}.view();
+
+        CHECK(static_cast<std::size_t>(std::distance(doc.begin(), doc.end())) == fields.size());
+
+        for (auto const field : fields) {
+            CAPTURE(field);
+            CHECK(doc[field]);
+        }
+
+        if (auto const e = doc["hint"]) {
+            CHECK(e.type_view() == hint.to_value());
+        }
+
+        if (auto const e = doc["collation"]) {
+            CHECK(e.get_document().value == collation.view());
+        }
+
+        if (auto const e = doc["sort"]) {
+            CHECK(e.get_document().value == sort.view());
+        }
+
+        if (auto const e = doc["upsert"]) {
+            CHECK(e.get_bool().value == true);
+        }
+
+        if (auto const e = doc["arrayFilters"]) {
+            CHECK(e.get_array().value == array_filters.array_view());
+        }
+    };
+
+    op_mocks mocks;
+
+    int count = 0;
+
+    mocks.insert_one->interpose(
+        [&](mongoc_bulk_operation_t* ptr, bson_t const* document, bson_t const* opts, bson_error_t* error) -> bool {
+            CHECK(ptr == identity);
+            CHECK(scoped_bson_view{document}.data() == one.data());
+            CHECK(opts == nullptr);
+            CHECK(error != nullptr);
+            ++count;
+            return true;
+        });
+
+    mocks.delete_one->interpose(
+        [&](mongoc_bulk_operation_t* ptr, bson_t const* selector, bson_t const* opts, bson_error_t* error) -> bool {
+            CHECK(ptr == identity);
+            CHECK(scoped_bson_view{selector}.data() == one.data());
+            check_opts(opts, {"collation", "hint"});
+            CHECK(error != nullptr);
+            ++count;
+            return true;
+        });
+
+    mocks.delete_many->interpose(
+        [&](mongoc_bulk_operation_t* ptr, bson_t const* selector, bson_t const* opts, bson_error_t* error) -> bool {
+            CHECK(ptr == identity);
+            CHECK(scoped_bson_view{selector}.data() == one.data());
+            check_opts(opts, {"collation", "hint"});
+            CHECK(error != nullptr);
+            ++count;
+            return true;
+        });
+
+    mocks.update_one->interpose([&](mongoc_bulk_operation_t* ptr,
+                                    bson_t const* selector,
+                                    bson_t const* document,
+                                    bson_t const* opts,
+                                    bson_error_t* error) -> bool {
+        CHECK(ptr == identity);
+        CHECK(scoped_bson_view{selector}.data() == one.data());
+        CHECK(scoped_bson_view{document}.data() == two.data());
+        check_opts(opts, {"collation", "hint", "sort", "upsert", "arrayFilters"});
+        CHECK(error != nullptr);
+        ++count;
+        return true;
+    });
+
+    mocks.update_many->interpose([&](mongoc_bulk_operation_t* ptr,
+                                     bson_t const* selector,
+                                     bson_t const* document,
+                                     bson_t const* opts,
+                                     bson_error_t* error) -> bool {
+        CHECK(ptr == identity);
+        CHECK(scoped_bson_view{selector}.data() == one.data());
+        CHECK(scoped_bson_view{document}.data() == two.data());
+        check_opts(opts, {"collation", "hint", "upsert", "arrayFilters"});
+        CHECK(error != nullptr);
+        ++count;
+        return true;
+    });
+
+    mocks.replace_one->interpose([&](mongoc_bulk_operation_t* ptr,
+                                     bson_t const* selector,
+                                     bson_t const* document,
+                                     bson_t const* opts,
+                                     bson_error_t* error) -> bool {
+        CHECK(ptr == identity);
+        CHECK(scoped_bson_view{selector}.data() == one.data());
+        CHECK(scoped_bson_view{document}.data() == two.data());
+        check_opts(opts, {"collation", "hint", "sort", "upsert"});
+        CHECK(error != nullptr);
+        ++count;
+        return true;
+    });
+
+    CHECK(bulk.empty());
+
+    SECTION("insert_one") {
+        CHECK_NOTHROW(bulk.append(bulk_write::insert_one_view{one.view()}));
+    }
+
+    SECTION("delete_one") {
+        CHECK_NOTHROW(bulk.append(bulk_write::delete_one_view{one.view()}.collation(collation.view()).hint(hint)));
+    }
+
+    SECTION("delete_many") {
+        CHECK_NOTHROW(bulk.append(bulk_write::delete_many_view{one.view()}.collation(collation.view()).hint(hint)));
+    }
+
+    SECTION("update_one") {
+        CHECK_NOTHROW(bulk.append(bulk_write::update_one_view{one.view(), two.view()}
+                                      .collation(collation.view())
+                                      .hint(hint)
+                                      .sort(sort.view())
+                                      .upsert(true)
+                                      .array_filters(array_filters.array_view())));
+    }
+
+    SECTION("update_many") {
+        CHECK_NOTHROW(bulk.append(bulk_write::update_many_view{one.view(), two.view()}
+                                      .collation(collation.view())
+                                      .hint(hint)
+                                      .upsert(true)
+                                      .array_filters(array_filters.array_view())));
+    }
+
+    SECTION("replace_one") {
+        CHECK_NOTHROW(bulk.append(bulk_write::replace_one_view{one.view(), two.view()}
+                                      .collation(collation.view())
+                                      .hint(hint)
+                                      .sort(sort.view())
+                                      .upsert(true)));
+    }
+
+    CHECK(count == 1);
+    CHECK_FALSE(bulk.empty());
+}
+
+TEST_CASE("views", "[mongocxx][v1][bulk_write]") {
+    scoped_bson const one{R"({"x": 1})"};
+    scoped_bson const two{R"({"y": 2})"};
+
+    SECTION("insert_one") {
+        bulk_write::insert_one_view const op{one.view()};
+
+        CHECK(op.value.data() == one.data());
+        CHECK(op.document().data() == one.data());
+    }
+
+    SECTION("update_one") {
+        bulk_write::update_one_view const op{one.view(), two.array_view()};
+
+        CHECK(op.filter().data() == one.data());
+        CHECK(op.update().data() == two.data());
+        CHECK_FALSE(op.collation().has_value());
+        CHECK_FALSE(op.hint().has_value());
+        CHECK_FALSE(op.sort().has_value());
+        CHECK_FALSE(op.upsert().has_value());
+        CHECK_FALSE(op.array_filters().has_value());
+    }
+
+    SECTION("update_many") {
+        bulk_write::update_many_view const op{one.view(), two.view()};
+
+        CHECK(op.filter().data() == one.data());
+        CHECK(op.update().data() == two.data());
+        CHECK_FALSE(op.collation().has_value());
+        CHECK_FALSE(op.hint().has_value());
+        CHECK_FALSE(op.upsert().has_value());
+        CHECK_FALSE(op.array_filters().has_value());
+    }
+
+    SECTION("replace_one") {
+        bulk_write::replace_one_view const op{one.view(), two.view()};
+
+        CHECK(op.filter().data() == one.data());
+        CHECK(op.replacement().data() == two.data());
+        CHECK_FALSE(op.collation().has_value());
+        CHECK_FALSE(op.hint().has_value());
+        CHECK_FALSE(op.sort().has_value());
+        CHECK_FALSE(op.upsert().has_value());
+    }
+
+    SECTION("delete_one") {
+        bulk_write::delete_one_view const op{one.view()};
+
+        CHECK(op.filter().data() == one.data());
+        CHECK_FALSE(op.collation().has_value());
+        CHECK_FALSE(op.hint().has_value());
+    }
+
+    SECTION("delete_many") {
+        auto const op = bulk_write::delete_many_view{one.view()}.hint(bsoncxx::v1::types::b_string{"abc"});
+
+        CHECK(op.filter().data() == one.data());
+        CHECK(op.hint() == bsoncxx::v1::types::b_string{"abc"});
+    }
+}
+
 TEST_CASE("execute", "[mongocxx][v1][bulk_write]") {
     identity_type id;
 
@@ -0,0 +1,451 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/change_stream_multiplexer.hh>
+
+//
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+// Note: no server is listening on the port used by these tests. The upstream change streams are never established:
+// events are only delivered via `change_stream_multiplexer::internal::publish()`.
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::change_stream_multiplexer::errc;
+
+namespace {
+
+v1::uri unreachable() {
+    return v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"};
+}
+
+change_stream_multiplexer::options fast() {
+    return change_stream_multiplexer::options{}.change_stream_options(
+        v1::change_stream::options{}.max_await_time(std::chrono::milliseconds{1}));
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][change_stream_multiplexer][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::change_stream_multiplexer::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::change_stream_multiplexer"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_filter;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_queue_size) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_filter) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_queue_size) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_filter) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][change_stream_multiplexer][options]") {
+    change_stream_multiplexer::options const opts;
+
+    CHECK_FALSE(opts.change_stream_options().has_value());
+    CHECK_FALSE(opts.queue_size().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][change_stream_multiplexer][options]") {
+    change_stream_multiplexer::options opts;
+
+    opts.change_stream_options(v1::change_stream::options{}.batch_size(2)).queue_size(3u);
+
+    auto const copy = opts;
+
+    REQUIRE(copy.change_stream_options().has_value());
+    CHECK(copy.change_stream_options()->batch_size() == 2);
+    CHECK(copy.queue_size() == std::size_t{3});
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][change_stream_multiplexer]") {
+    v1::pool pool{unreachable()};
+
+    CHECK_THROWS_WITH_CODE((change_stream_multiplexer{pool, fast().queue_size(0u)}), code::invalid_queue_size);
+
+    change_stream_multiplexer mux{pool, fast()};
+
+    auto const filter = GENERATE(
+        R"({"$where": "true"})",
+        R"({"x": {"$regex": "a"}})",
+        R"({"x": {"$in": 1}})",
+        R"({"x": {"$not": 1}})",
+        R"({"$or": {"x": 1}})",
+        R"({"$and": [1]})",
+        R"({"$nor": [{"x": {"$size": 1}}]})",
+        R"({"$and": []})",
+        R"({"$or": []})",
+        R"({"$nor": []})",
+        R"({"$or": [{"x": 1}, {"$and": []}]})",
+        R"({"x.2147483648": 1})",
+        R"({"x.99999999999999999999": 1})");
+
+    CAPTURE(filter);
+
+    CHECK_THROWS_WITH_CODE(mux.subscribe("db", "coll", scoped_bson{filter}.view()), code::invalid_filter);
+    CHECK(mux.upstream_count() == 0u);
+}
+
+TEST_CASE("matches", "[mongocxx][v1][change_stream_multiplexer]") {
+    scoped_bson const doc{R"({
+        "operationType": "insert",
+        "fullDocument": {
+            "a": 1,
+            "b": 2.5,
+            "s": "abc",
+            "n": null,
+            "tags": ["x", "y"],
+            "sub": {"c": {"$numberLong": "3"}},
+            "items": [{"q": 1}, {"q": 5}]
+        }
+    })"};
+
+    struct testcase {
+        char const* filter;
+        bool expected;
+    };
+
+    auto const tc = GENERATE(
+        values<testcase>({
+            {R"({})", true},
+            {R"({"operationType": "insert"})", true},
+            {R"({"operationType": "delete"})", false},
+            {R"({"fullDocument.a": 1})", true},
+            {R"({"fullDocument.a": 1.0})", true},
+            {R"({"fullDocument.a": {"$numberLong": "1"}})", true},
+            {R"({"fullDocument.a": "1"})", false},
+            {R"({"fullDocument.sub.c": 3})", true},
+            {R"({"fullDocument.sub": {"c": {"$numberLong": "3"}}})", true},
+            {R"({"fullDocument.missing": null})", true},
+            {R"({"fullDocument.n": null})", true},
+            {R"({"fullDocument.tags": "x"})", true},
+            {R"({"fullDocument.tags": "z"})", false},
+            {R"({"fullDocument.tags.1": "y"})", true},
+            {R"({"fullDocument.items.1.q": 5})", true},
+            {R"({"fullDocument.items.2.q": null})", true},
+            {R"({"fullDocument.tags.2147483647": null})", true},
+            {R"({"fullDocument.items.q": 5})", false},
+            {R"({"fullDocument.items.q": null})", false},
+            {R"({"fullDocument.items.q": {"$exists": false}})", false},
+            {R"({"$nor": [{"fullDocument.items.q": 5}]})", false},
+            {R"({"$or": [{"fullDocument.a": 1}, {"fullDocument.tags.x": "y"}]})", false},
+            {R"({"fullDocument.a": {"$eq": 1}})", true},
+            {R"({"fullDocument.a": {"$ne": 1}})", false},
+            {R"({"fullDocument.missing": {"$ne": 1}})", true},
+            {R"({"fullDocument.b": {"$gt": 2}})", true},
+            {R"({"fullDocument.b": {"$gt": 2.5}})", false},
+            {R"({"fullDocument.b": {"$gte": 2.5}})", true},
+            {R"({"fullDocument.b": {"$lt": 3, "$gt": 2}})", true},
+            {R"({"fullDocument.b": {"$lte": 2}})", false},
+            {R"({"fullDocument.b": {"$gt": "2"}})", false},
+            {R"({"fullDocument.s": {"$gt": "abb"}})", true},
+            {R"({"fullDocument.s": {"$lt": "abb"}})", false},
+            {R"({"fullDocument.missing": {"$lt": 1}})", false},
+            {R"({"fullDocument.a": {"$in": [0, 1]}})", true},
+            {R"({"fullDocument.a": {"$in": [0, 2]}})", false},
+            {R"({"fullDocument.tags": {"$in": ["z", "y"]}})", true},
+            {R"({"fullDocument.a": {"$nin": [0, 2]}})", true},
+            {R"({"fullDocument.a": {"$exists": true}})", true},
+            {R"({"fullDocument.a": {"$exists": false}})", false},
+            {R"({"fullDocument.missing": {"$exists": 0}})", true},
+            {R"({"fullDocument.a": {"$not": {"$gt": 0}}})", false},
+            {R"({"fullDocument.a": {"$not": {"$gt": 1}}})", true},
+            {R"({"$and": [{"fullDocument.a": 1}, {"fullDocument.s": "abc"}]})", true},
+            {R"({"$and": [{"fullDocument.a": 1}, {"fullDocument.s": "xyz"}]})", false},
+            {R"({"$or": [{"fullDocument.a": 2}, {"fullDocument.s": "abc"}]})", true},
+            {R"({"$or": [{"fullDocument.a": 2}, {"fullDocument.s": "xyz"}]})", false},
+            {R"({"$nor": [{"fullDocument.a": 2}, {"fullDocument.s": "xyz"}]})", true},
+            {R"({"$nor": [{"fullDocument.a": 1}]})", false},
+            {R"({"operationType": {"$in": ["insert", "update"]}, "fullDocument.a": {"$gte": 1}})", true},
+        }));
+
+    CAPTURE(tc.filter);
+
+    scoped_bson const filter{tc.filter};
+
+    REQUIRE(change_stream_multiplexer::internal::is_valid(filter.view()));
+    CHECK(change_stream_multiplexer::internal::matches(filter.view(), doc.view()) == tc.expected);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][change_stream_multiplexer]") {
+    v1::pool pool{unreachable()};
+
+    change_stream_multiplexer source{pool, fast()};
+    change_stream_multiplexer target{pool, fast()};
+
+    auto sub = source.subscribe("db", "coll");
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.upstream_count() == 1u);
+        CHECK_FALSE(sub.closed());
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.upstream_count() == 1u);
+        CHECK_FALSE(sub.closed());
+    }
+
+    SECTION("subscription") {
+        auto move = std::move(sub);
+
+        CHECK_FALSE(sub);
+        REQUIRE(move);
+        CHECK_FALSE(move.try_next().has_value());
+    }
+}
+
+TEST_CASE("publish", "[mongocxx][v1][change_stream_multiplexer]") {
+    v1::pool pool{unreachable()};
+    change_stream_multiplexer mux{pool, fast()};
+
+    auto all = mux.subscribe("db", "coll");
+    auto inserts = mux.subscribe("db", "coll", scoped_bson{R"({"operationType": "insert"})"}.view());
+    auto large = mux.subscribe("db", "coll", scoped_bson{R"({"fullDocument.x": {"$gt": 10}})"}.view());
+    auto other = mux.subscribe("db", "other");
+
+    CHECK(mux.upstream_count() == 2u);
+    CHECK_FALSE(mux.resume_token("db", "coll").has_value());
+    CHECK_FALSE(mux.resume_token("db", "missing").has_value());
+
+    scoped_bson const a{R"({"_id": {"_data": "a"}, "operationType": "insert", "fullDocument": {"x": 1}})"};
+    scoped_bson const b{R"({"_id": {"_data": "b"}, "operationType": "update"})"};
+
+    change_stream_multiplexer::internal::publish(mux, "db", "coll", a.view());
+    change_stream_multiplexer::internal::publish(mux, "db", "coll", b.view());
+
+    {
+        auto const token = mux.resume_token("db", "coll");
+        REQUIRE(token.has_value());
+        CHECK(token->view() == scoped_bson{R"({"_data": "b"})"}.view());
+    }
+
+    SECTION("fan-out") {
+        auto const first = all.try_next();
+        auto const second = inserts.try_next();
+
+        REQUIRE(first.has_value());
+        REQUIRE(second.has_value());
+
+        // Both subscriptions share the same buffer.
+        CHECK(first->view() == a.view());
+        CHECK(first->view().data() == second->view().data());
+
+        auto const third = all.try_next();
+        REQUIRE(third.has_value());
+        CHECK(third->view() == b.view());
+
+        CHECK_FALSE(all.try_next().has_value());
+        CHECK_FALSE(inserts.try_next().has_value());
+    }
+
+    SECTION("filter") {
+        CHECK_FALSE(large.try_next().has_value());
+        CHECK_FALSE(other.try_next().has_value());
+
+        scoped_bson const c{R"({"_id": {"_data": "c"}, "operationType": "insert", "fullDocument": {"x": 11}})"};
+
+        change_stream_multiplexer::internal::publish(mux, "db", "coll", c.view());
+
+        auto const event = large.next(std::chrono::milliseconds{1});
+        REQUIRE(event.has_value());
+        CHECK(event->view() == c.view());
+    }
+
+    SECTION("timeout") {
+        CHECK_FALSE(other.next(std::chrono::milliseconds{1}).has_value());
+    }
+
+    SECTION("unsubscribe") {
+        { auto const discard = std::move(large); }
+
+        change_stream_multiplexer::internal::publish(mux, "db", "coll", a.view());
+
+        CHECK(mux.upstream_count() == 2u);
+    }
+
+    SECTION("invalidate") {
+        change_stream_multiplexer::internal::publish(
+            mux, "db", "other", scoped_bson{R"({"_id": {"_data": "i"}, "operationType": "invalidate"})"}.view());
+
+        auto const event = other.try_next();
+        REQUIRE(event.has_value());
+        CHECK(event->view()["operationType"].get_string().value == "invalidate");
+
+        auto const token = mux.resume_token("db", "other");
+        REQUIRE(token.has_value());
+        CHECK(token->view() == scoped_bson{R"({"_data": "i"})"}.view());
+    }
+}
+
+TEST_CASE("close", "[mongocxx][v1][change_stream_multiplexer]") {
+    v1::pool pool{unreachable()};
+    change_stream_multiplexer mux{pool, fast()};
+
+    auto sub = mux.subscribe("db", "coll");
+    auto other = mux.subscribe("db", "other");
+
+    CHECK(mux.upstream_count() == 2u);
+
+    scoped_bson const a{R"({"_id": {"_data": "a"}, "operationType": "insert"})"};
+
+    change_stream_multiplexer::internal::publish(mux, "db", "coll", a.view());
+    change_stream_multiplexer::internal::close(
+        mux, "db", "coll", std::make_exception_ptr(std::runtime_error{"non-resumable"}));
+
+    CHECK(sub.closed());
+    CHECK_FALSE(other.closed());
+    CHECK(mux.upstream_count() == 1u);
+
+    // Events queued before the error are still delivered.
+    auto const event = sub.try_next();
+    REQUIRE(event.has_value());
+    CHECK(event->view() == a.view());
+
+    CHECK_THROWS_WITH(sub.try_next(), "non-resumable");
+    CHECK_THROWS_WITH(sub.next(std::chrono::milliseconds{1}), "non-resumable");
+
+    // A new subscription opens a new upstream change stream.
+    auto const resubscribed = mux.subscribe("db", "coll");
+
+    CHECK(mux.upstream_count() == 2u);
+    CHECK_FALSE(resubscribed.closed());
+    CHECK_FALSE(mux.resume_token("db", "coll").has_value());
+}
+
+TEST_CASE("teardown", "[mongocxx][v1][change_stream_multiplexer]") {
+    v1::pool pool{unreachable()};
+    change_stream_multiplexer mux{pool, fast()};
+
+    auto const other = mux.subscribe("db", "other");
+
+    { auto const discard = mux.subscribe("db", "coll"); }
+
+    // The upstream change stream is closed by its watcher.
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+
+    while (mux.upstream_count() != 1u && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    CHECK(mux.upstream_count() == 1u);
+    CHECK_FALSE(other.closed());
+
+    auto const sub = mux.subscribe("db", "coll");
+
+    CHECK(mux.upstream_count() == 2u);
+    CHECK_FALSE(sub.closed());
+}
+
+TEST_CASE("queue_size", "[mongocxx][v1][change_stream_multiplexer]") {
+    v1::pool pool{unreachable()};
+
+    change_stream_multiplexer::subscription sub = [&] {
+        change_stream_multiplexer mux{pool, fast().queue_size(2u)};
+
+        auto ret = mux.subscribe("db", "coll");
+
+        change_stream_multiplexer::internal::publish(mux, "db", "coll", scoped_bson{R"({"x": 1})"}.view());
+        change_stream_multiplexer::internal::publish(mux, "db", "coll", scoped_bson{R"({"x": 2})"}.view());
+
+        CHECK_FALSE(ret.closed());
+
+        return ret;
+    }();
+
+    // Queued events are still delivered after the multiplexer is destroyed.
+    CHECK(sub.closed());
+    CHECK(sub.try_next().has_value());
+    CHECK(sub.next(std::chrono::milliseconds{1}).has_value());
+    CHECK_FALSE(sub.next(std::chrono::hours{1}).has_value());
+}
+
+} // namespace v1
+} // namespace mongocxx
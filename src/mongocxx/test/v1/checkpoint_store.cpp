@@ -0,0 +1,198 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/checkpoint_store.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::checkpoint_store::errc;
+
+namespace {
+
+// Remove the checkpoint file (and its temporary file) on construction and destruction.
+struct scoped_path {
+    std::string path;
+
+    explicit scoped_path(std::string p) : path{std::move(p)} {
+        this->remove();
+    }
+
+    ~scoped_path() {
+        this->remove();
+    }
+
+    scoped_path(scoped_path&&) = delete;
+    scoped_path& operator=(scoped_path&&) = delete;
+    scoped_path(scoped_path const&) = delete;
+    scoped_path& operator=(scoped_path const&) = delete;
+
+    void remove() const {
+        (void)std::remove(path.c_str());
+        (void)std::remove((path + ".tmp").c_str());
+    }
+};
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][checkpoint_store][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::checkpoint_store::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::checkpoint_store"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_checkpoint;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_checkpoint) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_checkpoint) == type_errc::runtime_error);
+    }
+}
+
+TEST_CASE("file", "[mongocxx][v1][checkpoint_store]") {
+    scoped_path const path{"mongocxx-test-v1-checkpoint_store.token"};
+
+    file_checkpoint_store store{path.path};
+
+    SECTION("missing") {
+        CHECK_FALSE(store.load().has_value());
+    }
+
+    SECTION("save") {
+        scoped_bson const a{R"({"_data": "a"})"};
+        scoped_bson const b{R"({"_data": "b"})"};
+
+        store.save(a.view());
+
+        {
+            auto const token = store.load();
+            REQUIRE(token.has_value());
+            CHECK(token->view() == a.view());
+        }
+
+        store.save(b.view());
+
+        {
+            auto const token = file_checkpoint_store{path.path}.load();
+            REQUIRE(token.has_value());
+            CHECK(token->view() == b.view());
+        }
+
+        CHECK_FALSE(std::ifstream{path.path + ".tmp"}.is_open());
+    }
+
+    SECTION("invalid") {
+        auto const contents = GENERATE(values<std::string>({"", "x", std::string("\x10\x00\x00\x00\x00", 5u)}));
+
+        CAPTURE(contents.size());
+
+        {
+            std::ofstream file{path.path, std::ios::binary};
+            file << contents;
+        }
+
+        CHECK_THROWS_WITH_CODE(store.load(), code::invalid_checkpoint);
+    }
+
+    SECTION("move") {
+        auto move = std::move(store);
+
+        CHECK_FALSE(store);
+        REQUIRE(move);
+        CHECK_FALSE(move.load().has_value());
+    }
+}
+
+TEST_CASE("collection", "[mongocxx][v1][checkpoint_store]") {
+    v1::pool pool{v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"}};
+
+    collection_checkpoint_store store{pool, "db", "checkpoints", "key"};
+
+    REQUIRE(store);
+
+    // No server is listening on the port.
+    CHECK_THROWS_AS(store.load(), v1::exception);
+    CHECK_THROWS_AS(store.save(scoped_bson{R"({"_data": "a"})"}.view()), v1::exception);
+
+    auto move = std::move(store);
+
+    CHECK_FALSE(store);
+    CHECK(move);
+}
+
+} // namespace v1
+} // namespace mongocxx
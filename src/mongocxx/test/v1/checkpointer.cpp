@@ -0,0 +1,376 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/checkpointer.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/change_stream.hpp>
+#include <mongocxx/v1/checkpoint_store.hpp>
+#include <mongocxx/v1/exception.hpp>
+
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::checkpointer::errc;
+
+namespace {
+
+// Records every save. May be invoked on the background thread of the checkpointer.
+class fake_store : public checkpoint_store {
+   public:
+    mutable std::mutex mutex;
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> token;
+    std::size_t saves = 0u;
+    std::size_t attempts = 0u;
+    bool fail = false;
+
+    bsoncxx::v1::stdx::optional<bsoncxx::v1::document::value> load() override {
+        std::lock_guard<std::mutex> lock{mutex};
+        return token;
+    }
+
+    void save(bsoncxx::v1::document::view v) override {
+        std::lock_guard<std::mutex> lock{mutex};
+
+        ++attempts;
+
+        if (fail) {
+            throw std::runtime_error{"fail"};
+        }
+
+        token.emplace(v);
+        ++saves;
+    }
+
+    std::size_t get_saves() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        return saves;
+    }
+
+    std::size_t get_attempts() const {
+        std::lock_guard<std::mutex> lock{mutex};
+        return attempts;
+    }
+
+    // Wait for the background thread of the checkpointer.
+    template <typename Pred>
+    bool wait_for(Pred pred) const {
+        for (int i = 0; i < 1000; ++i) {
+            if (pred()) {
+                return true;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+
+        return false;
+    }
+};
+
+checkpointer::options slow() {
+    return checkpointer::options{}.flush_interval(std::chrono::hours{1});
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][checkpointer][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::checkpointer::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::checkpointer"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_flush_count;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_flush_interval) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_flush_count) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_flush_interval) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_flush_count) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][checkpointer][options]") {
+    checkpointer::options const opts;
+
+    CHECK_FALSE(opts.flush_count().has_value());
+    CHECK_FALSE(opts.flush_interval().has_value());
+    CHECK_FALSE(opts.start_after().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][checkpointer][options]") {
+    checkpointer::options opts;
+
+    opts.flush_count(1u).flush_interval(std::chrono::milliseconds{2}).start_after(true);
+
+    auto const copy = opts;
+
+    CHECK(copy.flush_count() == std::size_t{1});
+    CHECK(copy.flush_interval() == std::chrono::milliseconds{2});
+    CHECK(copy.start_after() == true);
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][checkpointer]") {
+    fake_store store;
+
+    CHECK_THROWS_WITH_CODE(
+        (checkpointer{store, checkpointer::options{}.flush_interval(std::chrono::milliseconds{0})}),
+        code::invalid_flush_interval);
+    CHECK_THROWS_WITH_CODE((checkpointer{store, checkpointer::options{}.flush_count(0u)}), code::invalid_flush_count);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][checkpointer]") {
+    fake_store store;
+
+    checkpointer source{store, slow()};
+    checkpointer target{store, slow()};
+
+    source.update(scoped_bson{R"({"_data": "a"})"}.view());
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        move.flush();
+        CHECK(store.get_saves() == 1u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        target.flush();
+        CHECK(store.get_saves() == 1u);
+    }
+}
+
+TEST_CASE("update", "[mongocxx][v1][checkpointer]") {
+    fake_store store;
+
+    scoped_bson const a{R"({"_data": "a"})"};
+    scoped_bson const b{R"({"_data": "b"})"};
+    scoped_bson const c{R"({"_data": "c"})"};
+
+    SECTION("coalesce") {
+        checkpointer cp{store, slow()};
+
+        cp.update(a.view());
+        cp.update(b.view());
+        cp.update(c.view());
+
+        CHECK(store.get_saves() == 0u);
+        CHECK_FALSE(cp.saved().has_value());
+
+        cp.flush();
+
+        CHECK(store.get_saves() == 1u);
+        REQUIRE(store.token.has_value());
+        CHECK(store.token->view() == c.view());
+
+        auto const saved = cp.saved();
+        REQUIRE(saved.has_value());
+        CHECK(saved->view() == c.view());
+
+        // Nothing to save.
+        cp.flush();
+        CHECK(store.get_saves() == 1u);
+    }
+
+    SECTION("flush_count") {
+        checkpointer cp{store, slow().flush_count(2u)};
+
+        cp.update(a.view());
+        cp.update(b.view());
+
+        CHECK(store.wait_for([&] { return store.get_saves() == 1u; }));
+        CHECK(store.load()->view() == b.view());
+    }
+
+    SECTION("flush_interval") {
+        checkpointer cp{store, checkpointer::options{}.flush_interval(std::chrono::milliseconds{1})};
+
+        cp.update(a.view());
+
+        CHECK(store.wait_for([&] { return store.get_saves() == 1u; }));
+        CHECK(store.load()->view() == a.view());
+    }
+
+    SECTION("destroy") {
+        {
+            checkpointer cp{store, slow()};
+            cp.update(a.view());
+        }
+
+        CHECK(store.get_saves() == 1u);
+        CHECK(store.load()->view() == a.view());
+    }
+
+    SECTION("error") {
+        checkpointer cp{store, slow()};
+
+        cp.update(a.view());
+
+        store.fail = true;
+        CHECK_THROWS_AS(cp.flush(), std::runtime_error);
+        CHECK_FALSE(cp.saved().has_value());
+
+        // Retried by the next attempt.
+        store.fail = false;
+        cp.flush();
+        CHECK(store.get_saves() == 1u);
+        CHECK(cp.saved()->view() == a.view());
+    }
+
+    SECTION("background error") {
+        store.fail = true;
+
+        checkpointer cp{store, checkpointer::options{}.flush_interval(std::chrono::milliseconds{1})};
+
+        cp.update(a.view());
+
+        CHECK(store.wait_for([&] { return store.get_attempts() >= 1u; }));
+
+        {
+            std::lock_guard<std::mutex> lock{store.mutex};
+            store.fail = false;
+        }
+
+        // The latest resume token is saved before the error on the background thread is reported.
+        CHECK_THROWS_AS(cp.flush(), std::runtime_error);
+        CHECK(store.wait_for([&] { return store.get_saves() == 1u; }));
+
+        CHECK_NOTHROW(cp.flush());
+    }
+}
+
+TEST_CASE("configure", "[mongocxx][v1][checkpointer]") {
+    fake_store store;
+
+    scoped_bson const a{R"({"_data": "a"})"};
+    scoped_bson const b{R"({"_data": "b"})"};
+
+    SECTION("empty") {
+        checkpointer cp{store, slow()};
+
+        v1::change_stream::options opts;
+        opts.resume_after(bsoncxx::v1::document::value{b.view()});
+
+        CHECK_FALSE(cp.configure(opts));
+        CHECK(opts.resume_after() == b.view());
+    }
+
+    store.token.emplace(a.view());
+
+    SECTION("resume_after") {
+        checkpointer cp{store, slow()};
+
+        v1::change_stream::options opts;
+        opts.start_after(bsoncxx::v1::document::value{b.view()});
+
+        REQUIRE(cp.configure(opts));
+        CHECK(opts.resume_after() == a.view());
+        CHECK_FALSE(opts.start_after().has_value());
+
+        auto const saved = cp.saved();
+        REQUIRE(saved.has_value());
+        CHECK(saved->view() == a.view());
+    }
+
+    SECTION("start_after") {
+        checkpointer cp{store, slow().start_after(true)};
+
+        v1::change_stream::options opts;
+        opts.resume_after(bsoncxx::v1::document::value{b.view()});
+
+        REQUIRE(cp.configure(opts));
+        CHECK(opts.start_after() == a.view());
+        CHECK_FALSE(opts.resume_after().has_value());
+    }
+
+    SECTION("latest") {
+        checkpointer cp{store, slow()};
+
+        cp.update(b.view());
+
+        v1::change_stream::options opts;
+
+        REQUIRE(cp.configure(opts));
+        CHECK(opts.resume_after() == b.view());
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
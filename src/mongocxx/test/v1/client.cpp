@@ -19,12 +19,14 @@
 #include <mongocxx/v1/apm.hpp>
 #include <mongocxx/v1/exception.hpp>
 #include <mongocxx/v1/pipeline.hpp>
+#include <mongocxx/v1/read_concern.hpp>
 #include <mongocxx/v1/server_api.hpp>
 
 #include <mongocxx/v1/auto_encryption_options.hh>
 #include <mongocxx/v1/change_stream.hh>
 #include <mongocxx/v1/client_bulk_write.hh>
 #include <mongocxx/v1/client_session.hh>
+#include <mongocxx/v1/collection.hh>
 #include <mongocxx/v1/cursor.hh>
 #include <mongocxx/v1/database.hh>
 #include <mongocxx/v1/pool.hh>
@@ -1283,6 +1285,216 @@ TEST_CASE("database", "[mongocxx][v1][client]") {
     CHECK(v1::database::internal::as_mongoc(db) == database_id);
 }
 
+TEST_CASE("database handles", "[mongocxx][v1][client]") {
+    client_mocks_type mocks;
+
+    identity_type database_identity;
+    identity_type database_copy_identity;
+    identity_type collection_identity;
+    identity_type collection_copy_identity;
+
+    auto const database_id = reinterpret_cast<mongoc_database_t*>(&database_identity);
+    auto const database_copy_id = reinterpret_cast<mongoc_database_t*>(&database_copy_identity);
+    auto const collection_id = reinterpret_cast<mongoc_collection_t*>(&collection_identity);
+    auto const collection_copy_id = reinterpret_cast<mongoc_collection_t*>(&collection_copy_identity);
+
+    auto database_destroy = libmongoc::database_destroy.create_instance();
+    auto database_copy = libmongoc::database_copy.create_instance();
+    auto get_database = libmongoc::client_get_database.create_instance();
+    auto collection_destroy = libmongoc::collection_destroy.create_instance();
+    auto collection_copy = libmongoc::collection_copy.create_instance();
+    auto get_collection = libmongoc::database_get_collection.create_instance();
+
+    int get_database_count = 0;
+    int database_destroy_count = 0;
+    int get_collection_count = 0;
+    int collection_destroy_count = 0;
+
+    database_destroy
+        ->interpose([&](mongoc_database_t* ptr) -> void {
+            CHECK((ptr == database_id || ptr == database_copy_id));
+            ++database_destroy_count;
+        })
+        .forever();
+
+    database_copy->interpose([&](mongoc_database_t* ptr) -> mongoc_database_t* {
+        CHECK(ptr == database_id);
+        return database_copy_id;
+    });
+
+    get_database
+        ->interpose([&](mongoc_client_t* ptr, char const* name) -> mongoc_database_t* {
+            CHECK(ptr == mocks.client_id);
+            CHECK_THAT(name, Catch::Matchers::Equals("db"));
+            ++get_database_count;
+            return database_id;
+        })
+        .forever();
+
+    collection_destroy
+        ->interpose([&](mongoc_collection_t* ptr) -> void {
+            CHECK((ptr == collection_id || ptr == collection_copy_id));
+            ++collection_destroy_count;
+        })
+        .forever();
+
+    collection_copy->interpose([&](mongoc_collection_t* ptr) -> mongoc_collection_t* {
+        CHECK(ptr == collection_id);
+        return collection_copy_id;
+    });
+
+    get_collection
+        ->interpose([&](mongoc_database_t* ptr, char const* name) -> mongoc_collection_t* {
+            CHECK((ptr == database_id || ptr == database_copy_id));
+            CHECK_THAT(name, Catch::Matchers::Equals("coll"));
+            ++get_collection_count;
+            return collection_id;
+        })
+        .forever();
+
+    {
+        auto client = mocks.make();
+
+        SECTION("cached") {
+            auto const a = client["db"];
+            auto const b = client.database("db");
+
+            CHECK(get_database_count == 1);
+            CHECK(v1::database::internal::as_mongoc(a) == database_id);
+            CHECK(v1::database::internal::as_mongoc(b) == database_id);
+
+            auto const x = a["coll"];
+            auto const y = client["db"]["coll"];
+            auto const z = y; // Shared, not copied.
+
+            CHECK(get_collection_count == 1);
+            CHECK(v1::collection::internal::as_mongoc(x) == collection_id);
+            CHECK(v1::collection::internal::as_mongoc(y) == collection_id);
+            CHECK(v1::collection::internal::as_mongoc(z) == collection_id);
+
+            CHECK(database_destroy_count == 0);
+            CHECK(collection_destroy_count == 0);
+        }
+
+        SECTION("detach") {
+            auto database_set_read_concern = libmongoc::database_set_read_concern.create_instance();
+            auto collection_set_read_concern = libmongoc::collection_set_read_concern.create_instance();
+
+            database_set_read_concern->interpose([&](mongoc_database_t* ptr, mongoc_read_concern_t const* rc) {
+                CHECK(ptr == database_copy_id);
+                CHECK(rc != nullptr);
+            });
+
+            collection_set_read_concern->interpose([&](mongoc_collection_t* ptr, mongoc_read_concern_t const* rc) {
+                CHECK(ptr == collection_copy_id);
+                CHECK(rc != nullptr);
+            });
+
+            auto db = client["db"];
+            auto coll = db["coll"];
+
+            // Modification requires an owned copy of the cached handles.
+            db.read_concern(v1::read_concern{});
+            coll.read_concern(v1::read_concern{});
+
+            CHECK(v1::database::internal::as_mongoc(db) == database_copy_id);
+            CHECK(v1::collection::internal::as_mongoc(coll) == collection_copy_id);
+
+            // The cached handles are unaffected.
+            CHECK(v1::database::internal::as_mongoc(client.database("db")) == database_id);
+            CHECK(v1::collection::internal::as_mongoc(client["db"].collection("coll")) == collection_id);
+
+            // An owned database does not cache collection handles.
+            auto const other = db["coll"];
+
+            CHECK(get_collection_count == 2);
+        }
+
+        SECTION("rename") {
+            auto get_name = libmongoc::collection_get_name.create_instance();
+            auto rename = libmongoc::collection_rename_with_opts.create_instance();
+
+            get_name
+                ->interpose([&](mongoc_collection_t* ptr) -> char const* {
+                    CHECK((ptr == collection_id || ptr == collection_copy_id));
+                    return "coll";
+                })
+                .forever();
+
+            rename->interpose([&](mongoc_collection_t* ptr,
+                                  char const* new_db,
+                                  char const* new_name,
+                                  bool drop_target,
+                                  bson_t const* opts,
+                                  bson_error_t* error) -> bool {
+                CHECK(ptr == collection_copy_id);
+                CHECK(new_db == nullptr);
+                CHECK_THAT(new_name, Catch::Matchers::Equals("renamed"));
+                CHECK_FALSE(drop_target);
+                (void)opts;
+                CHECK(error != nullptr);
+                return true;
+            });
+
+            auto coll = client["db"]["coll"];
+            auto const other = client["db"]["coll"];
+
+            // Renaming requires an owned copy of the cached handles.
+            coll.rename("renamed");
+
+            CHECK(v1::collection::internal::as_mongoc(coll) == collection_copy_id);
+            CHECK(v1::collection::internal::as_mongoc(other) == collection_id);
+
+            // The cached handle is evicted.
+            auto const after = client["db"]["coll"];
+
+            CHECK(get_collection_count == 2);
+            CHECK(v1::collection::internal::as_mongoc(after) == collection_id);
+        }
+
+        SECTION("bounded") {
+            get_collection
+                ->interpose([&](mongoc_database_t* ptr, char const* name) -> mongoc_collection_t* {
+                    CHECK(ptr == database_id);
+                    CHECK(name != nullptr);
+                    ++get_collection_count;
+                    return collection_id;
+                })
+                .forever();
+
+            auto db = client["db"];
+            auto const coll = db["coll"];
+
+            for (std::size_t i = 1u; i < v1::database::internal::max_cached_handles; ++i) {
+                (void)db[std::to_string(i)];
+            }
+
+            CHECK(get_collection_count == 64);
+            CHECK(collection_destroy_count == 0);
+
+            (void)db["coll"]; // Cached.
+
+            CHECK(get_collection_count == 64);
+
+            (void)db["overflow"]; // Clears the cache.
+
+            CHECK(get_collection_count == 65);
+            CHECK(collection_destroy_count == 63); // Except `coll` (still in use) and "overflow" (cached).
+
+            (void)db["coll"]; // No longer cached.
+
+            CHECK(get_collection_count == 66);
+            CHECK(v1::collection::internal::as_mongoc(coll) == collection_id);
+        }
+
+        CHECK(get_database_count == 1);
+    }
+
+    // The cached handles are destroyed along with the client.
+    CHECK(database_destroy_count >= 1);
+    CHECK(collection_destroy_count >= 1);
+}
+
 TEST_CASE("list_databases", "[mongocxx][v1][client]") {
     client_mocks_type mocks;
 
@@ -16,14 +16,29 @@
 
 //
 
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/types/id.hpp>
+#include <bsoncxx/v1/types/view.hpp>
+
 #include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/insert_many_options.hpp>
+#include <mongocxx/v1/insert_many_result.hpp>
+
+#include <bsoncxx/test/v1/document/view.hh>
+#include <bsoncxx/test/v1/types/id.hh>
+#include <bsoncxx/test/v1/types/view.hh>
 
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <cstdint>
 #include <string>
 #include <system_error>
+#include <vector>
 
 #include <mongocxx/private/mongoc.hh>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 namespace mongocxx {
@@ -192,5 +207,139 @@ TEST_CASE("default", "[mongocxx][v1][collection]") {
     CHECK_FALSE(coll);
 }
 
+TEST_CASE("insert_many", "[mongocxx][v1][collection]") {
+    namespace types = bsoncxx::v1::types;
+
+    using id_mode = v1::insert_many_options::id_mode;
+
+    identity_type client_identity;
+    identity_type coll_identity;
+    identity_type bulk_identity;
+
+    auto const client_id = reinterpret_cast<mongoc_client_t*>(&client_identity);
+    auto const coll_id = reinterpret_cast<mongoc_collection_t*>(&coll_identity);
+    auto const bulk_id = reinterpret_cast<mongoc_bulk_operation_t*>(&bulk_identity);
+
+    auto destroy = libmongoc::collection_destroy.create_instance();
+    auto create_bulk = libmongoc::collection_create_bulk_operation_with_opts.create_instance();
+    auto bulk_destroy = libmongoc::bulk_operation_destroy.create_instance();
+    auto insert = libmongoc::bulk_operation_insert_with_opts.create_instance();
+    auto execute = libmongoc::bulk_operation_execute.create_instance();
+
+    std::vector<scoped_bson> inserted;
+    std::vector<std::uint8_t const*> inserted_data;
+
+    destroy->interpose([&](mongoc_collection_t* ptr) -> void { CHECK(ptr == coll_id); }).forever();
+
+    create_bulk
+        ->interpose([&](mongoc_collection_t* ptr, bson_t const*) -> mongoc_bulk_operation_t* {
+            CHECK(ptr == coll_id);
+            return bulk_id;
+        })
+        .forever();
+
+    bulk_destroy->interpose([&](mongoc_bulk_operation_t* ptr) -> void { CHECK(ptr == bulk_id); }).forever();
+
+    insert
+        ->interpose(
+            [&](mongoc_bulk_operation_t* ptr, bson_t const* document, bson_t const* opts, bson_error_t* error)
+                -> bool {
+                CHECK(ptr == bulk_id);
+                CHECK(opts == nullptr);
+                CHECK(error != nullptr);
+
+                inserted.emplace_back(document);
+                inserted_data.push_back(scoped_bson_view{document}.data());
+
+                return true;
+            })
+        .forever();
+
+    execute
+        ->interpose([&](mongoc_bulk_operation_t* ptr, bson_t* reply, bson_error_t* error) -> std::uint32_t {
+            CHECK(ptr == bulk_id);
+            CHECK(error != nullptr);
+
+            scoped_bson const doc{BCON_NEW("nInserted", BCON_INT32(static_cast<std::int32_t>(inserted.size())))};
+            bson_copy_to(doc.bson(), reply);
+
+            return 1u;
+        })
+        .forever();
+
+    scoped_bson const a{R"({"_id": 1, "x": 1})"};
+    scoped_bson const b{R"({"x": 2})"};
+    scoped_bson const c{R"({"_id": "c", "x": 3})"};
+
+    std::vector<bsoncxx::v1::document::view> const docs = {a.view(), b.view(), c.view()};
+
+    auto coll = collection::internal::make(coll_id, client_id);
+
+    SECTION("k_all") {
+        auto const mode = GENERATE(values({0, 1}));
+
+        v1::insert_many_options opts;
+
+        if (mode == 1) {
+            opts.report_ids(id_mode::k_all); // Same as unset.
+        }
+
+        auto const res = coll.insert_many(docs, opts);
+
+        REQUIRE(res);
+        CHECK(res->inserted_count() == 3);
+        REQUIRE(inserted.size() == 3u);
+
+        // Documents with an "_id" field are not copied.
+        CHECK(inserted_data[0] == a.data());
+        CHECK(inserted_data[2] == c.data());
+
+        auto const doc = inserted[1].view();
+        REQUIRE(doc.begin() != doc.end());
+        CHECK(doc.begin()->key() == "_id");
+        CHECK(doc["_id"].type_id() == types::id::k_oid);
+        CHECK(doc["x"].type_view() == types::b_int32{2});
+
+        auto const ids = res->inserted_ids();
+
+        CHECK(ids.size() == 3u);
+        CHECK(ids.at(0) == types::b_int32{1});
+        CHECK(ids.at(1) == doc["_id"].type_view());
+        CHECK(ids.at(2) == types::b_string{"c"});
+    }
+
+    SECTION("k_generated") {
+        auto const res = coll.insert_many(docs, v1::insert_many_options{}.report_ids(id_mode::k_generated));
+
+        REQUIRE(res);
+        REQUIRE(inserted.size() == 3u);
+
+        CHECK(inserted_data[0] == a.data());
+        CHECK(inserted_data[2] == c.data());
+
+        auto const doc = inserted[1].view();
+        CHECK(doc["_id"].type_id() == types::id::k_oid);
+
+        auto const ids = res->inserted_ids();
+
+        REQUIRE(ids.size() == 1u);
+        CHECK(ids.at(1) == doc["_id"].type_view());
+    }
+
+    SECTION("k_none") {
+        auto const res = coll.insert_many(docs, v1::insert_many_options{}.report_ids(id_mode::k_none));
+
+        REQUIRE(res);
+        REQUIRE(inserted.size() == 3u);
+
+        // No document is copied: the "_id" field is generated by mongoc.
+        CHECK(inserted_data[0] == a.data());
+        CHECK(inserted_data[1] == b.data());
+        CHECK(inserted_data[2] == c.data());
+
+        CHECK(res->inserted_ids().empty());
+    }
+}
+
 } // namespace v1
 } // namespace mongocxx
@@ -0,0 +1,376 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/concurrent_client_bulk_write.hh>
+
+//
+
+#include <bsoncxx/v1/array/value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/document/view.hpp>
+#include <bsoncxx/v1/stdx/optional.hpp>
+
+#include <mongocxx/v1/client_bulk_write.hpp>
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <mongocxx/v1/client_bulk_write.hh>
+#include <mongocxx/v1/exception.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+// Note: no server is listening on the port used by these tests. Sub-batches are only executed via the function given
+// to `concurrent_client_bulk_write::internal::set_execute()`, which is invoked on background threads.
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::concurrent_client_bulk_write::errc;
+
+namespace {
+
+v1::uri unreachable() {
+    return v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"};
+}
+
+// Records the indexes of the operations of each sub-batch.
+struct recorder {
+    std::mutex mutex;
+    std::vector<std::vector<std::size_t>> batches;
+
+    // Fail the sub-batch containing the operation with this index (if any).
+    std::size_t fail_at = static_cast<std::size_t>(-1);
+    std::function<void()> fail;
+
+    // A result mapping the index of each operation within the sub-batch to `{"idx": <index>}`.
+    static client_bulk_write::result make_result(std::vector<std::size_t> const& indexes) {
+        auto res = client_bulk_write::result::internal::make();
+
+        client_bulk_write::result::internal::inserted_count(res) = static_cast<std::int64_t>(indexes.size());
+
+        std::string json = "{";
+
+        for (std::size_t i = 0u; i < indexes.size(); ++i) {
+            json += (i == 0u ? "" : ", ") + ('"' + std::to_string(i)) + R"(": {"idx": )" + std::to_string(indexes[i]) +
+                    "}";
+        }
+
+        json += "}";
+
+        client_bulk_write::result::internal::insert_results(res) = scoped_bson{json}.value();
+
+        return res;
+    }
+
+    concurrent_client_bulk_write::internal::execute_type execute() {
+        return [this](std::vector<std::size_t> const& indexes, client_bulk_write::options const&)
+                   -> bsoncxx::v1::stdx::optional<client_bulk_write::result> {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                batches.push_back(indexes);
+            }
+
+            for (auto const idx : indexes) {
+                if (idx == fail_at) {
+                    fail();
+                }
+            }
+
+            return make_result(indexes);
+        };
+    }
+};
+
+client_bulk_write::options unordered() {
+    return std::move(client_bulk_write::options{}.ordered(false));
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][concurrent_client_bulk_write][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::concurrent_client_bulk_write::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::concurrent_client_bulk_write"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_max_concurrency;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_max_concurrency) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_max_concurrency) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][concurrent_client_bulk_write][options]") {
+    concurrent_client_bulk_write::options const opts;
+
+    CHECK_FALSE(opts.max_concurrency().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][concurrent_client_bulk_write][options]") {
+    concurrent_client_bulk_write::options opts;
+
+    opts.max_concurrency(3u);
+
+    auto const copy = opts;
+
+    CHECK(copy.max_concurrency() == std::size_t{3});
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][concurrent_client_bulk_write]") {
+    v1::pool pool{unreachable()};
+
+    CHECK_THROWS_WITH_CODE(
+        (concurrent_client_bulk_write{pool, concurrent_client_bulk_write::options{}.max_concurrency(0u)}),
+        code::invalid_max_concurrency);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][concurrent_client_bulk_write]") {
+    v1::pool pool{unreachable()};
+
+    concurrent_client_bulk_write source{pool};
+    concurrent_client_bulk_write target{pool};
+
+    source.append("db.a", scoped_bson{R"({"x": 1})"}.view(), client_bulk_write::insert_one_options{});
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.size() == 1u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.size() == 1u);
+    }
+}
+
+TEST_CASE("execute", "[mongocxx][v1][concurrent_client_bulk_write]") {
+    v1::pool pool{unreachable()};
+    recorder rec;
+
+    auto const doc = scoped_bson{R"({"x": 1})"};
+    auto const update = scoped_bson{R"({"$set": {"x": 2}})"};
+
+    concurrent_client_bulk_write bulk{pool, concurrent_client_bulk_write::options{}.max_concurrency(2u)};
+    concurrent_client_bulk_write::internal::set_execute(bulk, rec.execute());
+
+    // "db.a": 0, 2, 4
+    // "db.b": 1
+    // "db.c": 3, 5
+    bulk.append("db.a", doc.view(), client_bulk_write::insert_one_options{})
+        .append("db.b", doc.view(), update.view(), client_bulk_write::update_one_options{})
+        .append("db.a", doc.view(), v1::pipeline{}, client_bulk_write::update_many_options{})
+        .append("db.c", doc.view(), doc.view(), client_bulk_write::replace_one_options{})
+        .append("db.a", doc.view(), client_bulk_write::delete_one_options{})
+        .append("db.c", doc.view(), client_bulk_write::delete_many_options{});
+
+    REQUIRE(bulk.size() == 6u);
+
+    SECTION("ordered") {
+        auto const res = bulk.execute(client_bulk_write::options{});
+
+        REQUIRE(rec.batches.size() == 1u);
+        CHECK(rec.batches[0] == std::vector<std::size_t>({0u, 1u, 2u, 3u, 4u, 5u}));
+
+        REQUIRE(res.has_value());
+        CHECK(res->inserted_count() == 6);
+    }
+
+    SECTION("max_concurrency") {
+        concurrent_client_bulk_write serial{pool, concurrent_client_bulk_write::options{}.max_concurrency(1u)};
+        concurrent_client_bulk_write::internal::set_execute(serial, rec.execute());
+
+        serial.append("db.a", doc.view(), client_bulk_write::insert_one_options{})
+            .append("db.b", doc.view(), client_bulk_write::insert_one_options{});
+
+        CHECK(serial.execute(unordered()).has_value());
+
+        REQUIRE(rec.batches.size() == 1u);
+        CHECK(rec.batches[0] == std::vector<std::size_t>({0u, 1u}));
+    }
+
+    SECTION("unordered") {
+        auto const res = bulk.execute(unordered());
+
+        // "db.a" is assigned to the first sub-batch, then "db.c" and "db.b" to the second.
+        REQUIRE(rec.batches.size() == 2u);
+
+        auto batches = rec.batches;
+
+        if (batches[0].front() != 0u) {
+            std::swap(batches[0], batches[1]);
+        }
+
+        CHECK(batches[0] == std::vector<std::size_t>({0u, 2u, 4u}));
+        CHECK(batches[1] == std::vector<std::size_t>({1u, 3u, 5u}));
+
+        REQUIRE(res.has_value());
+        CHECK(res->inserted_count() == 6);
+
+        auto const expected = scoped_bson{R"({
+            "0": {"idx": 0}, "1": {"idx": 1}, "2": {"idx": 2}, "3": {"idx": 3}, "4": {"idx": 4}, "5": {"idx": 5}
+        })"};
+
+        REQUIRE(res->insert_results().has_value());
+        CHECK(*res->insert_results() == expected.view());
+        CHECK_FALSE(res->update_results().has_value());
+        CHECK_FALSE(res->delete_results().has_value());
+
+        // The appended operations are cleared.
+        CHECK(bulk.size() == 0u);
+    }
+
+    SECTION("bulk write error") {
+        rec.fail_at = 3u;
+        rec.fail = [] {
+            auto ex = client_bulk_write::exception::internal::make();
+
+            // The second operation of the sub-batch (index 3).
+            client_bulk_write::exception::internal::write_errors(ex) =
+                scoped_bson{R"({"1": {"code": 11000, "message": "duplicate", "details": {}}})"}.value();
+            client_bulk_write::exception::internal::write_concern_errors(ex) =
+                bsoncxx::v1::array::value{scoped_bson{R"({"0": {"code": 64}})"}.array_view()};
+
+            auto partial = client_bulk_write::result::internal::make();
+            client_bulk_write::result::internal::inserted_count(partial) = 1;
+            client_bulk_write::exception::internal::partial_result(ex) = std::move(partial);
+
+            throw ex;
+        };
+
+        try {
+            (void)bulk.execute(unordered());
+            FAIL("expected an exception");
+        } catch (client_bulk_write::exception const& ex) {
+            CHECK(ex.write_errors() ==
+                  scoped_bson{R"({"3": {"code": 11000, "message": "duplicate", "details": {}}})"}.view());
+            CHECK(ex.write_concern_errors() == scoped_bson{R"({"0": {"code": 64}})"}.array_view());
+
+            // The result of the successful sub-batch and the partial result of the failed sub-batch.
+            auto const partial = ex.partial_result();
+
+            REQUIRE(partial.has_value());
+            CHECK(partial->inserted_count() == 4);
+
+            REQUIRE(partial->insert_results().has_value());
+            CHECK(
+                *partial->insert_results() ==
+                scoped_bson{R"({"0": {"idx": 0}, "2": {"idx": 2}, "4": {"idx": 4}})"}.view());
+        }
+
+        // Every sub-batch is executed despite the error.
+        CHECK(rec.batches.size() == 2u);
+        CHECK(bulk.size() == 0u);
+    }
+
+    SECTION("client error") {
+        rec.fail_at = 0u;
+        rec.fail = [] { throw v1::exception::internal::make(code::invalid_max_concurrency); };
+
+        try {
+            (void)bulk.execute(unordered());
+            FAIL("expected an exception");
+        } catch (client_bulk_write::exception const& ex) {
+            CHECK(ex.code() == code::invalid_max_concurrency);
+            CHECK(ex.write_errors().empty());
+
+            auto const partial = ex.partial_result();
+
+            REQUIRE(partial.has_value());
+            CHECK(partial->inserted_count() == 3);
+        }
+    }
+
+    SECTION("unexpected error") {
+        rec.fail_at = 5u;
+        rec.fail = [] { throw std::runtime_error{"unexpected"}; };
+
+        CHECK_THROWS_AS(bulk.execute(unordered()), std::runtime_error);
+        CHECK(rec.batches.size() == 2u);
+    }
+
+    SECTION("unacknowledged") {
+        concurrent_client_bulk_write::internal::set_execute(
+            bulk,
+            [](std::vector<std::size_t> const&, client_bulk_write::options const&)
+                -> bsoncxx::v1::stdx::optional<client_bulk_write::result> { return {}; });
+
+        CHECK_FALSE(bulk.execute(unordered()).has_value());
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
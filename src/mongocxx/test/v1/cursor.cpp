@@ -16,6 +16,7 @@
 
 //
 
+#include <mongocxx/v1/client.hh>
 #include <mongocxx/v1/cursor.hh>
 #include <mongocxx/v1/server_error.hh>
 
@@ -25,6 +26,9 @@
 
 #include <mongocxx/test/private/scoped_bson.hh>
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <utility>
 
 #include <bsoncxx/private/bson.hh>
@@ -480,5 +484,101 @@ TEST_CASE("begin", "[mongocxx][v1][cursor]") {
     }
 }
 
+TEST_CASE("prefetch", "[mongocxx][v1][cursor]") {
+    // Mocks are not observed by the background thread: use a real cursor over a command reply which does not require
+    // any "getMore" commands.
+    v1::client client;
+
+    auto const n = GENERATE(0, 1, 3, 5, 100);
+    auto const buffer_size = GENERATE(std::size_t{1}, std::size_t{3}, std::size_t{1000});
+
+    CAPTURE(n);
+    CAPTURE(buffer_size);
+
+    auto const make_cursor = [&] {
+        bson_t* const reply = bson_new();
+        bson_t cursor_doc;
+        bson_t batch;
+
+        BSON_APPEND_INT32(reply, "ok", 1);
+        BSON_APPEND_DOCUMENT_BEGIN(reply, "cursor", &cursor_doc);
+        BSON_APPEND_UTF8(&cursor_doc, "ns", "db.coll");
+        BSON_APPEND_INT64(&cursor_doc, "id", 0);
+        BSON_APPEND_ARRAY_BEGIN(&cursor_doc, "firstBatch", &batch);
+        for (int i = 0; i < n; ++i) {
+            bson_t doc;
+            auto const key = std::to_string(i);
+            BSON_APPEND_DOCUMENT_BEGIN(&batch, key.c_str(), &doc);
+            BSON_APPEND_INT32(&doc, "x", i);
+            bson_append_document_end(&batch, &doc);
+        }
+        bson_append_array_end(&cursor_doc, &batch);
+        bson_append_document_end(reply, &cursor_doc);
+
+        return cursor::internal::make(libmongoc::cursor_new_from_command_reply_with_opts(
+            v1::client::internal::as_mongoc(client), reply, nullptr));
+    };
+
+    SECTION("disabled") {
+        auto cursor = make_cursor();
+
+        auto const stats = cursor.stats();
+
+        CHECK(stats.documents == 0);
+        CHECK(stats.buffers == 0);
+        CHECK(stats.waits == 0);
+        CHECK(stats.wait_time.count() == 0);
+    }
+
+    SECTION("before begin") {
+        auto cursor = make_cursor();
+
+        cursor.enable_prefetch(buffer_size);
+        cursor.enable_prefetch(buffer_size); // No effect.
+
+        int count = 0;
+        for (auto const doc : cursor) {
+            CHECK(doc["x"].get_int32().value == count);
+            ++count;
+        }
+
+        CHECK(count == n);
+        CHECK(cursor.begin() == cursor.end());
+
+        auto const stats = cursor.stats();
+
+        CHECK(stats.documents == n);
+        CHECK(stats.buffers == static_cast<std::int64_t>(static_cast<std::size_t>(n) / buffer_size + 1u));
+        CHECK(stats.waits <= stats.buffers);
+    }
+
+    SECTION("after begin") {
+        auto cursor = make_cursor();
+
+        auto iter = cursor.begin();
+
+        cursor.enable_prefetch(buffer_size);
+
+        int count = 0;
+        for (; iter != cursor.end(); ++iter) {
+            CHECK((*iter)["x"].get_int32().value == count);
+            ++count;
+        }
+
+        CHECK(count == n);
+        CHECK(cursor.stats().documents == (n > 0 ? n - 1 : 0));
+    }
+
+    SECTION("destroy") {
+        auto cursor = make_cursor();
+
+        cursor.enable_prefetch(buffer_size);
+
+        auto const iter = cursor.begin();
+
+        CHECK((iter == cursor.end()) == (n == 0));
+    }
+}
+
 } // namespace v1
 } // namespace mongocxx
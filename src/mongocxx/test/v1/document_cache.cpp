@@ -0,0 +1,318 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/document_cache.hh>
+
+//
+
+#include <bsoncxx/v1/document/shared_value.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+// Note: no server is listening on the port used by these tests. The change stream is never established: documents
+// are only cached via `document_cache::internal::insert()`.
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::document_cache::errc;
+
+namespace {
+
+v1::uri unreachable() {
+    return v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"};
+}
+
+document_cache::options fast() {
+    return document_cache::options{}.max_await_time(std::chrono::milliseconds{1});
+}
+
+bsoncxx::v1::types::value id(std::int32_t v) {
+    return bsoncxx::v1::types::value{v};
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][document_cache][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::document_cache::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::document_cache"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_max_size;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_max_size) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_max_size) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][document_cache][options]") {
+    document_cache::options const opts;
+
+    CHECK_FALSE(opts.max_await_time().has_value());
+    CHECK_FALSE(opts.max_size().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][document_cache][options]") {
+    document_cache::options opts;
+
+    opts.max_await_time(std::chrono::milliseconds{2}).max_size(3u);
+
+    auto const copy = opts;
+
+    CHECK(copy.max_await_time() == std::chrono::milliseconds{2});
+    CHECK(copy.max_size() == std::size_t{3});
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][document_cache]") {
+    v1::pool pool{unreachable()};
+
+    CHECK_THROWS_WITH_CODE((document_cache{pool, "db", fast().max_size(0u)}), code::invalid_max_size);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][document_cache]") {
+    v1::pool pool{unreachable()};
+
+    document_cache source{pool, "source", fast()};
+    document_cache target{pool, "target", fast()};
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.stats().entries == 0u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.stats().entries == 0u);
+    }
+}
+
+TEST_CASE("lookup", "[mongocxx][v1][document_cache]") {
+    v1::pool pool{unreachable()};
+    document_cache cache{pool, "db", fast()};
+
+    CHECK_FALSE(cache.watching());
+
+    scoped_bson const doc{R"({"_id": 1, "x": 1})"};
+
+    document_cache::internal::insert(cache, "coll", doc.view());
+
+    SECTION("hit") {
+        auto const res = cache.find_one("coll", id(1).view());
+
+        REQUIRE(res.has_value());
+        CHECK(res->view() == doc.view());
+
+        auto const stats = cache.stats();
+        CHECK(stats.hits == 1);
+        CHECK(stats.misses == 0);
+        CHECK(stats.entries == 1u);
+        CHECK(stats.size >= doc.view().length());
+    }
+
+    SECTION("miss") {
+        // The document is obtained from the (unreachable) server.
+        CHECK_THROWS_AS(cache.find_one("other", id(1).view()), v1::exception);
+        CHECK_THROWS_AS(cache.find_one("coll", id(2).view()), v1::exception);
+
+        auto const stats = cache.stats();
+        CHECK(stats.hits == 0);
+        CHECK(stats.misses == 2);
+    }
+
+    SECTION("evict") {
+        cache.evict("coll", id(1).view());
+
+        auto const stats = cache.stats();
+        CHECK(stats.invalidations == 1);
+        CHECK(stats.entries == 0u);
+        CHECK(stats.size == 0u);
+    }
+
+    SECTION("clear") {
+        cache.clear();
+
+        auto const stats = cache.stats();
+        CHECK(stats.flushes == 1);
+        CHECK(stats.entries == 0u);
+        CHECK(stats.size == 0u);
+    }
+}
+
+TEST_CASE("max_size", "[mongocxx][v1][document_cache]") {
+    v1::pool pool{unreachable()};
+
+    scoped_bson const a{R"({"_id": 1})"};
+    scoped_bson const b{R"({"_id": 2})"};
+    scoped_bson const c{R"({"_id": 3})"};
+
+    std::size_t size = 0u;
+
+    {
+        document_cache cache{pool, "db", fast()};
+        document_cache::internal::insert(cache, "coll", a.view());
+        size = cache.stats().size;
+    }
+
+    // Room for exactly two documents.
+    document_cache cache{pool, "db", fast().max_size(2u * size)};
+
+    document_cache::internal::insert(cache, "coll", a.view());
+    document_cache::internal::insert(cache, "coll", b.view());
+
+    // Mark `a` as most recently used.
+    CHECK(cache.find_one("coll", id(1).view()).has_value());
+
+    document_cache::internal::insert(cache, "coll", c.view());
+
+    auto const stats = cache.stats();
+    CHECK(stats.evictions == 1);
+    CHECK(stats.entries == 2u);
+
+    CHECK(cache.find_one("coll", id(1).view()).has_value());
+    CHECK(cache.find_one("coll", id(3).view()).has_value());
+    CHECK_THROWS_AS(cache.find_one("coll", id(2).view()), v1::exception); // Evicted.
+}
+
+TEST_CASE("on_event", "[mongocxx][v1][document_cache]") {
+    v1::pool pool{unreachable()};
+    document_cache cache{pool, "db", fast()};
+
+    document_cache::internal::insert(cache, "a", scoped_bson{R"({"_id": 1})"}.view());
+    document_cache::internal::insert(cache, "a", scoped_bson{R"({"_id": 2})"}.view());
+    document_cache::internal::insert(cache, "b", scoped_bson{R"({"_id": 1})"}.view());
+
+    REQUIRE(cache.stats().entries == 3u);
+
+    SECTION("insert") {
+        CHECK(document_cache::internal::on_event(
+            cache,
+            scoped_bson{R"({"operationType": "insert", "ns": {"db": "db", "coll": "a"}, "documentKey": {"_id": 3}})"}
+                .view()));
+
+        CHECK(cache.stats().entries == 3u);
+    }
+
+    SECTION("update") {
+        CHECK(document_cache::internal::on_event(
+            cache,
+            scoped_bson{R"({"operationType": "update", "ns": {"db": "db", "coll": "a"}, "documentKey": {"_id": 1}})"}
+                .view()));
+
+        CHECK(cache.stats().entries == 2u);
+        CHECK(cache.stats().invalidations == 1);
+        CHECK(cache.find_one("b", id(1).view()).has_value());
+    }
+
+    SECTION("replace") {
+        CHECK(document_cache::internal::on_event(
+            cache,
+            scoped_bson{R"({"operationType": "replace", "ns": {"db": "db", "coll": "a"}, "documentKey": {"_id": 2}})"}
+                .view()));
+
+        CHECK(cache.stats().entries == 2u);
+    }
+
+    SECTION("delete") {
+        CHECK(document_cache::internal::on_event(
+            cache,
+            scoped_bson{R"({"operationType": "delete", "ns": {"db": "db", "coll": "b"}, "documentKey": {"_id": 1}})"}
+                .view()));
+
+        CHECK(cache.stats().entries == 2u);
+        CHECK(cache.find_one("a", id(1).view()).has_value());
+    }
+
+    SECTION("drop") {
+        CHECK(document_cache::internal::on_event(
+            cache, scoped_bson{R"({"operationType": "drop", "ns": {"db": "db", "coll": "a"}})"}.view()));
+
+        CHECK(cache.stats().entries == 0u);
+    }
+
+    SECTION("invalidate") {
+        CHECK_FALSE(
+            document_cache::internal::on_event(cache, scoped_bson{R"({"operationType": "invalidate"})"}.view()));
+
+        CHECK(cache.stats().entries == 0u);
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
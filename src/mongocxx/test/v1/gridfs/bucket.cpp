@@ -16,22 +16,46 @@
 
 //
 
+#include <bsoncxx/v1/stdx/optional.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+
 #include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/gridfs/upload_options.hpp>
+#include <mongocxx/v1/gridfs/upload_result.hpp>
+#include <mongocxx/v1/pool.hpp>
 #include <mongocxx/v1/read_concern.hpp>    // IWYU pragma: keep
 #include <mongocxx/v1/read_preference.hpp> // IWYU pragma: keep
-#include <mongocxx/v1/write_concern.hpp>   // IWYU pragma: keep
+#include <mongocxx/v1/uri.hpp>
+#include <mongocxx/v1/write_concern.hpp> // IWYU pragma: keep
 
 #include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/read_concern.hh>
+#include <mongocxx/v1/read_preference.hh>
 
 #include <mongocxx/test/private/scoped_bson.hh>
 #include <mongocxx/test/v1/read_concern.hh>
 #include <mongocxx/test/v1/read_preference.hh>
 #include <mongocxx/test/v1/write_concern.hh>
 
+#include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <system_error>
+#include <tuple>
 #include <utility>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <bsoncxx/private/bson.hh>
 
 #include <mongocxx/private/mongoc.hh>
 
@@ -96,6 +120,7 @@ TEST_CASE("error code", "[mongocxx][v1][gridfs][bucket][error]") {
         CHECK(make_error_code(code::not_found) == source_errc::mongocxx);
         CHECK(make_error_code(code::corrupt_data) == source_errc::mongocxx);
         CHECK(make_error_code(code::invalid_byte_range) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_max_concurrency) == source_errc::mongocxx);
     }
 
     SECTION("type") {
@@ -104,6 +129,7 @@ TEST_CASE("error code", "[mongocxx][v1][gridfs][bucket][error]") {
         CHECK(make_error_code(code::not_found) == type_errc::runtime_error);
         CHECK(make_error_code(code::corrupt_data) == type_errc::runtime_error);
         CHECK(make_error_code(code::invalid_byte_range) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_max_concurrency) == type_errc::invalid_argument);
     }
 }
 
@@ -228,6 +254,541 @@ TEST_CASE("ownership", "[mongocxx][v1][gridfs][bucket]") {
     }
 }
 
+TEST_CASE("upload_from_file", "[mongocxx][v1][gridfs][bucket]") {
+    struct identity_type {};
+
+    identity_type files_identity;
+    identity_type chunks_identity;
+    identity_type cursor_identity;
+
+    auto const files_id = reinterpret_cast<mongoc_collection_t*>(&files_identity);
+    auto const chunks_id = reinterpret_cast<mongoc_collection_t*>(&chunks_identity);
+    auto const cursor_id = reinterpret_cast<mongoc_cursor_t*>(&cursor_identity);
+
+    auto destroy = libmongoc::collection_destroy.create_instance();
+    auto find_with_opts = libmongoc::collection_find_with_opts.create_instance();
+    auto cursor_next = libmongoc::cursor_next.create_instance();
+    auto cursor_error_document = libmongoc::cursor_error_document.create_instance();
+    auto cursor_destroy = libmongoc::cursor_destroy.create_instance();
+    auto collection_create_bulk_operation_with_opts =
+        libmongoc::collection_create_bulk_operation_with_opts.create_instance();
+    auto bulk_operation_insert_with_opts = libmongoc::bulk_operation_insert_with_opts.create_instance();
+    auto bulk_operation_execute = libmongoc::bulk_operation_execute.create_instance();
+
+    destroy->interpose([&](mongoc_collection_t*) -> void {}).forever();
+
+    // The files collection is never empty: index creation is skipped.
+    scoped_bson const existing{R"({"_id": 0})"};
+
+    find_with_opts
+        ->interpose([&](mongoc_collection_t* coll,
+                        bson_t const* filter,
+                        bson_t const* opts,
+                        mongoc_read_prefs_t const* read_prefs) -> mongoc_cursor_t* {
+            CHECK(coll == files_id);
+            CHECK(filter != nullptr);
+            CHECK(opts != nullptr);
+            CHECK(read_prefs != nullptr);
+            return cursor_id;
+        })
+        .forever();
+
+    cursor_next
+        ->interpose([&](mongoc_cursor_t* cursor, bson_t const** bson) -> bool {
+            CHECK(cursor == cursor_id);
+            REQUIRE(bson);
+            *bson = existing.bson();
+            return true;
+        })
+        .forever();
+
+    cursor_error_document
+        ->interpose([&](mongoc_cursor_t const* cursor, bson_error_t* error, bson_t const** bson) -> bool {
+            CHECK(cursor == cursor_id);
+            CHECK(error);
+            CHECK(bson);
+            return false;
+        })
+        .forever();
+
+    cursor_destroy->interpose([&](mongoc_cursor_t* cursor) -> void { CHECK(cursor == cursor_id); }).forever();
+
+    mongoc_collection_t* bulk_coll = nullptr;
+    std::vector<scoped_bson> chunk_docs;
+    scoped_bson files_doc;
+
+    collection_create_bulk_operation_with_opts
+        ->interpose([&](mongoc_collection_t* coll, bson_t const* opts) -> mongoc_bulk_operation_t* {
+            CHECK(opts != nullptr);
+            bulk_coll = coll;
+            return nullptr;
+        })
+        .forever();
+
+    bulk_operation_insert_with_opts
+        ->interpose(
+            [&](mongoc_bulk_operation_t* bulk, bson_t const* doc, bson_t const* opts, bson_error_t* error) -> bool {
+                CHECK(bulk == nullptr);
+                REQUIRE(doc != nullptr);
+                CHECK(opts == nullptr);
+                CHECK(error != nullptr);
+
+                if (bulk_coll == chunks_id) {
+                    chunk_docs.emplace_back(doc);
+                } else {
+                    CHECK(bulk_coll == files_id);
+                    files_doc = scoped_bson{doc};
+                }
+
+                return true;
+            })
+        .forever();
+
+    bulk_operation_execute
+        ->interpose([&](mongoc_bulk_operation_t* bulk, bson_t* reply, bson_error_t* error) -> std::uint32_t {
+            CHECK(bulk == nullptr);
+            CHECK(reply != nullptr);
+            CHECK(error != nullptr);
+            return 1u;
+        })
+        .forever();
+
+    auto b = bucket::internal::make(
+        v1::collection::internal::make(files_id, nullptr),
+        v1::collection::internal::make(chunks_id, nullptr),
+        "fs",
+        123);
+
+    // The file is opened before the upload stream: no libmongoc calls are expected.
+    SECTION("missing") {
+        try {
+            (void)b.upload_from_file("filename", "mongocxx-test-v1-gridfs-bucket-upload_from_file.missing");
+            FAIL("should not reach this point");
+        } catch (v1::exception const& ex) {
+            CHECK(ex.code() == std::errc::no_such_file_or_directory);
+            CHECK_THAT(ex.what(), Catch::Matchers::ContainsSubstring("open failed"));
+        }
+
+        CHECK(chunk_docs.empty());
+    }
+
+#if !defined(_WIN32)
+    SECTION("not a regular file") {
+        try {
+            (void)b.upload_from_file("filename", ".");
+            FAIL("should not reach this point");
+        } catch (v1::exception const& ex) {
+            CHECK(ex.code() == std::errc::invalid_argument);
+            CHECK_THAT(ex.what(), Catch::Matchers::ContainsSubstring("not a regular file"));
+        }
+
+        CHECK(chunk_docs.empty());
+    }
+#endif
+
+    SECTION("chunks") {
+        char const path[] = "mongocxx-test-v1-gridfs-bucket-upload_from_file.bin";
+
+        struct remove_guard {
+            char const* path;
+
+            ~remove_guard() {
+                (void)std::remove(path);
+            }
+        } const guard{path};
+
+        // Two whole chunks followed by a partial chunk.
+        std::string const data = "abcdefghijk";
+        std::int32_t const chunk_size = 4;
+
+        {
+            std::ofstream output{path, std::ios::binary | std::ios::trunc};
+            output.write(data.data(), static_cast<std::streamsize>(data.size()));
+            REQUIRE(output);
+        }
+
+        bsoncxx::v1::types::value const file_id{std::int32_t{7}};
+
+        b.upload_from_file_with_id(file_id.view(), "filename", path, upload_options{}.chunk_size_bytes(chunk_size));
+
+        REQUIRE(chunk_docs.size() == 3u);
+
+        for (std::size_t n = 0u; n < chunk_docs.size(); ++n) {
+            CAPTURE(n);
+
+            auto const doc = chunk_docs[n].view();
+
+            CHECK(doc["files_id"].type_view() == file_id.view());
+            CHECK(doc["n"].get_int32().value == static_cast<std::int32_t>(n));
+
+            auto const bin = doc["data"].get_binary();
+            auto const offset = n * static_cast<std::size_t>(chunk_size);
+            auto const expected = data.substr(offset, static_cast<std::size_t>(chunk_size));
+
+            CHECK(std::string(reinterpret_cast<char const*>(bin.bytes), bin.size) == expected);
+        }
+
+        auto const files = files_doc.view();
+
+        CHECK(files["_id"].type_view() == file_id.view());
+        CHECK(files["length"].get_int64().value == static_cast<std::int64_t>(data.size()));
+        CHECK(files["chunkSize"].get_int32().value == chunk_size);
+        CHECK(files["filename"].get_string().value == "filename");
+    }
+}
+
+TEST_CASE("download_to_file", "[mongocxx][v1][gridfs][bucket]") {
+    struct identity_type {};
+
+    identity_type files_identity;
+    identity_type chunks_identity;
+    identity_type files_cursor_identity;
+    identity_type chunks_cursor_identity;
+
+    auto const files_id = reinterpret_cast<mongoc_collection_t*>(&files_identity);
+    auto const chunks_id = reinterpret_cast<mongoc_collection_t*>(&chunks_identity);
+    auto const files_cursor_id = reinterpret_cast<mongoc_cursor_t*>(&files_cursor_identity);
+    auto const chunks_cursor_id = reinterpret_cast<mongoc_cursor_t*>(&chunks_cursor_identity);
+
+    auto destroy = libmongoc::collection_destroy.create_instance();
+    auto find_with_opts = libmongoc::collection_find_with_opts.create_instance();
+    auto cursor_next = libmongoc::cursor_next.create_instance();
+    auto cursor_error_document = libmongoc::cursor_error_document.create_instance();
+    auto cursor_destroy = libmongoc::cursor_destroy.create_instance();
+
+    destroy->interpose([&](mongoc_collection_t*) -> void {}).forever();
+
+    // Four chunks: three whole chunks followed by a short last chunk.
+    std::string const data = "abcdefghijklmn";
+    std::int32_t const chunk_size = 4;
+
+    auto const make_chunk = [&](std::int32_t n, std::string const& bytes) {
+        return scoped_bson{BCON_NEW(
+            "files_id",
+            BCON_INT32(1),
+            "n",
+            BCON_INT32(n),
+            "data",
+            BCON_BIN(
+                BSON_SUBTYPE_BINARY,
+                reinterpret_cast<std::uint8_t const*>(bytes.data()),
+                static_cast<std::uint32_t>(bytes.size())))};
+    };
+
+    bsoncxx::v1::stdx::optional<scoped_bson> files_doc{scoped_bson{
+        R"({"_id": 1, "length": )" + std::to_string(data.size()) + R"(, "chunkSize": )" +
+        std::to_string(chunk_size) + "}"}};
+
+    std::vector<scoped_bson> chunk_docs = {
+        make_chunk(0, "abcd"),
+        make_chunk(1, "efgh"),
+        make_chunk(2, "ijkl"),
+        make_chunk(3, "mn"),
+    };
+
+    bool chunks_error = false;
+    int chunks_find_count = 0;
+    std::int32_t first = -1;
+    std::int32_t last = -1;
+
+    bool files_pending = false;
+    std::size_t chunk_idx = 0u;
+
+    find_with_opts
+        ->interpose([&](mongoc_collection_t* coll,
+                        bson_t const* filter,
+                        bson_t const* opts,
+                        mongoc_read_prefs_t const* read_prefs) -> mongoc_cursor_t* {
+            (void)opts;
+            (void)read_prefs;
+
+            REQUIRE(filter != nullptr);
+
+            if (coll == files_id) {
+                files_pending = true;
+                return files_cursor_id;
+            }
+
+            CHECK(coll == chunks_id);
+
+            auto const n = scoped_bson_view{filter}.view()["n"];
+            REQUIRE(n);
+
+            first = n["$gte"].get_int32().value;
+            last = n["$lt"].get_int32().value;
+
+            ++chunks_find_count;
+            chunk_idx = 0u;
+            return chunks_cursor_id;
+        })
+        .forever();
+
+    cursor_next
+        ->interpose([&](mongoc_cursor_t* cursor, bson_t const** bson) -> bool {
+            REQUIRE(bson);
+
+            if (cursor == files_cursor_id) {
+                if (!files_pending || !files_doc) {
+                    return false;
+                }
+
+                files_pending = false;
+                *bson = files_doc->bson();
+                return true;
+            }
+
+            CHECK(cursor == chunks_cursor_id);
+
+            if (chunk_idx >= chunk_docs.size()) {
+                return false;
+            }
+
+            *bson = chunk_docs[chunk_idx++].bson();
+            return true;
+        })
+        .forever();
+
+    cursor_error_document
+        ->interpose([&](mongoc_cursor_t const* cursor, bson_error_t* error, bson_t const** bson) -> bool {
+            REQUIRE(error);
+            CHECK(bson);
+
+            if (cursor == chunks_cursor_id && chunks_error) {
+                bson_set_error(error, MONGOC_ERROR_SERVER, 123, "chunks failure");
+                return true;
+            }
+
+            return false;
+        })
+        .forever();
+
+    cursor_destroy
+        ->interpose([&](mongoc_cursor_t* cursor) -> void {
+            CHECK((cursor == files_cursor_id || cursor == chunks_cursor_id));
+        })
+        .forever();
+
+    auto b = bucket::internal::make(
+        v1::collection::internal::make(files_id, nullptr),
+        v1::collection::internal::make(chunks_id, nullptr),
+        "fs",
+        123,
+        "db");
+
+    v1::pool pool{v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"}};
+
+    bsoncxx::v1::types::value const file_id{std::int32_t{1}};
+
+    char const path[] = "mongocxx-test-v1-gridfs-bucket-download_to_file.bin";
+
+    struct remove_guard {
+        char const* path;
+
+        ~remove_guard() {
+            (void)std::remove(path);
+        }
+    } const guard{path};
+
+    auto const write_file = [&](std::string const& contents) {
+        std::ofstream output{path, std::ios::binary | std::ios::trunc};
+        output.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        REQUIRE(output);
+    };
+
+    auto const read_file = [&]() -> std::string {
+        std::ifstream input{path, std::ios::binary};
+        REQUIRE(input);
+        return std::string{std::istreambuf_iterator<char>{input}, std::istreambuf_iterator<char>{}};
+    };
+
+    // Validated before the files document is looked up: no libmongoc calls are expected.
+    SECTION("invalid_max_concurrency") {
+        CHECK_THROWS_WITH_CODE(b.download_to_file(pool, file_id, path, 0u), code::invalid_max_concurrency);
+        CHECK_THROWS_WITH_CODE(b.download_to_file(pool, file_id, -1, 0u), code::invalid_max_concurrency);
+    }
+
+    SECTION("not_found") {
+        files_doc.reset();
+
+        CHECK_THROWS_WITH_CODE(b.download_to_file(file_id, path), code::not_found);
+        CHECK(chunks_find_count == 0);
+    }
+
+    SECTION("path") {
+        // The output file is truncated.
+        write_file(std::string(data.size() + 4u, 'x'));
+
+        b.download_to_file(file_id, path);
+
+        CHECK(read_file() == data);
+        CHECK(chunks_find_count == 1);
+        CHECK(first == 0);
+        CHECK(last == 4);
+    }
+
+#if !defined(_WIN32)
+    SECTION("fd") {
+        // Each chunk is written at its offset regardless of the current file offset. The file is not truncated.
+        write_file(std::string(data.size() + 4u, 'x'));
+
+        int const fd = ::open(path, O_WRONLY | O_APPEND | O_CLOEXEC);
+        REQUIRE(fd >= 0);
+
+        struct close_guard {
+            int fd;
+
+            ~close_guard() {
+                (void)::close(fd);
+            }
+        } const fd_guard{fd};
+
+        b.download_to_file(file_id, fd);
+
+        CHECK(read_file() == data + "xxxx");
+    }
+#endif
+
+    SECTION("empty") {
+        files_doc = scoped_bson{R"({"_id": 1, "length": 0, "chunkSize": 4})"};
+
+        write_file("xxxx");
+
+        b.download_to_file(file_id, path);
+
+        CHECK(read_file().empty());
+        CHECK(chunks_find_count == 0);
+    }
+
+    SECTION("corrupt_data") {
+        SECTION("wrong n") {
+            chunk_docs[1] = make_chunk(2, "efgh");
+
+            try {
+                b.download_to_file(file_id, path);
+                FAIL("should not reach this point");
+            } catch (v1::exception const& ex) {
+                CHECK(ex.code() == code::corrupt_data);
+                CHECK_THAT(ex.what(), Catch::Matchers::ContainsSubstring("chunk #1: expected to find field \"n\""));
+            }
+        }
+
+        SECTION("bad size") {
+            chunk_docs[1] = make_chunk(1, "efg");
+
+            try {
+                b.download_to_file(file_id, path);
+                FAIL("should not reach this point");
+            } catch (v1::exception const& ex) {
+                CHECK(ex.code() == code::corrupt_data);
+                CHECK_THAT(
+                    ex.what(),
+                    Catch::Matchers::ContainsSubstring(
+                        "chunk #1: expected size of chunk to be 4 bytes, but actual size of chunk is 3 bytes"));
+            }
+        }
+
+        SECTION("bad size of last chunk") {
+            chunk_docs[3] = make_chunk(3, "mno");
+
+            try {
+                b.download_to_file(file_id, path);
+                FAIL("should not reach this point");
+            } catch (v1::exception const& ex) {
+                CHECK(ex.code() == code::corrupt_data);
+                CHECK_THAT(
+                    ex.what(),
+                    Catch::Matchers::ContainsSubstring(
+                        "chunk #3: expected size of chunk to be 2 bytes, but actual size of chunk is 3 bytes"));
+            }
+        }
+
+        SECTION("missing chunks") {
+            chunk_docs.pop_back();
+
+            try {
+                b.download_to_file(file_id, path);
+                FAIL("should not reach this point");
+            } catch (v1::exception const& ex) {
+                CHECK(ex.code() == code::corrupt_data);
+                CHECK_THAT(
+                    ex.what(),
+                    Catch::Matchers::ContainsSubstring(
+                        "expected chunks #0 to #3, but query to chunks collection only returned 3 chunk(s)"));
+            }
+        }
+    }
+
+    // Only the first range is downloaded by this bucket on the calling thread. Every other range is downloaded by a
+    // client acquired from the pool, which cannot select a server.
+    SECTION("ranges") {
+        auto get_name = libmongoc::collection_get_name.create_instance();
+        auto get_read_concern = libmongoc::collection_get_read_concern.create_instance();
+        auto get_read_prefs = libmongoc::collection_get_read_prefs.create_instance();
+
+        v1::read_concern const rc;
+        v1::read_preference const rp;
+
+        get_name
+            ->interpose([&](mongoc_collection_t* ptr) -> char const* {
+                CHECK(ptr == chunks_id);
+                return "fs.chunks";
+            })
+            .forever();
+
+        get_read_concern
+            ->interpose([&](mongoc_collection_t const* ptr) -> mongoc_read_concern_t const* {
+                CHECK(ptr == chunks_id);
+                return v1::read_concern::internal::as_mongoc(rc);
+            })
+            .forever();
+
+        get_read_prefs
+            ->interpose([&](mongoc_collection_t const* ptr) -> mongoc_read_prefs_t const* {
+                CHECK(ptr == chunks_id);
+                return v1::read_preference::internal::as_mongoc(rp);
+            })
+            .forever();
+
+        SECTION("partitions") {
+            // The number of ranges is bounded by the number of chunks.
+            std::size_t max_concurrency;
+            std::int32_t expected_last;
+
+            std::tie(max_concurrency, expected_last) = GENERATE(
+                table<std::size_t, std::int32_t>({
+                    {2u, 2},
+                    {3u, 1},
+                    {4u, 1},
+                    {8u, 1},
+                }));
+
+            CAPTURE(max_concurrency);
+
+            chunk_docs.resize(static_cast<std::size_t>(expected_last));
+
+            // Every other range fails to select a server: its error is propagated once the first range completes.
+            CHECK_THROWS_AS(b.download_to_file(pool, file_id, path, max_concurrency), v1::exception);
+
+            CHECK(chunks_find_count == 1);
+            CHECK(first == 0);
+            CHECK(last == expected_last);
+        }
+
+        SECTION("first error") {
+            // The error from the first range is propagated before the errors from any other range.
+            chunks_error = true;
+            chunk_docs.clear();
+
+            try {
+                b.download_to_file(pool, file_id, path, 4u);
+                FAIL("should not reach this point");
+            } catch (v1::exception const& ex) {
+                CHECK_THAT(ex.what(), Catch::Matchers::ContainsSubstring("chunks failure"));
+            }
+        }
+    }
+}
+
 TEST_CASE("ownership", "[mongocxx][v1][gridfs][bucket][options]") {
     bucket::options source;
     bucket::options target;
@@ -16,12 +16,22 @@
 
 //
 
+#include <mongocxx/v1/cursor.hh>
 #include <mongocxx/v1/exception.hpp>
 
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <array>
+#include <cstdint>
 #include <string>
 #include <system_error>
 #include <utility>
 
+#include <mongocxx/private/mock.hh>
+#include <mongocxx/private/mongoc.hh>
+
+#include <bsoncxx/test/system_error.hh>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
@@ -29,6 +39,12 @@ namespace mongocxx {
 namespace v1 {
 namespace gridfs {
 
+namespace {
+
+struct identity_type {};
+
+} // namespace
+
 using code = downloader::errc;
 
 TEST_CASE("error code", "[mongocxx][v1][gridfs][downloader][error]") {
@@ -78,11 +94,13 @@ TEST_CASE("error code", "[mongocxx][v1][gridfs][downloader][error]") {
     SECTION("source") {
         CHECK(make_error_code(code::is_closed) == source_errc::mongocxx);
         CHECK(make_error_code(code::corrupt_data) == source_errc::mongocxx);
+        CHECK(make_error_code(code::digest_mismatch) == source_errc::mongocxx);
     }
 
     SECTION("type") {
         CHECK(make_error_code(code::is_closed) == type_errc::runtime_error);
         CHECK(make_error_code(code::corrupt_data) == type_errc::runtime_error);
+        CHECK(make_error_code(code::digest_mismatch) == type_errc::runtime_error);
     }
 }
 
@@ -112,6 +130,120 @@ TEST_CASE("ownership", "[mongocxx][v1][gridfs][downloader]") {
     }
 }
 
+TEST_CASE("content digest", "[mongocxx][v1][gridfs][downloader]") {
+    identity_type identity;
+
+    auto const cid = reinterpret_cast<mongoc_cursor_t*>(&identity);
+
+    // SHA-256("abc")
+    std::string const abc_digest = "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+
+    // SHA-256("")
+    std::string const empty_digest = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+    scoped_bson const chunk{R"({"n": 0, "data": {"$binary": {"base64": "YWJj", "subType": "00"}}})"};
+    bool has_chunk = true;
+
+    auto cursor_destroy = libmongoc::cursor_destroy.create_instance();
+    cursor_destroy->interpose([&](mongoc_cursor_t* cursor) -> void { CHECK(cursor == cid); }).forever();
+
+    auto cursor_next = libmongoc::cursor_next.create_instance();
+    cursor_next
+        ->interpose([&](mongoc_cursor_t* cursor, bson_t const** bson) -> bool {
+            CHECK(cursor == cid);
+            REQUIRE(bson);
+
+            if (!has_chunk) {
+                return false;
+            }
+
+            has_chunk = false;
+            *bson = chunk.bson();
+            return true;
+        })
+        .forever();
+
+    auto cursor_error_document = libmongoc::cursor_error_document.create_instance();
+    cursor_error_document
+        ->interpose([&](mongoc_cursor_t const* cursor, bson_error_t* err, bson_t const** bson) -> bool {
+            CHECK(cursor == cid);
+            CHECK(err);
+            CHECK(bson);
+            return false;
+        })
+        .forever();
+
+    auto const make = [&](std::string const& metadata, std::int64_t file_length) {
+        scoped_bson const files_doc{
+            R"({"_id": 1, "length": )" + std::to_string(file_length) + R"(, "metadata": )" + metadata + "}"};
+
+        return downloader::internal::make(
+            cursor::internal::make(cid), files_doc.value(), file_length, 255 * 1024, 0, 0);
+    };
+
+    auto const marked = [](std::string const& digest) {
+        return R"({"contentDigest": "sha256", "sha256": ")" + digest + R"("})";
+    };
+
+    std::array<std::uint8_t, 4> buffer = {};
+
+    SECTION("match") {
+        auto d = make(marked(abc_digest), 3);
+
+        CHECK(d.read(buffer.data(), buffer.size()) == 3u);
+        CHECK(d.read(buffer.data(), buffer.size()) == 0u);
+    }
+
+    SECTION("case-insensitive") {
+        std::string upper = abc_digest;
+
+        for (auto& c : upper) {
+            if (c >= 'a' && c <= 'z') {
+                c = static_cast<char>(c - 'a' + 'A');
+            }
+        }
+
+        auto d = make(marked(upper), 3);
+
+        CHECK(d.read(buffer.data(), buffer.size()) == 3u);
+    }
+
+    SECTION("mismatch") {
+        auto d = make(marked(empty_digest), 3);
+
+        CHECK_THROWS_WITH_CODE(d.read(buffer.data(), buffer.size()), code::digest_mismatch);
+    }
+
+    SECTION("unmarked") {
+        auto d = make(R"({"sha256": ")" + empty_digest + R"("})", 3);
+
+        CHECK(d.read(buffer.data(), buffer.size()) == 3u);
+    }
+
+    SECTION("partial") {
+        auto d = make(marked(empty_digest), 3);
+
+        CHECK(d.read(buffer.data(), 1u) == 1u);
+        CHECK_THROWS_WITH_CODE(d.read(buffer.data(), buffer.size()), code::digest_mismatch);
+    }
+
+    SECTION("empty") {
+        has_chunk = false;
+
+        SECTION("match") {
+            auto d = make(marked(empty_digest), 0);
+
+            CHECK(d.read(buffer.data(), buffer.size()) == 0u);
+        }
+
+        SECTION("mismatch") {
+            auto d = make(marked(abc_digest), 0);
+
+            CHECK_THROWS_WITH_CODE(d.read(buffer.data(), buffer.size()), code::digest_mismatch);
+        }
+    }
+}
+
 TEST_CASE("default", "[mongocxx][v1][gridfs][downloader]") {
     downloader const v;
 
@@ -72,6 +72,7 @@ TEST_CASE("default", "[mongocxx][v1][gridfs][upload_options]") {
     upload_options const opts;
 
     CHECK_FALSE(opts.chunk_size_bytes().has_value());
+    CHECK_FALSE(opts.content_digest().has_value());
     CHECK_FALSE(opts.metadata().has_value());
 }
 
@@ -88,6 +89,12 @@ TEST_CASE("chunk_size_bytes", "[mongocxx][v1][gridfs][upload_options]") {
     CHECK(upload_options{}.chunk_size_bytes(v).chunk_size_bytes() == v);
 }
 
+TEST_CASE("content_digest", "[mongocxx][v1][gridfs][upload_options]") {
+    auto const v = upload_options::digest_algorithm::k_sha256;
+
+    CHECK(upload_options{}.content_digest(v).content_digest() == v);
+}
+
 TEST_CASE("metadata", "[mongocxx][v1][gridfs][upload_options]") {
     auto const v = GENERATE(as<scoped_bson>(), R"({})", R"({"x": 1})").value();
 
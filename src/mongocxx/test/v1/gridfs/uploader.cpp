@@ -24,7 +24,10 @@
 #include <bsoncxx/test/v1/stdx/optional.hh>
 #include <bsoncxx/test/v1/types/value.hh>
 
+#include <mongocxx/test/private/scoped_bson.hh>
+
 #include <cstdint>
+#include <iterator>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -195,6 +198,109 @@ TEST_CASE("ownership", "[mongocxx][v1][gridfs][uploader]") {
     }
 }
 
+TEST_CASE("content digest", "[mongocxx][v1][gridfs][uploader]") {
+    struct identity_type {};
+
+    identity_type files_identity;
+    identity_type chunks_identity;
+    auto const files_id = reinterpret_cast<mongoc_collection_t*>(&files_identity);
+    auto const chunks_id = reinterpret_cast<mongoc_collection_t*>(&chunks_identity);
+
+    auto collection_destroy = libmongoc::collection_destroy.create_instance();
+    auto collection_create_bulk_operation_with_opts =
+        libmongoc::collection_create_bulk_operation_with_opts.create_instance();
+    auto bulk_operation_insert_with_opts = libmongoc::bulk_operation_insert_with_opts.create_instance();
+    auto bulk_operation_execute = libmongoc::bulk_operation_execute.create_instance();
+
+    mongoc_collection_t* bulk_coll = nullptr;
+    scoped_bson files_doc;
+
+    collection_destroy
+        ->interpose([&](mongoc_collection_t* ptr) -> void {
+            if (ptr && ptr != files_id && ptr != chunks_id) {
+                FAIL("unexpected mongoc_collection_t");
+            }
+        })
+        .forever();
+
+    collection_create_bulk_operation_with_opts
+        ->interpose([&](mongoc_collection_t* coll, bson_t const* opts) -> mongoc_bulk_operation_t* {
+            CHECK(opts != nullptr);
+            bulk_coll = coll;
+            return nullptr;
+        })
+        .forever();
+
+    bulk_operation_insert_with_opts
+        ->interpose(
+            [&](mongoc_bulk_operation_t* bulk, bson_t const* doc, bson_t const* opts, bson_error_t* error) -> bool {
+                CHECK(bulk == nullptr);
+                REQUIRE(doc != nullptr);
+                CHECK(opts == nullptr);
+                CHECK(error != nullptr);
+
+                if (bulk_coll == files_id) {
+                    files_doc = scoped_bson{doc};
+                }
+
+                return true;
+            })
+        .forever();
+
+    bulk_operation_execute
+        ->interpose([&](mongoc_bulk_operation_t* bulk, bson_t* reply, bson_error_t* error) -> std::uint32_t {
+            CHECK(bulk == nullptr);
+            CHECK(reply != nullptr);
+            CHECK(error != nullptr);
+            return 1u;
+        })
+        .forever();
+
+    scoped_bson const metadata{R"({"x": 1, "sha256": "user", "contentDigest": "user"})"};
+
+    auto const upload = [&](bsoncxx::v1::stdx::optional<upload_options::digest_algorithm> content_digest) {
+        auto u = uploader::internal::make(
+            v1::collection::internal::make(files_id, nullptr),
+            v1::collection::internal::make(chunks_id, nullptr),
+            nullptr,
+            "file",
+            bsoncxx::v1::types::value{std::int32_t{1}},
+            2,
+            metadata.view(),
+            content_digest);
+
+        std::string const data = "abc";
+
+        u.write(reinterpret_cast<std::uint8_t const*>(data.data()), data.size());
+        (void)u.close();
+
+        auto const e = files_doc.view()["metadata"];
+        REQUIRE(e);
+        REQUIRE(e.type_id() == bsoncxx::v1::types::id::k_document);
+
+        return bsoncxx::v1::document::value{e.get_document().value};
+    };
+
+    SECTION("sha256") {
+        auto const m = upload(upload_options::digest_algorithm::k_sha256);
+        auto const v = m.view();
+
+        // Unrelated user-provided fields are preserved.
+        CHECK(v["x"].get_int32().value == 1);
+
+        // User-provided fields with the same names are replaced.
+        CHECK(std::distance(v.begin(), v.end()) == 3);
+        CHECK(v["sha256"].get_string().value == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+        CHECK(v["contentDigest"].get_string().value == "sha256");
+    }
+
+    SECTION("none") {
+        auto const m = upload(bsoncxx::v1::stdx::nullopt);
+
+        CHECK(m.view() == metadata.view());
+    }
+}
+
 TEST_CASE("default", "[mongocxx][v1][gridfs][uploader]") {
     uploader const v;
 
@@ -78,6 +78,7 @@ TEST_CASE("default", "[mongocxx][v1][insert_many_options]") {
     CHECK_FALSE(opts.write_concern().has_value());
     CHECK_FALSE(opts.ordered().has_value());
     CHECK_FALSE(opts.comment().has_value());
+    CHECK_FALSE(opts.report_ids().has_value());
 }
 
 TEST_CASE("bypass_document_validation", "[mongocxx][v1][insert_many_options]") {
@@ -129,5 +130,13 @@ TEST_CASE("comment", "[mongocxx][v1][insert_many_options]") {
     CHECK(insert_many_options{}.comment(v).comment() == v);
 }
 
+TEST_CASE("report_ids", "[mongocxx][v1][insert_many_options]") {
+    using T = insert_many_options::id_mode;
+
+    auto const v = GENERATE(values({T::k_all, T::k_generated, T::k_none}));
+
+    CHECK(insert_many_options{}.report_ids(v).report_ids() == v);
+}
+
 } // namespace v1
 } // namespace mongocxx
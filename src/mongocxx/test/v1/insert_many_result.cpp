@@ -125,6 +125,13 @@ TEST_CASE("basic", "[mongocxx][v1][insert_many_result]") {
                     {2, types::b_string{"three"}},
                 },
             },
+            {
+                scoped_bson{R"({"1": 1, "12": 2.0})"},
+                {
+                    {1, types::b_int32{1}},
+                    {12, types::b_double{2.0}},
+                },
+            },
         }));
 
     auto const res = v1::insert_many_result::internal::make(
@@ -0,0 +1,394 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/parallel_change_stream.hpp>
+
+//
+
+#include <mongocxx/v1/exception.hpp>
+
+#include <mongocxx/v1/change_stream.hh>
+
+#include <bsoncxx/test/v1/document/value.hh>
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/private/bson.hh>
+
+#include <mongocxx/private/mock.hh>
+#include <mongocxx/private/mongoc.hh>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::parallel_change_stream::errc;
+
+namespace {
+
+// Change stream events obtained in order by `change_stream_next()`. Once exhausted, the change stream is idle.
+struct test_data_type {
+    std::vector<scoped_bson> events;
+    std::size_t next = 0u;
+    scoped_bson resume_token;
+};
+
+scoped_bson make_event(std::int32_t seq, std::int32_t id) {
+    return scoped_bson{BCON_NEW(
+        "_id",
+        "{",
+        "seq",
+        BCON_INT32(seq),
+        "}",
+        "operationType",
+        BCON_UTF8("update"),
+        "documentKey",
+        "{",
+        "_id",
+        BCON_INT32(id),
+        "}")};
+}
+
+scoped_bson make_event(std::int32_t seq, char const* op) {
+    return scoped_bson{BCON_NEW("_id", "{", "seq", BCON_INT32(seq), "}", "operationType", BCON_UTF8(op))};
+}
+
+std::int32_t seq_of(bsoncxx::v1::document::view event) {
+    return event["_id"]["seq"].get_int32().value;
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][parallel_change_stream][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::parallel_change_stream::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::parallel_change_stream"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_partition_count;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_partition_count) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_queue_size) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_partition_count) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_queue_size) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][parallel_change_stream][options]") {
+    parallel_change_stream::options const opts;
+
+    CHECK_FALSE(opts.partition_count().has_value());
+    CHECK_FALSE(opts.queue_size().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][parallel_change_stream][options]") {
+    parallel_change_stream::options opts;
+
+    opts.partition_count(2u).queue_size(3u);
+
+    auto const copy = opts;
+
+    CHECK(copy.partition_count() == std::size_t{2});
+    CHECK(copy.queue_size() == std::size_t{3});
+}
+
+TEST_CASE("run", "[mongocxx][v1][parallel_change_stream]") {
+    test_data_type data;
+
+    auto change_stream_destroy = libmongoc::change_stream_destroy.create_instance();
+    change_stream_destroy
+        ->interpose([&](mongoc_change_stream_t* p) -> void { CHECK(reinterpret_cast<test_data_type*>(p) == &data); })
+        .forever();
+
+    auto change_stream_next = libmongoc::change_stream_next.create_instance();
+    change_stream_next
+        ->interpose([&](mongoc_change_stream_t* stream, bson_t const** bson) -> bool {
+            CHECK(reinterpret_cast<test_data_type*>(stream) == &data);
+
+            if (data.next < data.events.size()) {
+                *bson = data.events[data.next++].bson();
+                return true;
+            }
+
+            return false;
+        })
+        .forever();
+
+    auto change_stream_error_document = libmongoc::change_stream_error_document.create_instance();
+    change_stream_error_document
+        ->interpose([&](mongoc_change_stream_t const*, bson_error_t*, bson_t const**) -> bool { return false; })
+        .forever();
+
+    auto change_stream_get_resume_token = libmongoc::change_stream_get_resume_token.create_instance();
+    change_stream_get_resume_token
+        ->interpose([&](mongoc_change_stream_t*) -> bson_t const* {
+            return data.resume_token.view().empty() ? nullptr : data.resume_token.bson();
+        })
+        .forever();
+
+    auto stream = change_stream::internal::make(reinterpret_cast<mongoc_change_stream_t*>(&data));
+
+    SECTION("exceptions") {
+        CHECK_THROWS_WITH_CODE(
+            (parallel_change_stream{stream, parallel_change_stream::options{}.partition_count(0u)}),
+            code::invalid_partition_count);
+        CHECK_THROWS_WITH_CODE(
+            (parallel_change_stream{stream, parallel_change_stream::options{}.queue_size(0u)}),
+            code::invalid_queue_size);
+    }
+
+    SECTION("ownership") {
+        parallel_change_stream source{stream, parallel_change_stream::options{}.partition_count(2u)};
+        parallel_change_stream target{stream, parallel_change_stream::options{}.partition_count(3u)};
+
+        SECTION("move") {
+            auto move = std::move(source);
+
+            CHECK_FALSE(source);
+            REQUIRE(move);
+            CHECK(move.partition_count() == 2u);
+        }
+
+        SECTION("move assignment") {
+            target = std::move(source);
+
+            CHECK_FALSE(source);
+            REQUIRE(target);
+            CHECK(target.partition_count() == 2u);
+        }
+    }
+
+    SECTION("ordering") {
+        constexpr std::int32_t keys = 8;
+        constexpr std::int32_t rounds = 16;
+
+        std::int32_t seq = 0;
+
+        for (std::int32_t r = 0; r < rounds; ++r) {
+            for (std::int32_t k = 0; k < keys; ++k) {
+                data.events.push_back(make_event(seq++, k));
+            }
+        }
+
+        data.events.push_back(make_event(seq, "invalidate"));
+
+        parallel_change_stream pcs{stream, parallel_change_stream::options{}.partition_count(4u).queue_size(2u)};
+
+        CHECK_FALSE(pcs.resume_token().has_value());
+
+        std::mutex mutex;
+        std::map<std::int32_t, std::vector<std::int32_t>> seqs; // By document key.
+        std::map<std::int32_t, std::size_t> partitions;         // By document key.
+        std::vector<std::int32_t> isolated;
+        std::size_t moved = 0u; // Events of a document key processed by a different partition.
+
+        pcs.run([&](std::size_t partition, bsoncxx::v1::document::view event) {
+            std::lock_guard<std::mutex> lock{mutex};
+
+            auto const key = event["documentKey"]["_id"];
+
+            if (!key) {
+                isolated.push_back(seq_of(event));
+                return;
+            }
+
+            auto const k = key.get_int32().value;
+
+            seqs[k].push_back(seq_of(event));
+
+            if (partitions.emplace(k, partition).first->second != partition) {
+                ++moved;
+            }
+        });
+
+        CHECK(moved == 0u);
+
+        REQUIRE(seqs.size() == static_cast<std::size_t>(keys));
+
+        for (auto const& kv : seqs) {
+            REQUIRE(kv.second.size() == static_cast<std::size_t>(rounds));
+
+            for (std::int32_t r = 0; r < rounds; ++r) {
+                CHECK(kv.second[static_cast<std::size_t>(r)] == r * keys + kv.first);
+            }
+        }
+
+        CHECK(isolated == std::vector<std::int32_t>{seq});
+
+        // The change stream was invalidated: every event, including the "invalidate" event, has been processed.
+        CHECK(pcs.resume_token() == scoped_bson{BCON_NEW("seq", BCON_INT32(seq))}.view());
+    }
+
+    SECTION("isolation") {
+        data.events.push_back(make_event(0, 1));
+        data.events.push_back(make_event(1, 2));
+        data.events.push_back(make_event(2, "drop"));
+        data.events.push_back(make_event(3, 1));
+        data.events.push_back(make_event(4, 2));
+        data.events.push_back(make_event(5, "invalidate"));
+
+        parallel_change_stream pcs{stream, parallel_change_stream::options{}.partition_count(2u)};
+
+        std::mutex mutex;
+        std::vector<std::int32_t> order;
+
+        pcs.run([&](std::size_t, bsoncxx::v1::document::view event) {
+            // Give subsequent events an opportunity to overtake this event.
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(seq_of(event));
+        });
+
+        REQUIRE(order.size() == 6u);
+
+        // Events with a document key may be processed in any order relative to each other, but never relative to an
+        // event without a document key.
+        CHECK(order[2] == 2);
+        CHECK(order[5] == 5);
+    }
+
+    SECTION("exception") {
+        data.events.push_back(make_event(0, 1));
+        data.events.push_back(make_event(1, 1));
+        data.events.push_back(make_event(2, 1));
+
+        parallel_change_stream pcs{stream, parallel_change_stream::options{}.partition_count(1u)};
+
+        std::vector<std::int32_t> processed;
+
+        auto const fn = [&](std::size_t, bsoncxx::v1::document::view event) {
+            auto const seq = seq_of(event);
+
+            if (seq == 1) {
+                throw std::runtime_error{"fn"};
+            }
+
+            processed.push_back(seq);
+        };
+
+        CHECK_THROWS_WITH(pcs.run(fn), Catch::Matchers::Equals("fn"));
+
+        CHECK(processed == std::vector<std::int32_t>{0});
+
+        // The resume token never advances past an event which has not been processed.
+        CHECK(pcs.resume_token() == scoped_bson{R"({"seq": 0})"}.view());
+    }
+
+    SECTION("stop") {
+        data.events.push_back(make_event(0, 1));
+        data.events.push_back(make_event(1, 2));
+        data.resume_token = scoped_bson{R"({"postBatchResumeToken": 1})"};
+
+        parallel_change_stream pcs{stream, parallel_change_stream::options{}.partition_count(2u)};
+
+        std::mutex mutex;
+        std::vector<std::int32_t> processed;
+
+        // Once every event has been processed, the resume token of the idle change stream is reported.
+        std::thread stopper{[&] {
+            while (pcs.resume_token() != data.resume_token.view()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds{1});
+            }
+
+            pcs.stop();
+        }};
+
+        pcs.run([&](std::size_t, bsoncxx::v1::document::view event) {
+            std::lock_guard<std::mutex> lock{mutex};
+            processed.push_back(seq_of(event));
+        });
+
+        stopper.join();
+
+        CHECK(processed.size() == 2u);
+        CHECK(pcs.resume_token() == data.resume_token.view());
+    }
+
+    SECTION("stop before run") {
+        data.events.push_back(make_event(0, 1));
+
+        parallel_change_stream pcs{stream};
+
+        pcs.stop();
+
+        std::size_t count = 0u;
+
+        pcs.run([&](std::size_t, bsoncxx::v1::document::view) { ++count; });
+
+        CHECK(count == 0u);
+        CHECK(data.next == 0u);
+        CHECK_FALSE(pcs.resume_token().has_value());
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
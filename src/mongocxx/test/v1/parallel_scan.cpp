@@ -0,0 +1,353 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/parallel_scan.hh>
+
+//
+
+#include <bsoncxx/v1/array/value.hpp>
+#include <bsoncxx/v1/document/value.hpp>
+#include <bsoncxx/v1/types/value.hpp>
+
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/find_options.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <bsoncxx/test/v1/document/value.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::parallel_scan::errc;
+
+TEST_CASE("error code", "[mongocxx][v1][parallel_scan][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::parallel_scan::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::parallel_scan"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_partition_count;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_partition_count) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_key) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_sample_size) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_buffer_size) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_boundaries) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_find_options) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_partition_count) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_key) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_sample_size) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_buffer_size) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_boundaries) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_find_options) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][parallel_scan][options]") {
+    parallel_scan::options const opts;
+
+    CHECK_FALSE(opts.boundaries().has_value());
+    CHECK_FALSE(opts.buffer_size().has_value());
+    CHECK_FALSE(opts.filter().has_value());
+    CHECK_FALSE(opts.find_options().has_value());
+    CHECK_FALSE(opts.key().has_value());
+    CHECK_FALSE(opts.partition_count().has_value());
+    CHECK_FALSE(opts.sample_size().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][parallel_scan][options]") {
+    scoped_bson const boundaries{R"({"0": 10, "1": 20})"};
+    scoped_bson const filter{R"({"x": 1})"};
+
+    parallel_scan::options opts;
+
+    opts.boundaries(bsoncxx::v1::array::value{boundaries.array_view()})
+        .buffer_size(2u)
+        .filter(filter.value())
+        .find_options(v1::find_options{}.batch_size(3))
+        .key("k")
+        .partition_count(4u)
+        .sample_size(5);
+
+    auto const copy = opts;
+
+    CHECK(copy.boundaries() == boundaries.array_view());
+    CHECK(copy.buffer_size() == std::size_t{2});
+    CHECK(copy.filter() == filter.view());
+    REQUIRE(copy.find_options().has_value());
+    CHECK(copy.find_options()->batch_size() == 3);
+    CHECK(copy.key() == "k");
+    CHECK(copy.partition_count() == std::size_t{4});
+    CHECK(copy.sample_size() == 5);
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][parallel_scan]") {
+    v1::pool pool;
+
+    SECTION("invalid_partition_count") {
+        CHECK_THROWS_WITH_CODE(
+            (parallel_scan{pool, "db", "coll", parallel_scan::options{}.partition_count(0u)}),
+            code::invalid_partition_count);
+    }
+
+    SECTION("invalid_key") {
+        CHECK_THROWS_WITH_CODE(
+            (parallel_scan{pool, "db", "coll", parallel_scan::options{}.key("")}), code::invalid_key);
+    }
+
+    SECTION("invalid_sample_size") {
+        CHECK_THROWS_WITH_CODE(
+            (parallel_scan{pool, "db", "coll", parallel_scan::options{}.sample_size(0)}), code::invalid_sample_size);
+    }
+
+    SECTION("invalid_buffer_size") {
+        CHECK_THROWS_WITH_CODE(
+            (parallel_scan{pool, "db", "coll", parallel_scan::options{}.buffer_size(0u)}), code::invalid_buffer_size);
+    }
+
+    SECTION("invalid_boundaries") {
+        auto const json = GENERATE(
+            R"({"0": 1, "1": "two"})",
+            R"({"0": 2, "1": 1})",
+            R"({"0": 1, "1": 1})",
+            R"({"0": "a", "1": "c", "2": "b"})",
+            R"({"0": {"x": 1}})",
+            R"({"0": [1], "1": [2]})");
+        CAPTURE(json);
+
+        scoped_bson const boundaries{json};
+
+        CHECK_THROWS_WITH_CODE(
+            (parallel_scan{
+                pool,
+                "db",
+                "coll",
+                parallel_scan::options{}.boundaries(bsoncxx::v1::array::value{boundaries.array_view()})}),
+            code::invalid_boundaries);
+    }
+
+    SECTION("invalid_find_options") {
+        SECTION("limit") {
+            CHECK_THROWS_WITH_CODE(
+                (parallel_scan{pool, "db", "coll", parallel_scan::options{}.find_options(v1::find_options{}.limit(1))}),
+                code::invalid_find_options);
+        }
+
+        SECTION("skip") {
+            CHECK_THROWS_WITH_CODE(
+                (parallel_scan{pool, "db", "coll", parallel_scan::options{}.find_options(v1::find_options{}.skip(1))}),
+                code::invalid_find_options);
+        }
+
+        SECTION("sort") {
+            scoped_bson const sort{R"({"x": 1})"};
+
+            CHECK_THROWS_WITH_CODE(
+                (parallel_scan{
+                    pool, "db", "coll", parallel_scan::options{}.find_options(v1::find_options{}.sort(sort.value()))}),
+                code::invalid_find_options);
+        }
+    }
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][parallel_scan]") {
+    v1::pool pool;
+
+    scoped_bson const empty;
+
+    parallel_scan source{
+        pool, "db", "source", parallel_scan::options{}.boundaries(bsoncxx::v1::array::value{empty.array_view()})};
+    parallel_scan target{pool, "db", "target"};
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.partition_filters().size() == 1u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.partition_filters().size() == 1u);
+    }
+}
+
+TEST_CASE("make_filters", "[mongocxx][v1][parallel_scan]") {
+    using bsoncxx::v1::types::value;
+
+    auto const make_filters = parallel_scan::internal::make_filters;
+
+    SECTION("none") {
+        scoped_bson const filter{R"({"x": 1})"};
+
+        auto const filters = make_filters(filter.view(), "_id", {});
+
+        REQUIRE(filters.size() == 1u);
+        CHECK(filters[0] == filter.view());
+    }
+
+    SECTION("one") {
+        auto const filters = make_filters({}, "_id", {value{std::int32_t{10}}});
+
+        REQUIRE(filters.size() == 2u);
+        CHECK(
+            filters[0] ==
+            scoped_bson{R"({"$or": [{"_id": {"$not": {"$gte": 10}}}, {"_id": {"$type": "array"}}]})"}.view());
+        CHECK(filters[1] == scoped_bson{R"({"_id": {"$gte": 10, "$not": {"$type": "array"}}})"}.view());
+    }
+
+    SECTION("many") {
+        auto const filters = make_filters({}, "a.b", {value{std::int32_t{10}}, value{std::int32_t{20}}});
+
+        REQUIRE(filters.size() == 3u);
+        CHECK(
+            filters[0] == scoped_bson{R"({"$or": [)"
+                                      R"({"a.b": {"$not": {"$gte": 10}}}, {"a.b": {"$type": "array"}}, )"
+                                      R"({"a": {"$type": "array"}}]})"}
+                              .view());
+        CHECK(
+            filters[1] == scoped_bson{R"({"a.b": {"$gte": 10, "$lt": 20, "$not": {"$type": "array"}}, )"
+                                      R"("a": {"$not": {"$type": "array"}}})"}
+                              .view());
+        CHECK(
+            filters[2] == scoped_bson{R"({"a.b": {"$gte": 20, "$not": {"$type": "array"}}, )"
+                                      R"("a": {"$not": {"$type": "array"}}})"}
+                              .view());
+    }
+
+    SECTION("nested") {
+        auto const filters = make_filters({}, "a.b.c", {value{std::int32_t{10}}});
+
+        REQUIRE(filters.size() == 2u);
+        CHECK(
+            filters[0] == scoped_bson{R"({"$or": [)"
+                                      R"({"a.b.c": {"$not": {"$gte": 10}}}, {"a.b.c": {"$type": "array"}}, )"
+                                      R"({"a": {"$type": "array"}}, {"a.b": {"$type": "array"}}]})"}
+                              .view());
+        CHECK(
+            filters[1] == scoped_bson{R"({"a.b.c": {"$gte": 10, "$not": {"$type": "array"}}, )"
+                                      R"("a": {"$not": {"$type": "array"}}, "a.b": {"$not": {"$type": "array"}}})"}
+                              .view());
+    }
+
+    SECTION("filter") {
+        scoped_bson const filter{R"({"x": 1})"};
+
+        auto const filters = make_filters(filter.view(), "_id", {value{std::int32_t{10}}});
+
+        scoped_bson const first{
+            R"({"$and": [{"x": 1}, {"$or": [{"_id": {"$not": {"$gte": 10}}}, {"_id": {"$type": "array"}}]}]})"};
+
+        REQUIRE(filters.size() == 2u);
+        CHECK(filters[0] == first.view());
+        CHECK(
+            filters[1] ==
+            scoped_bson{R"({"$and": [{"x": 1}, {"_id": {"$gte": 10, "$not": {"$type": "array"}}}]})"}.view());
+    }
+}
+
+TEST_CASE("scan", "[mongocxx][v1][parallel_scan]") {
+    // No server is listening on this port: every partition fails server selection.
+    v1::pool pool{v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"}};
+
+    scoped_bson const boundaries{R"({"0": 10, "1": 20, "2": 30})"};
+
+    parallel_scan const scanner{
+        pool, "db", "coll", parallel_scan::options{}.boundaries(bsoncxx::v1::array::value{boundaries.array_view()})};
+
+    CHECK(scanner.partition_filters().size() == 4u);
+
+    std::atomic<int> count{0};
+
+    SECTION("for_each_partition") {
+        CHECK_THROWS_AS(
+            scanner.for_each_partition([&](std::size_t, bsoncxx::v1::document::view) { ++count; }), v1::exception);
+    }
+
+    SECTION("for_each") {
+        CHECK_THROWS_AS(scanner.for_each([&](bsoncxx::v1::document::view) { ++count; }), v1::exception);
+    }
+
+    SECTION("sample") {
+        parallel_scan const sampled{pool, "db", "coll"};
+
+        CHECK_THROWS_AS(sampled.partition_filters(), v1::exception);
+    }
+
+    CHECK(count == 0);
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,417 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/pipelined_insert.hh>
+
+//
+
+#include <bsoncxx/v1/document/view.hpp>
+
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/insert_many_options.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+// Note: no server is listening on the port used by these tests. Batches are only inserted via the function given to
+// `pipelined_insert::internal::set_send()`, which is invoked on background threads.
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::pipelined_insert::errc;
+
+namespace {
+
+v1::uri unreachable() {
+    return v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"};
+}
+
+// Records the "x" field of each document of each batch.
+struct recorder {
+    std::mutex mutex;
+    std::vector<std::vector<std::int32_t>> batches;
+    std::atomic<int> in_flight{0};
+    std::atomic<int> max_in_flight{0};
+    int fail_at = -1; // The value of "x" of the first document of the batch to fail.
+
+    pipelined_insert::internal::send_type send() {
+        return [this](std::vector<bsoncxx::v1::document::view> const& docs) -> std::int64_t {
+            auto const current = ++in_flight;
+
+            auto prev = max_in_flight.load();
+
+            while (prev < current && !max_in_flight.compare_exchange_weak(prev, current)) {
+            }
+
+            std::vector<std::int32_t> xs;
+
+            for (auto const& doc : docs) {
+                xs.push_back(doc["x"].get_int32().value);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                batches.push_back(xs);
+            }
+
+            --in_flight;
+
+            if (!xs.empty() && xs.front() == fail_at) {
+                throw std::runtime_error{"fail"};
+            }
+
+            return static_cast<std::int64_t>(xs.size());
+        };
+    }
+};
+
+std::vector<scoped_bson> make_docs(std::int32_t n) {
+    std::vector<scoped_bson> ret;
+
+    for (std::int32_t i = 0; i < n; ++i) {
+        ret.emplace_back(R"({"x": )" + std::to_string(i) + "}");
+    }
+
+    return ret;
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][pipelined_insert][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::pipelined_insert::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::pipelined_insert"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_max_in_flight;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_max_batch_count) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_max_batch_size) == source_errc::mongocxx);
+        CHECK(make_error_code(code::invalid_max_in_flight) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_max_batch_count) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_max_batch_size) == type_errc::invalid_argument);
+        CHECK(make_error_code(code::invalid_max_in_flight) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][pipelined_insert][options]") {
+    pipelined_insert::options const opts;
+
+    CHECK_FALSE(opts.insert_many_options().has_value());
+    CHECK_FALSE(opts.max_batch_count().has_value());
+    CHECK_FALSE(opts.max_batch_size().has_value());
+    CHECK_FALSE(opts.max_in_flight().has_value());
+    CHECK_FALSE(opts.on_batch());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][pipelined_insert][options]") {
+    pipelined_insert::options opts;
+
+    opts.insert_many_options(v1::insert_many_options{}.ordered(false))
+        .max_batch_count(1u)
+        .max_batch_size(2u)
+        .max_in_flight(3u)
+        .on_batch([](pipelined_insert::batch_result const&) {});
+
+    auto const copy = opts;
+
+    REQUIRE(copy.insert_many_options().has_value());
+    CHECK(copy.insert_many_options()->ordered() == false);
+    CHECK(copy.max_batch_count() == std::size_t{1});
+    CHECK(copy.max_batch_size() == std::size_t{2});
+    CHECK(copy.max_in_flight() == std::size_t{3});
+    CHECK(copy.on_batch());
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][pipelined_insert]") {
+    v1::pool pool{unreachable()};
+
+    CHECK_THROWS_WITH_CODE(
+        (pipelined_insert{pool, "db", "coll", pipelined_insert::options{}.max_batch_count(0u)}),
+        code::invalid_max_batch_count);
+    CHECK_THROWS_WITH_CODE(
+        (pipelined_insert{pool, "db", "coll", pipelined_insert::options{}.max_batch_size(0u)}),
+        code::invalid_max_batch_size);
+    CHECK_THROWS_WITH_CODE(
+        (pipelined_insert{pool, "db", "coll", pipelined_insert::options{}.max_in_flight(0u)}),
+        code::invalid_max_in_flight);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][pipelined_insert]") {
+    v1::pool pool{unreachable()};
+
+    pipelined_insert source{pool, "db", "source"};
+    pipelined_insert target{pool, "db", "target"};
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.finish().batches == 0u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.finish().batches == 0u);
+    }
+}
+
+TEST_CASE("batches", "[mongocxx][v1][pipelined_insert]") {
+    v1::pool pool{unreachable()};
+    recorder rec;
+
+    auto const docs = make_docs(10);
+    auto const doc_size = docs.front().view().length(); // Every document has the same size.
+
+    std::vector<pipelined_insert::batch_result> results;
+
+    auto const opts = pipelined_insert::options{}.on_batch(
+        [&](pipelined_insert::batch_result const& result) { results.push_back(result); });
+
+    SECTION("count") {
+        pipelined_insert inserter{pool, "db", "coll", pipelined_insert::options{opts}.max_batch_count(4u)};
+        pipelined_insert::internal::set_send(inserter, rec.send());
+
+        for (auto const& doc : docs) {
+            inserter.append(doc.view());
+        }
+
+        auto const summary = inserter.finish();
+
+        CHECK(summary.batches == 3u);
+        CHECK(summary.documents == 10u);
+        CHECK(summary.inserted_count == 10);
+
+        REQUIRE(rec.batches.size() == 3u);
+        CHECK(rec.batches[0] == std::vector<std::int32_t>({0, 1, 2, 3}));
+        CHECK(rec.batches[1] == std::vector<std::int32_t>({4, 5, 6, 7}));
+        CHECK(rec.batches[2] == std::vector<std::int32_t>({8, 9}));
+
+        // Ordered: one batch in flight at a time, reported in order.
+        CHECK(rec.max_in_flight == 1);
+
+        REQUIRE(results.size() == 3u);
+
+        for (std::size_t i = 0u; i < results.size(); ++i) {
+            CHECK(results[i].index == i);
+            CHECK(results[i].offset == 4u * i);
+            CHECK(results[i].size == results[i].count * doc_size);
+            CHECK_FALSE(results[i].error);
+        }
+
+        CHECK(results[2].count == 2u);
+    }
+
+    SECTION("size") {
+        pipelined_insert inserter{pool, "db", "coll", pipelined_insert::options{opts}.max_batch_size(3u * doc_size)};
+        pipelined_insert::internal::set_send(inserter, rec.send());
+
+        std::vector<bsoncxx::v1::document::view> views;
+
+        for (auto const& doc : docs) {
+            views.push_back(doc.view());
+        }
+
+        inserter.append(views.begin(), views.end());
+
+        CHECK(inserter.finish().batches == 4u);
+
+        REQUIRE(rec.batches.size() == 4u);
+        CHECK(rec.batches[0].size() == 3u);
+        CHECK(rec.batches[3].size() == 1u);
+    }
+
+    SECTION("oversized") {
+        pipelined_insert inserter{pool, "db", "coll", pipelined_insert::options{opts}.max_batch_size(1u)};
+        pipelined_insert::internal::set_send(inserter, rec.send());
+
+        inserter.append(docs[0].view());
+        inserter.append(docs[1].view());
+
+        CHECK(inserter.finish().batches == 2u);
+        CHECK(rec.batches.size() == 2u);
+    }
+
+    SECTION("unordered") {
+        pipelined_insert inserter{
+            pool,
+            "db",
+            "coll",
+            pipelined_insert::options{opts}
+                .insert_many_options(v1::insert_many_options{}.ordered(false))
+                .max_batch_count(1u)
+                .max_in_flight(3u)};
+        pipelined_insert::internal::set_send(inserter, rec.send());
+
+        rec.fail_at = 2;
+
+        for (auto const& doc : docs) {
+            inserter.append(doc.view());
+        }
+
+        // Every batch is inserted despite the error.
+        CHECK_THROWS_AS(inserter.finish(), std::runtime_error);
+
+        CHECK(rec.batches.size() == 10u);
+        CHECK(rec.max_in_flight <= 3);
+
+        REQUIRE(results.size() == 10u);
+
+        std::size_t failed = 0u;
+        std::int64_t inserted = 0;
+
+        for (auto const& result : results) {
+            if (result.error) {
+                ++failed;
+                CHECK(result.index == 2u);
+            }
+
+            inserted += result.inserted_count;
+        }
+
+        CHECK(failed == 1u);
+        CHECK(inserted == 9);
+    }
+
+    SECTION("ordered error") {
+        pipelined_insert inserter{pool, "db", "coll", pipelined_insert::options{opts}.max_batch_count(2u)};
+        pipelined_insert::internal::set_send(inserter, rec.send());
+
+        rec.fail_at = 2;
+
+        // The error is reported by a subsequent call to `append()` (or `finish()`).
+        CHECK_THROWS_AS(
+            [&] {
+                for (auto const& doc : docs) {
+                    inserter.append(doc.view());
+                }
+
+                (void)inserter.finish();
+            }(),
+            std::runtime_error);
+
+        // No further batch is inserted after the failed batch.
+        REQUIRE(rec.batches.size() == 2u);
+        CHECK(rec.batches[1] == std::vector<std::int32_t>({2, 3}));
+
+        CHECK_THROWS_AS(inserter.finish(), std::runtime_error);
+        CHECK(rec.batches.size() == 2u);
+    }
+
+    SECTION("handler error") {
+        bool thrown = false;
+
+        pipelined_insert inserter{
+            pool,
+            "db",
+            "coll",
+            pipelined_insert::options{}.max_batch_count(1u).on_batch(
+                [&](pipelined_insert::batch_result const& result) {
+                    results.push_back(result);
+
+                    if (!thrown) {
+                        thrown = true;
+                        throw std::runtime_error{"handler"};
+                    }
+                })};
+        pipelined_insert::internal::set_send(inserter, rec.send());
+
+        CHECK_THROWS_AS(
+            [&] {
+                for (auto const& doc : docs) {
+                    inserter.append(doc.view());
+                }
+
+                (void)inserter.finish();
+            }(),
+            std::runtime_error);
+
+        // The results which were not reported when the handler threw are reported and counted by the next call.
+        auto const summary = inserter.finish();
+
+        CHECK(summary.batches == rec.batches.size());
+        CHECK(summary.documents == rec.batches.size());
+        CHECK(summary.inserted_count == static_cast<std::int64_t>(rec.batches.size()));
+
+        REQUIRE(results.size() == rec.batches.size());
+
+        for (std::size_t i = 0u; i < results.size(); ++i) {
+            CHECK(results[i].index == i);
+        }
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
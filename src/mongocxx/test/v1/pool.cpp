@@ -26,6 +26,7 @@
 #include <mongocxx/v1/database.hh>
 #include <mongocxx/v1/uri.hh>
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -867,6 +868,168 @@ TEST_CASE("try_acquire", "[mongocxx][v1][pool]") {
     }
 }
 
+TEST_CASE("warm_up", "[mongocxx][v1][pool]") {
+    using clock = std::chrono::steady_clock;
+
+    SECTION("mocked") {
+        pool_mocks_type mocks;
+
+        auto pool = mocks.make();
+
+        SECTION("zero") {
+            CHECK(pool.warm_up(0u, clock::now() + std::chrono::hours{1}) == 0u);
+        }
+
+        SECTION("deadline") {
+            CHECK(pool.warm_up(3u, clock::now() - std::chrono::hours{1}) == 0u);
+        }
+
+        SECTION("none") {
+            int try_pop_count = 0;
+
+            mocks.try_pop->interpose([&](mongoc_client_pool_t* ptr) -> mongoc_client_t* {
+                CHECK(ptr == mocks.pool_id);
+                ++try_pop_count;
+                return nullptr;
+            });
+
+            CHECK(pool.warm_up(3u, clock::now() + std::chrono::hours{1}) == 0u);
+            CHECK(try_pop_count == 1);
+        }
+    }
+
+    SECTION("unreachable") {
+        // No server is listening on this port: every connection fails server selection.
+        v1::pool pool{v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"}};
+
+        CHECK(pool.warm_up(3u, clock::now() + std::chrono::hours{1}) == 0u);
+
+        // All client objects were released back into the pool.
+        for (int i = 0; i < 3; ++i) {
+            CHECK(pool.try_acquire().has_value());
+        }
+    }
+}
+
+TEST_CASE("stats", "[mongocxx][v1][pool]") {
+    pool_mocks_type mocks;
+
+    auto pool = mocks.make();
+
+    identity_type client_identity;
+    auto const client_id = reinterpret_cast<mongoc_client_t*>(&client_identity);
+
+    auto client_destroy = libmongoc::client_destroy.create_instance();
+    auto push = libmongoc::client_pool_push.create_instance();
+
+    client_destroy
+        ->interpose([&](mongoc_client_t* ptr) {
+            CHECK(ptr == nullptr); // Always released back into mongoc_client_pool_t.
+        })
+        .forever();
+
+    push
+        ->interpose([&](mongoc_client_pool_t* ptr, mongoc_client_t* client) -> void {
+            CHECK(ptr == mocks.pool_id);
+            CHECK(client == client_id);
+        })
+        .forever();
+
+    auto const histogram_total = [](pool::acquire_stats const& stats) {
+        std::int64_t ret = 0;
+        for (auto const count : stats.wait_histogram) {
+            ret += count;
+        }
+        return ret;
+    };
+
+    {
+        auto const stats = pool.stats();
+
+        CHECK(stats.acquired == 0);
+        CHECK(stats.timeouts == 0);
+        CHECK(stats.misses == 0);
+        CHECK(stats.in_use == 0);
+        CHECK(stats.idle == 0);
+        CHECK(stats.peak_in_use == 0);
+        CHECK(stats.wait_time == std::chrono::nanoseconds{0});
+        CHECK(histogram_total(stats) == 0);
+    }
+
+    SECTION("acquire") {
+        mocks.pop
+            ->interpose([&](mongoc_client_pool_t* ptr) -> mongoc_client_t* {
+                CHECK(ptr == mocks.pool_id);
+                return client_id;
+            })
+            .forever();
+
+        {
+            auto e1 = pool.acquire();
+            auto e2 = pool.acquire();
+
+            auto const stats = pool.stats();
+
+            CHECK(stats.acquired == 2);
+            CHECK(stats.in_use == 2);
+            CHECK(stats.idle == 0);
+            CHECK(stats.peak_in_use == 2);
+            CHECK(histogram_total(stats) == 2);
+
+            e1 = nullptr;
+
+            CHECK(pool.stats().in_use == 1);
+            CHECK(pool.stats().idle == 1);
+        }
+
+        auto const stats = pool.stats();
+
+        CHECK(stats.acquired == 2);
+        CHECK(stats.in_use == 0);
+        CHECK(stats.idle == 2);
+        CHECK(stats.peak_in_use == 2);
+    }
+
+    SECTION("timeout") {
+        mocks.pop->interpose([&](mongoc_client_pool_t* ptr) -> mongoc_client_t* {
+            CHECK(ptr == mocks.pool_id);
+            return nullptr;
+        });
+
+        CHECK_THROWS_WITH_CODE(pool.acquire(), code::wait_queue_timeout);
+
+        auto const stats = pool.stats();
+
+        CHECK(stats.acquired == 0);
+        CHECK(stats.timeouts == 1);
+        CHECK(histogram_total(stats) == 0);
+    }
+
+    SECTION("try_acquire") {
+        mocks.try_pop->interpose([&](mongoc_client_pool_t* ptr) -> mongoc_client_t* {
+            CHECK(ptr == mocks.pool_id);
+            return nullptr;
+        });
+
+        CHECK_FALSE(pool.try_acquire().has_value());
+
+        mocks.try_pop->interpose([&](mongoc_client_pool_t* ptr) -> mongoc_client_t* {
+            CHECK(ptr == mocks.pool_id);
+            return client_id;
+        });
+
+        CHECK(pool.try_acquire().has_value());
+
+        auto const stats = pool.stats();
+
+        CHECK(stats.acquired == 1);
+        CHECK(stats.misses == 1);
+        CHECK(stats.in_use == 0);
+        CHECK(stats.idle == 1);
+        CHECK(histogram_total(stats) == 1);
+    }
+}
+
 TEST_CASE("release", "[mongocxx][v1][pool][entry]") {
     pool_mocks_type mocks;
     entry_mocks_type entry_mocks{mocks};
@@ -0,0 +1,165 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/prepared_aggregate.hpp>
+
+//
+
+#include <mongocxx/v1/aggregate_options.hpp>
+#include <mongocxx/v1/pipeline.hpp>
+
+#include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/cursor.hh>
+
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <string>
+#include <utility>
+
+#include <mongocxx/private/mongoc.hh>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+namespace {
+
+struct identity_type {};
+
+} // namespace
+
+TEST_CASE("ownership", "[mongocxx][v1][prepared_aggregate]") {
+    prepared_aggregate source{v1::pipeline{}.limit(1)};
+    prepared_aggregate target{v1::pipeline{}};
+
+    REQUIRE(source);
+    REQUIRE(target);
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(move);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(target);
+    }
+
+    SECTION("copy") {
+        auto copy = source;
+
+        CHECK(source);
+        CHECK(copy);
+    }
+
+    SECTION("copy assignment") {
+        target = source;
+
+        CHECK(source);
+        CHECK(target);
+    }
+}
+
+TEST_CASE("execute", "[mongocxx][v1][prepared_aggregate]") {
+    identity_type client_identity;
+    identity_type collection_identity;
+    identity_type cursor_identity;
+
+    auto const client_id = reinterpret_cast<mongoc_client_t*>(&client_identity);
+    auto const collection_id = reinterpret_cast<mongoc_collection_t*>(&collection_identity);
+    auto const cursor_id = reinterpret_cast<mongoc_cursor_t*>(&cursor_identity);
+
+    auto collection_destroy = libmongoc::collection_destroy.create_instance();
+    auto cursor_destroy = libmongoc::cursor_destroy.create_instance();
+    auto aggregate = libmongoc::collection_aggregate.create_instance();
+
+    collection_destroy->interpose([&](mongoc_collection_t* ptr) -> void { CHECK(ptr == collection_id); }).forever();
+    cursor_destroy->interpose([&](mongoc_cursor_t* ptr) -> void { CHECK(ptr == cursor_id); }).forever();
+
+    scoped_bson const group{R"({"_id": "$k", "n": {"$sum": 1}})"};
+    scoped_bson const sort{R"({"n": -1})"};
+
+    prepared_aggregate const prepared{
+        v1::pipeline{}.group(group.view()).sort(sort.view()), v1::aggregate_options{}.batch_size(3)};
+
+    scoped_bson const expected_opts{R"({"batchSize": 3})"};
+
+    int count = 0;
+    bsoncxx::v1::document::view expected;
+
+    aggregate
+        ->interpose([&](mongoc_collection_t* coll,
+                        mongoc_query_flags_t flags,
+                        bson_t const* pipeline,
+                        bson_t const* opts,
+                        mongoc_read_prefs_t const* read_prefs) -> mongoc_cursor_t* {
+            CHECK(coll == collection_id);
+            CHECK(flags == MONGOC_QUERY_NONE);
+            CHECK(scoped_bson_view{pipeline}.view() == expected);
+            CHECK(scoped_bson_view{opts}.view() == expected_opts.view());
+            CHECK(read_prefs == nullptr);
+            ++count;
+            return cursor_id;
+        })
+        .forever();
+
+    auto coll = v1::collection::internal::make(collection_id, client_id);
+
+    scoped_bson const unfiltered{R"({"0": {"$group": {"_id": "$k", "n": {"$sum": 1}}}, "1": {"$sort": {"n": -1}}})"};
+
+    SECTION("unfiltered") {
+        expected = unfiltered.view();
+
+        (void)prepared.execute(coll);
+        (void)prepared.execute(coll, scoped_bson{}.view());
+
+        CHECK(count == 2);
+    }
+
+    SECTION("filtered") {
+        scoped_bson const a{R"({"0": {"$match": {"a": 1}}, )"
+                            R"("1": {"$group": {"_id": "$k", "n": {"$sum": 1}}}, "2": {"$sort": {"n": -1}}})"};
+        scoped_bson const b{R"({"0": {"$match": {"b": 2}}, )"
+                            R"("1": {"$group": {"_id": "$k", "n": {"$sum": 1}}}, "2": {"$sort": {"n": -1}}})"};
+
+        expected = a.view();
+        (void)prepared.execute(coll, scoped_bson{R"({"a": 1})"}.view());
+
+        expected = b.view();
+        (void)prepared.execute(coll, scoped_bson{R"({"b": 2})"}.view());
+
+        CHECK(count == 2);
+    }
+
+    SECTION("empty pipeline") {
+        prepared_aggregate const empty{v1::pipeline{}, v1::aggregate_options{}.batch_size(3)};
+
+        scoped_bson const filtered{R"({"0": {"$match": {"a": 1}}})"};
+
+        expected = filtered.view();
+        (void)empty.execute(coll, scoped_bson{R"({"a": 1})"}.view());
+
+        CHECK(count == 1);
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,144 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/prepared_find.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+
+#include <mongocxx/v1/find_options.hpp>
+#include <mongocxx/v1/hint.hpp>
+
+#include <mongocxx/v1/collection.hh>
+#include <mongocxx/v1/cursor.hh>
+
+#include <bsoncxx/test/v1/document/view.hh>
+
+#include <mongocxx/test/private/scoped_bson.hh>
+
+#include <string>
+#include <utility>
+
+#include <mongocxx/private/mongoc.hh>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+namespace {
+
+struct identity_type {};
+
+} // namespace
+
+TEST_CASE("ownership", "[mongocxx][v1][prepared_find]") {
+    prepared_find source{v1::find_options{}.limit(1)};
+    prepared_find target;
+
+    REQUIRE(source);
+    REQUIRE(target);
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(move);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(target);
+    }
+
+    SECTION("copy") {
+        auto copy = source;
+
+        CHECK(source);
+        CHECK(copy);
+    }
+
+    SECTION("copy assignment") {
+        target = source;
+
+        CHECK(source);
+        CHECK(target);
+    }
+}
+
+TEST_CASE("execute", "[mongocxx][v1][prepared_find]") {
+    identity_type client_identity;
+    identity_type collection_identity;
+    identity_type cursor_identity;
+
+    auto const client_id = reinterpret_cast<mongoc_client_t*>(&client_identity);
+    auto const collection_id = reinterpret_cast<mongoc_collection_t*>(&collection_identity);
+    auto const cursor_id = reinterpret_cast<mongoc_cursor_t*>(&cursor_identity);
+
+    auto collection_destroy = libmongoc::collection_destroy.create_instance();
+    auto cursor_destroy = libmongoc::cursor_destroy.create_instance();
+    auto find_with_opts = libmongoc::collection_find_with_opts.create_instance();
+
+    collection_destroy->interpose([&](mongoc_collection_t* ptr) -> void { CHECK(ptr == collection_id); }).forever();
+    cursor_destroy->interpose([&](mongoc_cursor_t* ptr) -> void { CHECK(ptr == cursor_id); }).forever();
+
+    scoped_bson const projection{R"({"x": 1})"};
+    scoped_bson const sort{R"({"y": -1})"};
+
+    prepared_find const prepared{v1::find_options{}
+                                     .batch_size(2)
+                                     .hint(v1::hint{"idx"})
+                                     .limit(5)
+                                     .projection(projection.value())
+                                     .sort(sort.value())};
+
+    scoped_bson const expected{
+        R"({"batchSize": 2, "hint": "idx", "limit": {"$numberLong": "5"}, "projection": {"x": 1}, "sort": {"y": -1}})"};
+
+    int count = 0;
+    bsoncxx::v1::document::view filter;
+
+    find_with_opts
+        ->interpose([&](mongoc_collection_t* coll,
+                        bson_t const* filter_ptr,
+                        bson_t const* opts,
+                        mongoc_read_prefs_t const* read_prefs) -> mongoc_cursor_t* {
+            CHECK(coll == collection_id);
+            CHECK(scoped_bson_view{filter_ptr}.view() == filter);
+            CHECK(scoped_bson_view{opts}.view() == expected.view());
+            CHECK(read_prefs == nullptr);
+            ++count;
+            return cursor_id;
+        })
+        .forever();
+
+    auto coll = v1::collection::internal::make(collection_id, client_id);
+
+    scoped_bson const a{R"({"a": 1})"};
+    scoped_bson const b{R"({"b": 2})"};
+
+    filter = a.view();
+    (void)prepared.execute(coll, filter);
+
+    filter = b.view();
+    (void)prepared.execute(coll, filter);
+
+    CHECK(count == 2);
+}
+
+} // namespace v1
+} // namespace mongocxx
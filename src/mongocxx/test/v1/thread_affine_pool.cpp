@@ -0,0 +1,253 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/thread_affine_pool.hh>
+
+//
+
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+
+#include <mongocxx/v1/client.hh>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <mongocxx/private/mongoc.hh>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+// Note: acquiring a client object from a pool does not require a connection to a server.
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::thread_affine_pool::errc;
+
+namespace {
+
+v1::uri unreachable() {
+    return v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=1&connectTimeoutMS=1"};
+}
+
+mongoc_client_t* as_mongoc(thread_affine_pool::lease& l) {
+    return v1::client::internal::as_mongoc(*l);
+}
+
+} // namespace
+
+TEST_CASE("error code", "[mongocxx][v1][thread_affine_pool][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::thread_affine_pool::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::thread_affine_pool"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_idle_timeout;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_idle_timeout) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_idle_timeout) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][thread_affine_pool][options]") {
+    thread_affine_pool::options const opts;
+
+    CHECK_FALSE(opts.idle_timeout().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][thread_affine_pool][options]") {
+    thread_affine_pool::options opts;
+
+    opts.idle_timeout(std::chrono::milliseconds{2});
+
+    auto const copy = opts;
+
+    CHECK(copy.idle_timeout() == std::chrono::milliseconds{2});
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][thread_affine_pool]") {
+    v1::pool pool{unreachable()};
+
+    CHECK_THROWS_WITH_CODE(
+        (thread_affine_pool{pool, thread_affine_pool::options{}.idle_timeout(std::chrono::milliseconds{0})}),
+        code::invalid_idle_timeout);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][thread_affine_pool]") {
+    v1::pool pool{unreachable()};
+
+    thread_affine_pool source{pool};
+    thread_affine_pool target{pool};
+
+    (void)source.acquire();
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(move);
+        CHECK(move.size() == 1u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        REQUIRE(target);
+        CHECK(target.size() == 1u);
+    }
+}
+
+TEST_CASE("acquire", "[mongocxx][v1][thread_affine_pool]") {
+    v1::pool pool{unreachable()};
+
+    {
+        thread_affine_pool affine{pool};
+
+        CHECK(affine.size() == 0u);
+
+        mongoc_client_t* pinned = nullptr;
+
+        {
+            auto l = affine.acquire();
+
+            REQUIRE(l);
+            pinned = as_mongoc(l);
+        }
+
+        // The client object remains pinned to this thread.
+        CHECK(affine.size() == 1u);
+        CHECK(pool.stats().in_use == 1);
+
+        SECTION("same thread") {
+            auto l = affine.acquire();
+
+            CHECK(as_mongoc(l) == pinned);
+            CHECK(pool.stats().acquired == 1);
+        }
+
+        SECTION("nested") {
+            auto outer = affine.acquire();
+            auto inner = affine.acquire();
+
+            CHECK(as_mongoc(outer) == pinned);
+            CHECK(as_mongoc(inner) != pinned);
+            CHECK(pool.stats().in_use == 2);
+
+            inner = nullptr;
+
+            CHECK_FALSE(inner);
+            CHECK(pool.stats().in_use == 1);
+        }
+
+        SECTION("other thread") {
+            mongoc_client_t* other = nullptr;
+            std::size_t size = 0u;
+
+            // Catch2 assertions are not thread-safe.
+            std::thread{[&] {
+                auto l = affine.acquire();
+                other = as_mongoc(l);
+                size = affine.size();
+            }}.join();
+
+            CHECK(size == 2u);
+            CHECK(other != nullptr);
+            CHECK(other != pinned);
+
+            // Released when the other thread exited.
+            CHECK(affine.size() == 1u);
+            CHECK(pool.stats().in_use == 1);
+        }
+    }
+
+    // Released when the thread_affine_pool object is destroyed.
+    CHECK(pool.stats().in_use == 0);
+}
+
+TEST_CASE("idle_timeout", "[mongocxx][v1][thread_affine_pool]") {
+    v1::pool pool{unreachable()};
+
+    thread_affine_pool affine{pool, thread_affine_pool::options{}.idle_timeout(std::chrono::milliseconds{1})};
+
+    (void)affine.acquire();
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+
+    while (affine.size() != 0u && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    CHECK(affine.size() == 0u);
+    CHECK(pool.stats().in_use == 0);
+
+    // A client object is pinned again on the next acquisition.
+    {
+        auto l = affine.acquire();
+
+        CHECK(l);
+        CHECK(pool.stats().in_use == 1);
+    }
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -0,0 +1,199 @@
+// Copyright 2009-present MongoDB, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mongocxx/v1/write_combiner.hpp>
+
+//
+
+#include <bsoncxx/v1/document/value.hpp>
+
+#include <mongocxx/v1/exception.hpp>
+#include <mongocxx/v1/insert_one_result.hpp>
+#include <mongocxx/v1/pool.hpp>
+#include <mongocxx/v1/uri.hpp>
+#include <mongocxx/v1/write_concern.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <bsoncxx/test/system_error.hh>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+namespace mongocxx {
+namespace v1 {
+
+using code = mongocxx::v1::write_combiner::errc;
+
+TEST_CASE("error code", "[mongocxx][v1][write_combiner][error]") {
+    using mongocxx::v1::source_errc;
+    using mongocxx::v1::type_errc;
+
+    auto const& category = mongocxx::v1::write_combiner::error_category();
+    CHECK_THAT(category.name(), Catch::Matchers::Equals("mongocxx::v1::write_combiner"));
+
+    auto const zero_errc = make_error_condition(static_cast<std::errc>(0));
+
+    SECTION("unknown") {
+        std::error_code const ec = static_cast<code>(-1);
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == -1);
+        CHECK(ec);
+        CHECK(ec.message() == std::string(category.name()) + ":-1");
+    }
+
+    SECTION("zero") {
+        std::error_code const ec = code::zero;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() == 0);
+        CHECK_FALSE(ec);
+        CHECK(ec.message() == "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("non-zero") {
+        std::error_code const ec = code::invalid_max_batch_size;
+
+        CHECK(ec.category() == category);
+        CHECK(ec.value() != static_cast<int>(code::zero));
+        CHECK(ec);
+        CHECK(ec.message() != "zero");
+
+        CHECK(ec != zero_errc);
+        CHECK(ec != source_errc::zero);
+        CHECK(ec != type_errc::zero);
+    }
+
+    SECTION("source") {
+        CHECK(make_error_code(code::invalid_max_batch_size) == source_errc::mongocxx);
+    }
+
+    SECTION("type") {
+        CHECK(make_error_code(code::invalid_max_batch_size) == type_errc::invalid_argument);
+    }
+}
+
+TEST_CASE("default", "[mongocxx][v1][write_combiner][options]") {
+    write_combiner::options const opts;
+
+    CHECK_FALSE(opts.bypass_document_validation().has_value());
+    CHECK_FALSE(opts.max_batch_size().has_value());
+    CHECK_FALSE(opts.max_delay().has_value());
+    CHECK_FALSE(opts.write_concern().has_value());
+}
+
+TEST_CASE("fields", "[mongocxx][v1][write_combiner][options]") {
+    write_combiner::options opts;
+
+    opts.bypass_document_validation(true)
+        .max_batch_size(10u)
+        .max_delay(std::chrono::microseconds{50})
+        .write_concern(v1::write_concern{}.acknowledge_level(v1::write_concern::level::k_majority));
+
+    auto const copy = opts;
+
+    CHECK(copy.bypass_document_validation() == true);
+    CHECK(copy.max_batch_size() == std::size_t{10});
+    CHECK(copy.max_delay() == std::chrono::microseconds{50});
+    REQUIRE(copy.write_concern().has_value());
+    CHECK(copy.write_concern()->acknowledge_level() == v1::write_concern::level::k_majority);
+}
+
+TEST_CASE("exceptions", "[mongocxx][v1][write_combiner]") {
+    v1::pool pool;
+
+    CHECK_THROWS_WITH_CODE(
+        (write_combiner{pool, "db", "coll", write_combiner::options{}.max_batch_size(0u)}),
+        code::invalid_max_batch_size);
+}
+
+TEST_CASE("ownership", "[mongocxx][v1][write_combiner]") {
+    v1::pool pool;
+
+    write_combiner source{pool, "db", "source"};
+    write_combiner target{pool, "db", "target"};
+
+    SECTION("move") {
+        auto move = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(move);
+        CHECK(move.batch_count() == 0u);
+        CHECK(move.document_count() == 0u);
+    }
+
+    SECTION("move assignment") {
+        target = std::move(source);
+
+        CHECK_FALSE(source);
+        CHECK(target);
+    }
+}
+
+TEST_CASE("batching", "[mongocxx][v1][write_combiner]") {
+    // No server is listening on this port: every combined bulk write operation fails server selection after 500ms.
+    v1::pool pool{v1::uri{"mongodb://localhost:1/?serverSelectionTimeoutMS=500&connectTimeoutMS=1"}};
+
+    std::size_t const n = 8u;
+
+    // A batch is only delayed while another batch is being executed.
+    write_combiner combiner{
+        pool, "db", "coll", write_combiner::options{}.max_batch_size(n).max_delay(std::chrono::seconds{60})};
+
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+
+    auto const insert = [&combiner, &failures] {
+        try {
+            (void)combiner.insert_one(bsoncxx::v1::document::view{});
+        } catch (v1::exception const&) {
+            ++failures;
+        }
+    };
+
+    // An uncontended insert is executed immediately as a batch of its own.
+    threads.emplace_back(insert);
+
+    while (combiner.batch_count() == 0u) {
+        std::this_thread::yield();
+    }
+
+    // Concurrent inserts join the next batch while the first is being executed.
+    for (std::size_t i = 0u; i < n; ++i) {
+        threads.emplace_back(insert);
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    CHECK(failures == static_cast<int>(n + 1u));
+    CHECK(combiner.batch_count() == 2u);
+    CHECK(combiner.document_count() == n + 1u);
+}
+
+} // namespace v1
+} // namespace mongocxx
@@ -64,5 +64,22 @@ TEST_CASE("equality", "[mongocxx][v_noabi][result][insert_many]") {
     }
 }
 
+TEST_CASE("inserted_ids", "[mongocxx][v_noabi][result][insert_many]") {
+    auto const n4 = v1::bulk_write::result::internal::make(scoped_bson{R"({"nInserted": 4})"}.value());
+
+    // Only the IDs of the second and fourth operations are reported (e.g. by `id_mode::k_generated`).
+    auto const ids = bsoncxx::v1::array::value{scoped_bson{R"({"1": 1, "3": "three"})"}.array_view()};
+
+    auto const res = from_v1(v1::insert_many_result::internal::make(n4, ids));
+    auto const id_map = res.inserted_ids();
+
+    REQUIRE(id_map.size() == 2u);
+    REQUIRE(id_map.count(1u) == 1u);
+    REQUIRE(id_map.count(3u) == 1u);
+
+    CHECK(id_map.at(1u).get_int32().value == 1);
+    CHECK(id_map.at(3u).get_string().value == "three");
+}
+
 } // namespace v_noabi
 } // namespace mongocxx